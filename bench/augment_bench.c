@@ -0,0 +1,196 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../include/jrbtree.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions of Benchmark
+////////////////////////////////////////////////////////////////////////////////
+
+// 키 개수를 지정하지 않은 경우 측정할 키 개수들
+static const int defaultKeyCounts[] = { 1000, 100000, 1000000 };
+// 측정할 범위 검색 횟수 (순회는 느리므로 SCAN_COUNT 번만 측정)
+#define QUERY_COUNT 1000000
+#define SCAN_COUNT 1000
+
+// 키 값과 집계할 값을 같이 저장하는 레코드 (key 가 첫 번째 멤버이므로 IntType 키로 사용)
+typedef struct _bench_record_t {
+	int key;
+	int value;
+} BenchRecord;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Benchmark Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static void CombineSum(void *aggregate, const void *key, const void *leftAggregate, const void *rightAggregate);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static double _GetTime();
+static unsigned int _NextRandom(unsigned int *state);
+static void _Shuffle(int *array, int count, unsigned int *state);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Main Function
+/// 사용법: ./augment_bench [키 개수]
+/// 값의 합을 집계하는 트리(NewJRBTreeAugmented)에서 무작위 키 범위(평균 키 개수의 1/4)의 합을
+/// LowerBound 부터 순회해서 계산한 경우(scan)와 JRBTreeRangeAggregate 로 계산한 경우(aggregate)의
+/// 한 번의 평균 시간과, 집계 값이 없는 트리(plain)와 비교한 노드 추가 한 번의 평균 시간을 출력한다.
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char **argv)
+{
+	int sizeCount = (int)(sizeof(defaultKeyCounts) / sizeof(defaultKeyCounts[0]));
+	int argumentKeyCount = (argc > 1) ? atoi(argv[1]) : 0;
+	if(argumentKeyCount > 0) sizeCount = 1;
+
+	printf("%10s %12s %12s %12s %12s\n", "keys", "plain ins", "augment ins", "scan ns", "aggregate ns");
+
+	int sizeIndex = 0;
+	for( ; sizeIndex < sizeCount; sizeIndex++)
+	{
+		int keyCount = (argumentKeyCount > 0) ? argumentKeyCount : defaultKeyCounts[sizeIndex];
+		unsigned int state = 20211019;
+
+		int *order = (int*)malloc(sizeof(int) * (size_t)keyCount);
+		BenchRecord *records = (BenchRecord*)malloc(sizeof(BenchRecord) * (size_t)keyCount);
+		if(order == NULL || records == NULL) return -1;
+
+		int keyIndex = 0;
+		for( ; keyIndex < keyCount; keyIndex++)
+		{
+			order[keyIndex] = keyIndex;
+			records[keyIndex].key = keyIndex;
+			records[keyIndex].value = (int)(_NextRandom(&state) % 1000);
+		}
+		_Shuffle(order, keyCount, &state);
+
+		JRBTreePtr plainTree = NewJRBTree(IntType);
+		JRBTreePtr tree = NewJRBTreeAugmented(IntType, sizeof(long long), CombineSum);
+		if(plainTree == NULL || tree == NULL) return -1;
+
+		double startTime = _GetTime();
+		for(keyIndex = 0; keyIndex < keyCount; keyIndex++) JRBTreeInsertNode(plainTree, &records[order[keyIndex]]);
+		double plainInsertNs = (_GetTime() - startTime) * 1e9 / keyCount;
+
+		startTime = _GetTime();
+		for(keyIndex = 0; keyIndex < keyCount; keyIndex++) JRBTreeInsertNode(tree, &records[order[keyIndex]]);
+		double insertNs = (_GetTime() - startTime) * 1e9 / keyCount;
+
+		// 같은 범위로 두 방법의 합이 같은지 확인한다.
+		long long scanTotal = 0;
+		unsigned int queryState = state;
+		startTime = _GetTime();
+		int queryIndex = 0;
+		for( ; queryIndex < SCAN_COUNT; queryIndex++)
+		{
+			int lo = (int)(_NextRandom(&queryState) % (unsigned int)keyCount);
+			int hi = lo + (int)(_NextRandom(&queryState) % (unsigned int)(keyCount / 2 + 1));
+			JNodePtr node = JRBTreeLowerBound(tree, &lo);
+			for( ; node != NULL && ((BenchRecord*)JNodeGetKey(node))->key <= hi; node = JNodeGetNext(node)) scanTotal += ((BenchRecord*)JNodeGetKey(node))->value;
+		}
+		double scanNs = (_GetTime() - startTime) * 1e9 / SCAN_COUNT;
+
+		long long aggregateTotal = 0;
+		long long checkTotal = 0;
+		queryState = state;
+		startTime = _GetTime();
+		for(queryIndex = 0; queryIndex < QUERY_COUNT; queryIndex++)
+		{
+			int lo = (int)(_NextRandom(&queryState) % (unsigned int)keyCount);
+			int hi = lo + (int)(_NextRandom(&queryState) % (unsigned int)(keyCount / 2 + 1));
+			long long sum = 0;
+			if(JRBTreeRangeAggregate(tree, &lo, &hi, &sum) == 1) aggregateTotal += sum;
+			if(queryIndex == SCAN_COUNT - 1) checkTotal = aggregateTotal;
+		}
+		double aggregateNs = (_GetTime() - startTime) * 1e9 / QUERY_COUNT;
+		if(checkTotal != scanTotal) return -1;
+
+		printf("%10d %12.1f %12.1f %12.1f %12.1f\n", keyCount, plainInsertNs, insertNs, scanNs, aggregateNs);
+
+		DeleteJRBTree(&tree);
+		DeleteJRBTree(&plainTree);
+		free(records);
+		free(order);
+	}
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Benchmark Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void CombineSum(void *aggregate, const void *key, const void *leftAggregate, const void *rightAggregate)
+ * @brief 서브 트리의 값의 합을 계산하는 집계 함수 (JRBTreeAggregateCombine)
+ * @param aggregate 합을 저장할 주소, long long(출력)
+ * @param key 노드의 레코드(입력, 읽기 전용)
+ * @param leftAggregate 왼쪽 서브 트리의 합(입력, 읽기 전용, NULL 가능)
+ * @param rightAggregate 오른쪽 서브 트리의 합(입력, 읽기 전용, NULL 가능)
+ * @return 반환값 없음
+ */
+static void CombineSum(void *aggregate, const void *key, const void *leftAggregate, const void *rightAggregate)
+{
+	long long sum = ((const BenchRecord*)key)->value;
+	if(leftAggregate != NULL) sum += *((const long long*)leftAggregate);
+	if(rightAggregate != NULL) sum += *((const long long*)rightAggregate);
+	*((long long*)aggregate) = sum;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static double _GetTime()
+ * @brief 단조 증가 시계의 현재 시간을 초 단위로 반환하는 함수
+ * @return 항상 현재 시간(초) 반환
+ */
+static double _GetTime()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/**
+ * @fn static unsigned int _NextRandom(unsigned int *state)
+ * @brief 재현 가능한 의사 난수를 생성하는 함수 (xorshift32)
+ * @param state 난수 상태(입력, 출력)
+ * @return 항상 다음 난수 반환
+ */
+static unsigned int _NextRandom(unsigned int *state)
+{
+	unsigned int x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+/**
+ * @fn static void _Shuffle(int *array, int count, unsigned int *state)
+ * @brief 배열을 무작위로 섞는 함수 (Fisher-Yates)
+ * @param array 섞을 배열(입력, 출력)
+ * @param count 배열 원소 개수(입력)
+ * @param state 난수 상태(입력, 출력)
+ * @return 반환값 없음
+ */
+static void _Shuffle(int *array, int count, unsigned int *state)
+{
+	int index = count - 1;
+	for( ; index > 0; index--)
+	{
+		int target = (int)(_NextRandom(state) % (unsigned int)(index + 1));
+		int temp = array[index];
+		array[index] = array[target];
+		array[target] = temp;
+	}
+}
@@ -0,0 +1,233 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../include/jrbtree.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions of Benchmark
+////////////////////////////////////////////////////////////////////////////////
+
+// 키 개수를 지정하지 않은 경우 측정할 키 개수들 (캐시 안, L2/L3, 메모리)
+static const int defaultKeyCounts[] = { 1000, 100000, 1000000 };
+// 키 개수와 상관없이 측정할 검색 횟수
+#define LOOKUP_COUNT 4000000
+// 전체 순회 횟수 (키 개수가 적으면 늘린다)
+#define SCAN_KEY_COUNT 10000000
+
+// 측정 결과 구조체
+typedef struct _engine_result_t {
+	// 추가 한 번의 평균 시간 (ns)
+	double insertNs;
+	// 검색 한 번의 평균 시간 (ns)
+	double findNs;
+	// 순회할 때 키 한 개의 평균 시간 (ns)
+	double scanNs;
+	// 삭제 한 번의 평균 시간 (ns)
+	double deleteNs;
+	// 키 한 개의 평균 메모리 크기 (JRBTreeGetStats)
+	double bytesPerKey;
+	// 찾은 노드 개수와 순회한 키 값의 합 (두 엔진의 결과 비교용)
+	long long checksum;
+} EngineResult, *EngineResultPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Benchmark Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int MeasureEngine(JRBTreeEngine engine, int *keys, int keyCount, int **lookupKeys, const int *deleteOrder, EngineResultPtr result);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static double _GetTime();
+static unsigned int _NextRandom(unsigned int *state);
+static void _Shuffle(int *array, int count, unsigned int *state);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Main Function
+/// 사용법: ./bplus_bench [키 개수]
+/// 같은 정수 키와 같은 순서로 RB Tree 엔진(rbtree)과 B+ Tree 엔진(bplus)에
+/// 무작위 순서 추가, 무작위 검색, JNodeGetNext 전체 순회, 무작위 순서 삭제를 수행하고
+/// 연산마다 평균 시간과 키 한 개의 메모리 크기를 출력한다.
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char **argv)
+{
+	int sizeCount = (int)(sizeof(defaultKeyCounts) / sizeof(defaultKeyCounts[0]));
+	int argumentKeyCount = (argc > 1) ? atoi(argv[1]) : 0;
+	if(argumentKeyCount > 0) sizeCount = 1;
+
+	printf("%10s %8s %12s %12s %12s %12s %10s\n", "keys", "engine", "insert ns", "find ns", "scan ns/key", "delete ns", "bytes/key");
+
+	int sizeIndex = 0;
+	for( ; sizeIndex < sizeCount; sizeIndex++)
+	{
+		int keyCount = (argumentKeyCount > 0) ? argumentKeyCount : defaultKeyCounts[sizeIndex];
+		unsigned int state = 20211019;
+
+		int *keys = (int*)malloc(sizeof(int) * (size_t)keyCount);
+		int *deleteOrder = (int*)malloc(sizeof(int) * (size_t)keyCount);
+		int **lookupKeys = (int**)malloc(sizeof(int*) * LOOKUP_COUNT);
+		if(keys == NULL || deleteOrder == NULL || lookupKeys == NULL) return -1;
+
+		int keyIndex = 0;
+		for( ; keyIndex < keyCount; keyIndex++)
+		{
+			keys[keyIndex] = keyIndex;
+			deleteOrder[keyIndex] = keyIndex;
+		}
+		_Shuffle(keys, keyCount, &state);
+		_Shuffle(deleteOrder, keyCount, &state);
+
+		// 두 엔진 모두 키의 주소로 검색하므로 저장한 주소를 무작위로 골라서 검색한다.
+		int lookupIndex = 0;
+		for( ; lookupIndex < LOOKUP_COUNT; lookupIndex++)
+		{
+			lookupKeys[lookupIndex] = &keys[_NextRandom(&state) % (unsigned int)keyCount];
+		}
+
+		EngineResult redBlackResult;
+		EngineResult bplusResult;
+		if(MeasureEngine(EngineRedBlack, keys, keyCount, lookupKeys, deleteOrder, &redBlackResult) != 0) return -1;
+		if(MeasureEngine(EngineBPlus, keys, keyCount, lookupKeys, deleteOrder, &bplusResult) != 0) return -1;
+		if(redBlackResult.checksum != bplusResult.checksum) return -1;
+
+		EngineResultPtr results[2];
+		results[0] = &redBlackResult;
+		results[1] = &bplusResult;
+		const char *names[2];
+		names[0] = "rbtree";
+		names[1] = "bplus";
+
+		int resultIndex = 0;
+		for( ; resultIndex < 2; resultIndex++)
+		{
+			printf("%10d %8s %12.1f %12.1f %12.2f %12.1f %10.1f\n", keyCount, names[resultIndex],
+				results[resultIndex]->insertNs, results[resultIndex]->findNs, results[resultIndex]->scanNs,
+				results[resultIndex]->deleteNs, results[resultIndex]->bytesPerKey);
+		}
+
+		free(lookupKeys);
+		free(deleteOrder);
+		free(keys);
+	}
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Benchmark Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int MeasureEngine(JRBTreeEngine engine, int *keys, int keyCount, int **lookupKeys, const int *deleteOrder, EngineResultPtr result)
+ * @brief 지정한 엔진의 트리에 추가, 검색, 순회, 삭제를 차례로 수행하면서 시간을 측정하는 함수
+ * @param engine 측정할 엔진(입력)
+ * @param keys 추가할 키 배열, 배열 순서로 추가한다.(입력)
+ * @param keyCount 키 개수(입력)
+ * @param lookupKeys 검색할 키 주소 배열, LOOKUP_COUNT 개(입력)
+ * @param deleteOrder 삭제할 키의 keys 위치 배열(입력, 읽기 전용)
+ * @param result 측정 결과(출력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+static int MeasureEngine(JRBTreeEngine engine, int *keys, int keyCount, int **lookupKeys, const int *deleteOrder, EngineResultPtr result)
+{
+	JRBTreePtr tree = NewJRBTreeWithEngine(IntType, engine);
+	if(tree == NULL) return -1;
+	result->checksum = 0;
+
+	int keyIndex = 0;
+	double startTime = _GetTime();
+	for( ; keyIndex < keyCount; keyIndex++)
+	{
+		if(JRBTreeInsertNode(tree, &keys[keyIndex]) == NULL) return -1;
+	}
+	result->insertNs = (_GetTime() - startTime) * 1e9 / keyCount;
+
+	JRBTreeStats stats;
+	JRBTreeGetStats(tree, &stats);
+	result->bytesPerKey = (double)stats.allocatedBytes / keyCount;
+
+	int lookupIndex = 0;
+	startTime = _GetTime();
+	for( ; lookupIndex < LOOKUP_COUNT; lookupIndex++)
+	{
+		if(JRBTreeFindNodeByKey(tree, lookupKeys[lookupIndex]) != NULL) result->checksum++;
+	}
+	result->findNs = (_GetTime() - startTime) * 1e9 / LOOKUP_COUNT;
+
+	int scanCount = (SCAN_KEY_COUNT + keyCount - 1) / keyCount;
+	int scanIndex = 0;
+	startTime = _GetTime();
+	for( ; scanIndex < scanCount; scanIndex++)
+	{
+		JNodePtr currentNode = JRBTreeMin(tree);
+		for( ; currentNode != NULL; currentNode = JNodeGetNext(currentNode)) result->checksum += *((int*)JNodeGetKey(currentNode));
+	}
+	result->scanNs = (_GetTime() - startTime) * 1e9 / ((double)scanCount * keyCount);
+
+	startTime = _GetTime();
+	for(keyIndex = 0; keyIndex < keyCount; keyIndex++)
+	{
+		if(JRBTreeDeleteNodeByKey(tree, &keys[deleteOrder[keyIndex]]) != DeleteSuccess) return -1;
+	}
+	result->deleteNs = (_GetTime() - startTime) * 1e9 / keyCount;
+
+	DeleteJRBTree(&tree);
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static double _GetTime()
+ * @brief 단조 증가 시계의 현재 시간을 초 단위로 반환하는 함수
+ * @return 항상 현재 시간(초) 반환
+ */
+static double _GetTime()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/**
+ * @fn static unsigned int _NextRandom(unsigned int *state)
+ * @brief 재현 가능한 의사 난수를 생성하는 함수 (xorshift32)
+ * @param state 난수 상태(입력, 출력)
+ * @return 항상 다음 난수 반환
+ */
+static unsigned int _NextRandom(unsigned int *state)
+{
+	unsigned int x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+/**
+ * @fn static void _Shuffle(int *array, int count, unsigned int *state)
+ * @brief 배열을 무작위로 섞는 함수 (Fisher-Yates)
+ * @param array 섞을 배열(입력, 출력)
+ * @param count 배열 원소 개수(입력)
+ * @param state 난수 상태(입력, 출력)
+ * @return 반환값 없음
+ */
+static void _Shuffle(int *array, int count, unsigned int *state)
+{
+	int index = count - 1;
+	for( ; index > 0; index--)
+	{
+		int target = (int)(_NextRandom(state) % (unsigned int)(index + 1));
+		int temp = array[index];
+		array[index] = array[target];
+		array[target] = temp;
+	}
+}
@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../include/jrbtree.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions of Benchmark
+////////////////////////////////////////////////////////////////////////////////
+
+// 키 개수를 지정하지 않은 경우 측정할 키 개수들
+static const int defaultKeyCounts[] = { 100000, 1000000, 4000000 };
+// 측정할 thread 개수들
+static const int threadCounts[] = { 1, 2, 4, 8 };
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static double _GetTime();
+static unsigned int _NextRandom(unsigned int *state);
+static void _Shuffle(int *array, int count, unsigned int *state);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Main Function
+/// 사용법: ./build_bench [키 개수]
+/// 무작위 순서의 정수 키 배열(값마다 평균 1.25 번 나옴)로 트리를 만들 때
+/// JRBTreeInsertNode 로 하나씩 추가한 경우(insert)와 thread 개수별로 JRBTreeBuildParallel 로 생성한 경우의
+/// 키 한 개의 평균 시간을 출력한다.
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char **argv)
+{
+	int sizeCount = (int)(sizeof(defaultKeyCounts) / sizeof(defaultKeyCounts[0]));
+	int threadCountCount = (int)(sizeof(threadCounts) / sizeof(threadCounts[0]));
+	int argumentKeyCount = (argc > 1) ? atoi(argv[1]) : 0;
+	if(argumentKeyCount > 0) sizeCount = 1;
+
+	printf("%10s %8s %12s %10s\n", "keys", "threads", "build ns", "unique");
+
+	int sizeIndex = 0;
+	for( ; sizeIndex < sizeCount; sizeIndex++)
+	{
+		int keyCount = (argumentKeyCount > 0) ? argumentKeyCount : defaultKeyCounts[sizeIndex];
+		unsigned int state = 20211019;
+
+		// 같은 값의 키도 주소가 다르므로 하나씩 추가하는 경우에는 값마다 처음 나온 키만 추가한다.
+		int *values = (int*)malloc(sizeof(int) * (size_t)keyCount);
+		int *order = (int*)malloc(sizeof(int) * (size_t)keyCount);
+		void **keys = (void**)malloc(sizeof(void*) * (size_t)keyCount);
+		char *isSeen = (char*)calloc((size_t)keyCount, 1);
+		if(values == NULL || order == NULL || keys == NULL || isSeen == NULL) return -1;
+
+		int keyIndex = 0;
+		for( ; keyIndex < keyCount; keyIndex++) order[keyIndex] = keyIndex;
+		_Shuffle(order, keyCount, &state);
+		for(keyIndex = 0; keyIndex < keyCount; keyIndex++)
+		{
+			values[keyIndex] = (_NextRandom(&state) % 5 == 0) ? order[_NextRandom(&state) % (unsigned int)keyCount] : order[keyIndex];
+			keys[keyIndex] = &values[keyIndex];
+		}
+
+		double startTime = _GetTime();
+		JRBTreePtr tree = NewJRBTree(IntType);
+		if(tree == NULL) return -1;
+		for(keyIndex = 0; keyIndex < keyCount; keyIndex++)
+		{
+			if(isSeen[values[keyIndex]] == 1) continue;
+			isSeen[values[keyIndex]] = 1;
+			JRBTreeInsertNode(tree, keys[keyIndex]);
+		}
+		double insertNs = (_GetTime() - startTime) * 1e9 / keyCount;
+		size_t uniqueCount = JRBTreeSize(tree);
+		printf("%10d %8s %12.1f %10d\n", keyCount, "insert", insertNs, (int)uniqueCount);
+		DeleteJRBTree(&tree);
+
+		int threadIndex = 0;
+		for( ; threadIndex < threadCountCount; threadIndex++)
+		{
+			startTime = _GetTime();
+			tree = JRBTreeBuildParallel(IntType, keys, (size_t)keyCount, threadCounts[threadIndex]);
+			if(tree == NULL || JRBTreeSize(tree) != uniqueCount) return -1;
+			double buildNs = (_GetTime() - startTime) * 1e9 / keyCount;
+			printf("%10d %8d %12.1f %10d\n", keyCount, threadCounts[threadIndex], buildNs, (int)uniqueCount);
+			DeleteJRBTree(&tree);
+		}
+
+		free(isSeen);
+		free(keys);
+		free(order);
+		free(values);
+	}
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static double _GetTime()
+ * @brief 단조 증가 시계의 현재 시간을 초 단위로 반환하는 함수
+ * @return 항상 현재 시간(초) 반환
+ */
+static double _GetTime()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/**
+ * @fn static unsigned int _NextRandom(unsigned int *state)
+ * @brief 재현 가능한 의사 난수를 생성하는 함수 (xorshift32)
+ * @param state 난수 상태(입력, 출력)
+ * @return 항상 다음 난수 반환
+ */
+static unsigned int _NextRandom(unsigned int *state)
+{
+	unsigned int x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+/**
+ * @fn static void _Shuffle(int *array, int count, unsigned int *state)
+ * @brief 배열을 무작위로 섞는 함수 (Fisher-Yates)
+ * @param array 섞을 배열(입력, 출력)
+ * @param count 배열 원소 개수(입력)
+ * @param state 난수 상태(입력, 출력)
+ * @return 반환값 없음
+ */
+static void _Shuffle(int *array, int count, unsigned int *state)
+{
+	int index = count - 1;
+	for( ; index > 0; index--)
+	{
+		int target = (int)(_NextRandom(state) % (unsigned int)(index + 1));
+		int temp = array[index];
+		array[index] = array[target];
+		array[target] = temp;
+	}
+}
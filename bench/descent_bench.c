@@ -0,0 +1,297 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#define DESCENT_PERF_EVENT
+#endif
+
+#include "../include/jrbtree.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions of Benchmark
+////////////////////////////////////////////////////////////////////////////////
+
+// 키 개수를 지정하지 않은 경우 측정할 키 개수들 (캐시 안, L2/L3, 메모리)
+static const int defaultKeyCounts[] = { 1000, 100000, 1000000 };
+// 키 개수와 상관없이 측정할 검색 횟수
+#define LOOKUP_COUNT 4000000
+
+// 측정 결과 구조체
+typedef struct _descent_result_t {
+	// 검색 한 번의 평균 시간 (ns)
+	double nsPerLookup;
+	// 검색 한 번의 평균 분기 예측 실패 횟수 (측정할 수 없으면 음수)
+	double missesPerLookup;
+	// 찾은 노드 개수
+	long foundCount;
+} DescentResult, *DescentResultPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Benchmark Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static JNodePtr FindBranchy(const JRBTreePtr tree, void *key);
+static void MeasureLookups(const JRBTreePtr tree, int **lookupKeys, int lookupCount, int useBranchy, DescentResultPtr result);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static double _GetTime();
+static unsigned int _NextRandom(unsigned int *state);
+static void _Shuffle(int *array, int count, unsigned int *state);
+static int _OpenBranchMissCounter();
+static long long _ReadCounter(int fd);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Main Function
+/// 사용법: ./descent_bench [키 개수]
+/// 정수 키를 무작위 순서로 검색하면서 키 유형 switch 와 비교 분기를 사용하는 예전 방식의 내려가기(branchy)와
+/// child[비교 결과] 로 인덱싱하는 JRBTreeFindNodeByKey(branchless)의 시간과 분기 예측 실패 횟수를 비교한다.
+/// 분기 예측 실패 횟수는 perf_event_open 을 사용할 수 없으면 n/a 로 출력한다.
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char **argv)
+{
+	int sizeCount = (int)(sizeof(defaultKeyCounts) / sizeof(defaultKeyCounts[0]));
+	int argumentKeyCount = (argc > 1) ? atoi(argv[1]) : 0;
+	if(argumentKeyCount > 0) sizeCount = 1;
+
+	printf("%10s %10s %12s %14s\n", "keys", "descent", "ns/lookup", "misses/lookup");
+
+	int sizeIndex = 0;
+	for( ; sizeIndex < sizeCount; sizeIndex++)
+	{
+		int keyCount = (argumentKeyCount > 0) ? argumentKeyCount : defaultKeyCounts[sizeIndex];
+		unsigned int state = 20211019;
+
+		int *keys = (int*)malloc(sizeof(int) * (size_t)keyCount);
+		int **lookupKeys = (int**)malloc(sizeof(int*) * LOOKUP_COUNT);
+		if(keys == NULL || lookupKeys == NULL) return -1;
+
+		int keyIndex = 0;
+		for( ; keyIndex < keyCount; keyIndex++) keys[keyIndex] = keyIndex;
+		_Shuffle(keys, keyCount, &state);
+
+		JRBTreePtr tree = NewJRBTree(IntType);
+		for(keyIndex = 0; keyIndex < keyCount; keyIndex++) JRBTreeInsertNode(tree, &keys[keyIndex]);
+
+		// JRBTreeFindNodeByKey 는 키의 주소로 비교하므로 저장한 주소를 무작위로 골라서 검색한다.
+		int lookupIndex = 0;
+		for( ; lookupIndex < LOOKUP_COUNT; lookupIndex++)
+		{
+			lookupKeys[lookupIndex] = &keys[_NextRandom(&state) % (unsigned int)keyCount];
+		}
+
+		DescentResult branchyResult;
+		DescentResult branchlessResult;
+		MeasureLookups(tree, lookupKeys, LOOKUP_COUNT, 1, &branchyResult);
+		MeasureLookups(tree, lookupKeys, LOOKUP_COUNT, 0, &branchlessResult);
+		if(branchyResult.foundCount != branchlessResult.foundCount) return -1;
+
+		DescentResultPtr results[2];
+		results[0] = &branchyResult;
+		results[1] = &branchlessResult;
+		const char *names[2];
+		names[0] = "branchy";
+		names[1] = "branchless";
+
+		int resultIndex = 0;
+		for( ; resultIndex < 2; resultIndex++)
+		{
+			if(results[resultIndex]->missesPerLookup < 0)
+			{
+				printf("%10d %10s %12.1f %14s\n", keyCount, names[resultIndex], results[resultIndex]->nsPerLookup, "n/a");
+			}
+			else
+			{
+				printf("%10d %10s %12.1f %14.2f\n", keyCount, names[resultIndex], results[resultIndex]->nsPerLookup, results[resultIndex]->missesPerLookup);
+			}
+		}
+		printf("%10d %10s %11.2fx\n", keyCount, "speedup", branchyResult.nsPerLookup / branchlessResult.nsPerLookup);
+
+		DeleteJRBTree(&tree);
+		free(lookupKeys);
+		free(keys);
+	}
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Benchmark Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static JNodePtr FindBranchy(const JRBTreePtr tree, void *key)
+ * @brief 정수 키 전용 경로를 추가하기 전의 JRBTreeFindNodeByKey 와 같은 방식으로 검색하는 함수 (비교용)
+ * 레벨마다 키 유형 switch 와 비교 결과에 따른 left/right 분기를 수행한다.
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키의 주소(입력)
+ * @return 성공 시 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr FindBranchy(const JRBTreePtr tree, void *key)
+{
+	JNodePtr currentNode = tree->root;
+	while((currentNode != NULL) && (key != currentNode->key))
+	{
+		switch(tree->type)
+		{
+			case IntType:
+				if(*((int*)(currentNode->key)) > *((int*)(key))) currentNode = currentNode->left;
+				else currentNode = currentNode->right;
+				break;
+			case CharType:
+				if(*((char*)(currentNode->key)) > *((char*)(key))) currentNode = currentNode->left;
+				else currentNode = currentNode->right;
+				break;
+			case StringType:
+				if(strcmp((char*)(currentNode->key), (char*)(key)) > 0) currentNode = currentNode->left;
+				else currentNode = currentNode->right;
+				break;
+			default:
+				return NULL;
+		}
+	}
+	return currentNode;
+}
+
+/**
+ * @fn static void MeasureLookups(const JRBTreePtr tree, int **lookupKeys, int lookupCount, int useBranchy, DescentResultPtr result)
+ * @brief 지정한 키들을 검색하면서 시간과 분기 예측 실패 횟수를 측정하는 함수
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param lookupKeys 검색할 키 주소 배열(입력)
+ * @param lookupCount 검색 횟수(입력)
+ * @param useBranchy 1 이면 FindBranchy, 0 이면 JRBTreeFindNodeByKey 사용(입력)
+ * @param result 측정 결과(출력)
+ * @return 반환값 없음
+ */
+static void MeasureLookups(const JRBTreePtr tree, int **lookupKeys, int lookupCount, int useBranchy, DescentResultPtr result)
+{
+	int counterFd = _OpenBranchMissCounter();
+	long foundCount = 0;
+	int lookupIndex = 0;
+
+	long long startMisses = _ReadCounter(counterFd);
+	double startTime = _GetTime();
+	if(useBranchy)
+	{
+		for( ; lookupIndex < lookupCount; lookupIndex++)
+		{
+			if(FindBranchy(tree, lookupKeys[lookupIndex]) != NULL) foundCount++;
+		}
+	}
+	else
+	{
+		for( ; lookupIndex < lookupCount; lookupIndex++)
+		{
+			if(JRBTreeFindNodeByKey(tree, lookupKeys[lookupIndex]) != NULL) foundCount++;
+		}
+	}
+	double elapsedTime = _GetTime() - startTime;
+	long long endMisses = _ReadCounter(counterFd);
+
+	result->nsPerLookup = elapsedTime * 1e9 / lookupCount;
+	result->missesPerLookup = (counterFd < 0) ? -1.0 : (double)(endMisses - startMisses) / lookupCount;
+	result->foundCount = foundCount;
+
+	if(counterFd >= 0) close(counterFd);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static double _GetTime()
+ * @brief 단조 증가 시계의 현재 시간을 초 단위로 반환하는 함수
+ * @return 항상 현재 시간(초) 반환
+ */
+static double _GetTime()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/**
+ * @fn static unsigned int _NextRandom(unsigned int *state)
+ * @brief 재현 가능한 의사 난수를 생성하는 함수 (xorshift32)
+ * @param state 난수 상태(입력, 출력)
+ * @return 항상 다음 난수 반환
+ */
+static unsigned int _NextRandom(unsigned int *state)
+{
+	unsigned int x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+/**
+ * @fn static void _Shuffle(int *array, int count, unsigned int *state)
+ * @brief 배열을 무작위로 섞는 함수 (Fisher-Yates)
+ * @param array 섞을 배열(입력, 출력)
+ * @param count 배열 원소 개수(입력)
+ * @param state 난수 상태(입력, 출력)
+ * @return 반환값 없음
+ */
+static void _Shuffle(int *array, int count, unsigned int *state)
+{
+	int index = count - 1;
+	for( ; index > 0; index--)
+	{
+		int target = (int)(_NextRandom(state) % (unsigned int)(index + 1));
+		int temp = array[index];
+		array[index] = array[target];
+		array[target] = temp;
+	}
+}
+
+/**
+ * @fn static int _OpenBranchMissCounter()
+ * @brief 현재 스레드의 분기 예측 실패 하드웨어 카운터를 여는 함수 (사용자 영역만)
+ * @return 성공 시 카운터 파일 디스크립터, 실패 시(권한 없음, 가상 머신 등) -1 반환
+ */
+static int _OpenBranchMissCounter()
+{
+#ifdef DESCENT_PERF_EVENT
+	struct perf_event_attr attribute;
+	memset(&attribute, 0, sizeof(attribute));
+	attribute.type = PERF_TYPE_HARDWARE;
+	attribute.size = sizeof(attribute);
+	attribute.config = PERF_COUNT_HW_BRANCH_MISSES;
+	attribute.exclude_kernel = 1;
+	attribute.exclude_hv = 1;
+
+	int fd = (int)syscall(SYS_perf_event_open, &attribute, 0, -1, -1, 0);
+	if(fd < 0) return -1;
+	ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+	ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+	return fd;
+#else
+	return -1;
+#endif
+}
+
+/**
+ * @fn static long long _ReadCounter(int fd)
+ * @brief 하드웨어 카운터의 현재 값을 읽는 함수
+ * @param fd 카운터 파일 디스크립터(입력, 음수면 읽지 않음)
+ * @return 성공 시 카운터 값, 실패 시 0 반환
+ */
+static long long _ReadCounter(int fd)
+{
+	long long value = 0;
+	if(fd < 0) return 0;
+	if(read(fd, &value, sizeof(value)) != (ssize_t)sizeof(value)) return 0;
+	return value;
+}
@@ -0,0 +1,171 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/jrbtree.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions of Benchmark
+////////////////////////////////////////////////////////////////////////////////
+
+// 기본 키 개수
+#define DEFAULT_KEY_COUNT 10000000
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static double _GetTime();
+static unsigned int _NextRandom(unsigned int *state);
+static void _Shuffle(int *array, int count, unsigned int *state);
+static const char* _FrozenSearchTypeToString(FrozenSearchType searchType);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Main Function
+/// 사용법: ./frozen_bench [키 개수]
+/// 같은 키들을 JRBTreeFindNodeByKey 와 JRBTreeFrozenFindNodeByKey 로 검색해서 시간을 비교한다.
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char **argv)
+{
+	int keyCount = (argc > 1) ? atoi(argv[1]) : DEFAULT_KEY_COUNT;
+	if(keyCount <= 0) keyCount = DEFAULT_KEY_COUNT;
+
+	unsigned int state = 20211019;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)keyCount);
+	int *order = (int*)malloc(sizeof(int) * (size_t)keyCount);
+	if(keys == NULL || order == NULL) return -1;
+
+	// 서로 다른 짝수 키를 무작위 순서로 저장한다. (홀수 키는 검색 실패용)
+	int keyIndex = 0;
+	for( ; keyIndex < keyCount; keyIndex++)
+	{
+		keys[keyIndex] = keyIndex * 2;
+		order[keyIndex] = keyIndex;
+	}
+	_Shuffle(keys, keyCount, &state);
+	_Shuffle(order, keyCount, &state);
+
+	JRBTreePtr tree = NewJRBTree(IntType);
+	double startTime = _GetTime();
+	for(keyIndex = 0; keyIndex < keyCount; keyIndex++) JRBTreeInsertNode(tree, &keys[keyIndex]);
+	double insertTime = _GetTime() - startTime;
+
+	startTime = _GetTime();
+	JRBTreeFrozenPtr frozen = NewJRBTreeFrozen(tree);
+	double freezeTime = _GetTime() - startTime;
+	if(frozen == NULL) return -1;
+
+	// JRBTreeFindNodeByKey 는 키의 주소로 비교하므로 저장한 주소를 그대로 사용한다.
+	long foundCount = 0;
+	startTime = _GetTime();
+	for(keyIndex = 0; keyIndex < keyCount; keyIndex++)
+	{
+		if(JRBTreeFindNodeByKey(tree, &keys[order[keyIndex]]) != NULL) foundCount++;
+	}
+	double treeTime = _GetTime() - startTime;
+
+	long frozenFoundCount = 0;
+	startTime = _GetTime();
+	for(keyIndex = 0; keyIndex < keyCount; keyIndex++)
+	{
+		if(JRBTreeFrozenFindNodeByKey(frozen, &keys[order[keyIndex]]) != NULL) frozenFoundCount++;
+	}
+	double frozenTime = _GetTime() - startTime;
+
+	long missCount = 0;
+	startTime = _GetTime();
+	for(keyIndex = 0; keyIndex < keyCount; keyIndex++)
+	{
+		int missKey = keys[order[keyIndex]] + 1;
+		if(JRBTreeFrozenFindNodeByKey(frozen, &missKey) == NULL) missCount++;
+	}
+	double frozenMissTime = _GetTime() - startTime;
+
+	printf("keys            : %d\n", keyCount);
+	printf("search type     : %s\n", _FrozenSearchTypeToString(frozen->searchType));
+	printf("insert          : %.3f s\n", insertTime);
+	printf("freeze          : %.3f s\n", freezeTime);
+	printf("tree find (hit) : %.1f ns/op (%ld found)\n", treeTime * 1e9 / keyCount, foundCount);
+	printf("frozen (hit)    : %.1f ns/op (%ld found)\n", frozenTime * 1e9 / keyCount, frozenFoundCount);
+	printf("frozen (miss)   : %.1f ns/op (%ld missed)\n", frozenMissTime * 1e9 / keyCount, missCount);
+	printf("speedup (hit)   : %.2fx\n", treeTime / frozenTime);
+
+	DeleteJRBTreeFrozen(&frozen);
+	DeleteJRBTree(&tree);
+	free(order);
+	free(keys);
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static double _GetTime()
+ * @brief 단조 증가 시계의 현재 시간을 초 단위로 반환하는 함수
+ * @return 항상 현재 시간(초) 반환
+ */
+static double _GetTime()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/**
+ * @fn static unsigned int _NextRandom(unsigned int *state)
+ * @brief 재현 가능한 의사 난수를 생성하는 함수 (xorshift32)
+ * @param state 난수 상태(입력, 출력)
+ * @return 항상 다음 난수 반환
+ */
+static unsigned int _NextRandom(unsigned int *state)
+{
+	unsigned int x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+/**
+ * @fn static void _Shuffle(int *array, int count, unsigned int *state)
+ * @brief 배열을 무작위로 섞는 함수 (Fisher-Yates)
+ * @param array 섞을 배열(입력, 출력)
+ * @param count 배열 원소 개수(입력)
+ * @param state 난수 상태(입력, 출력)
+ * @return 반환값 없음
+ */
+static void _Shuffle(int *array, int count, unsigned int *state)
+{
+	int index = count - 1;
+	for( ; index > 0; index--)
+	{
+		int target = (int)(_NextRandom(state) % (unsigned int)(index + 1));
+		int temp = array[index];
+		array[index] = array[target];
+		array[target] = temp;
+	}
+}
+
+/**
+ * @fn static const char* _FrozenSearchTypeToString(FrozenSearchType searchType)
+ * @brief FrozenSearchType 열거형 값을 문자열로 변환하는 함수
+ * @param searchType 변환할 검색 방식(입력, FrozenSearchType 열거형 참고)
+ * @return 항상 변환된 문자열 반환
+ */
+static const char* _FrozenSearchTypeToString(FrozenSearchType searchType)
+{
+	switch(searchType)
+	{
+		case FrozenAVX2:
+			return "AVX2";
+		case FrozenSSE2:
+			return "SSE2";
+		default:
+			return "Scalar";
+	}
+}
@@ -0,0 +1,154 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/jrbtree.h"
+#include "../include/jrbtree_gen.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions of Benchmark
+////////////////////////////////////////////////////////////////////////////////
+
+// 기본 키 개수
+#define DEFAULT_KEY_COUNT 1000000
+
+// 정수 키 특화 RB Tree
+JRBTREE_DEFINE(IntSet, int, char, JRBTREE_CMP_NUM)
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static double _GetTime();
+static unsigned int _NextRandom(unsigned int *state);
+static void _Shuffle(int *array, int count, unsigned int *state);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Main Function
+/// 사용법: ./gen_bench [키 개수]
+/// 같은 키들을 범용 RB Tree(JRBTreeInsertNode/JRBTreeFindNodeByKey)와
+/// JRBTREE_DEFINE 으로 생성한 정수 키 특화 RB Tree 에 추가/검색/삭제해서 시간을 비교한다.
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char **argv)
+{
+	int keyCount = (argc > 1) ? atoi(argv[1]) : DEFAULT_KEY_COUNT;
+	if(keyCount <= 0) keyCount = DEFAULT_KEY_COUNT;
+
+	unsigned int state = 20211019;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)keyCount);
+	int *order = (int*)malloc(sizeof(int) * (size_t)keyCount);
+	if(keys == NULL || order == NULL) return -1;
+
+	int keyIndex = 0;
+	for( ; keyIndex < keyCount; keyIndex++)
+	{
+		keys[keyIndex] = keyIndex;
+		order[keyIndex] = keyIndex;
+	}
+	_Shuffle(keys, keyCount, &state);
+	_Shuffle(order, keyCount, &state);
+
+	// 범용 RB Tree
+	JRBTreePtr tree = NewJRBTree(IntType);
+	double startTime = _GetTime();
+	for(keyIndex = 0; keyIndex < keyCount; keyIndex++) JRBTreeInsertNode(tree, &keys[keyIndex]);
+	double treeInsertTime = _GetTime() - startTime;
+
+	// JRBTreeFindNodeByKey 는 키의 주소로 비교하므로 저장한 주소를 그대로 사용한다.
+	long treeFoundCount = 0;
+	startTime = _GetTime();
+	for(keyIndex = 0; keyIndex < keyCount; keyIndex++)
+	{
+		if(JRBTreeFindNodeByKey(tree, &keys[order[keyIndex]]) != NULL) treeFoundCount++;
+	}
+	double treeFindTime = _GetTime() - startTime;
+
+	startTime = _GetTime();
+	for(keyIndex = 0; keyIndex < keyCount; keyIndex++) JRBTreeDeleteNodeByKey(tree, &keys[order[keyIndex]]);
+	double treeDeleteTime = _GetTime() - startTime;
+	DeleteJRBTree(&tree);
+
+	// 특화 RB Tree
+	IntSetPtr set = NewIntSet();
+	startTime = _GetTime();
+	for(keyIndex = 0; keyIndex < keyCount; keyIndex++) IntSetInsert(set, keys[keyIndex], 0);
+	double genInsertTime = _GetTime() - startTime;
+
+	long genFoundCount = 0;
+	startTime = _GetTime();
+	for(keyIndex = 0; keyIndex < keyCount; keyIndex++)
+	{
+		if(IntSetFind(set, keys[order[keyIndex]]) != NULL) genFoundCount++;
+	}
+	double genFindTime = _GetTime() - startTime;
+
+	startTime = _GetTime();
+	for(keyIndex = 0; keyIndex < keyCount; keyIndex++) IntSetDelete(set, keys[order[keyIndex]]);
+	double genDeleteTime = _GetTime() - startTime;
+	DeleteIntSet(&set);
+
+	printf("keys              : %d\n", keyCount);
+	printf("                    %12s %12s %8s\n", "generic", "specialized", "speedup");
+	printf("insert (ns/op)    : %12.1f %12.1f %7.2fx\n", treeInsertTime * 1e9 / keyCount, genInsertTime * 1e9 / keyCount, treeInsertTime / genInsertTime);
+	printf("find (ns/op)      : %12.1f %12.1f %7.2fx\n", treeFindTime * 1e9 / keyCount, genFindTime * 1e9 / keyCount, treeFindTime / genFindTime);
+	printf("delete (ns/op)    : %12.1f %12.1f %7.2fx\n", treeDeleteTime * 1e9 / keyCount, genDeleteTime * 1e9 / keyCount, treeDeleteTime / genDeleteTime);
+	printf("found             : %12ld %12ld\n", treeFoundCount, genFoundCount);
+
+	free(order);
+	free(keys);
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static double _GetTime()
+ * @brief 단조 증가 시계의 현재 시간을 초 단위로 반환하는 함수
+ * @return 항상 현재 시간(초) 반환
+ */
+static double _GetTime()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/**
+ * @fn static unsigned int _NextRandom(unsigned int *state)
+ * @brief 재현 가능한 의사 난수를 생성하는 함수 (xorshift32)
+ * @param state 난수 상태(입력, 출력)
+ * @return 항상 다음 난수 반환
+ */
+static unsigned int _NextRandom(unsigned int *state)
+{
+	unsigned int x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+/**
+ * @fn static void _Shuffle(int *array, int count, unsigned int *state)
+ * @brief 배열을 무작위로 섞는 함수 (Fisher-Yates)
+ * @param array 섞을 배열(입력, 출력)
+ * @param count 배열 원소 개수(입력)
+ * @param state 난수 상태(입력, 출력)
+ * @return 반환값 없음
+ */
+static void _Shuffle(int *array, int count, unsigned int *state)
+{
+	int index = count - 1;
+	for( ; index > 0; index--)
+	{
+		int target = (int)(_NextRandom(state) % (unsigned int)(index + 1));
+		int temp = array[index];
+		array[index] = array[target];
+		array[target] = temp;
+	}
+}
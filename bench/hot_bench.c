@@ -0,0 +1,228 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "../include/jrbtree.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions of Benchmark
+////////////////////////////////////////////////////////////////////////////////
+
+// 키 개수를 지정하지 않은 경우 측정할 키 개수들 (캐시 안, L2/L3, 메모리)
+static const int defaultKeyCounts[] = { 1000, 100000, 1000000 };
+// 측정할 검색 횟수
+#define LOOKUP_COUNT 2000000
+// Zipf 분포의 지수 (값이 클수록 소수의 키에 검색이 몰린다)
+#define ZIPF_EXPONENT 0.99
+// 검색 캐시 칸 개수 (24 bytes * 4096 = 96KB)
+#define HOT_SLOT_COUNT 4096
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Benchmark Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static void MeasureLookups(JRBTreePtr tree, int **lookupKeys, long *latencies, double timerOverhead);
+static int CompareLatency(const void *left, const void *right);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static long _GetTimeNs();
+static unsigned int _NextRandom(unsigned int *state);
+static void _Shuffle(int *array, int count, unsigned int *state);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Main Function
+/// 사용법: ./hot_bench [키 개수]
+/// 정수 키 트리에서 Zipf(ZIPF_EXPONENT) 분포로 고른 키를 검색하면서
+/// 검색 캐시가 없는 경우(off)와 HOT_SLOT_COUNT 칸의 검색 캐시가 있는 경우(on)의
+/// 검색 한 번의 p50, p99 지연 시간과 평균 시간을 출력한다. (시계 호출 시간은 뺀다)
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char **argv)
+{
+	int sizeCount = (int)(sizeof(defaultKeyCounts) / sizeof(defaultKeyCounts[0]));
+	int argumentKeyCount = (argc > 1) ? atoi(argv[1]) : 0;
+	if(argumentKeyCount > 0) sizeCount = 1;
+
+	long *latencies = (long*)malloc(sizeof(long) * LOOKUP_COUNT);
+	int **lookupKeys = (int**)malloc(sizeof(int*) * LOOKUP_COUNT);
+	if(latencies == NULL || lookupKeys == NULL) return -1;
+
+	// 시계를 연속으로 두 번 읽은 차이의 중앙값을 시계 호출 시간으로 사용한다.
+	int lookupIndex = 0;
+	for( ; lookupIndex < LOOKUP_COUNT; lookupIndex++)
+	{
+		long startTime = _GetTimeNs();
+		latencies[lookupIndex] = _GetTimeNs() - startTime;
+	}
+	qsort(latencies, LOOKUP_COUNT, sizeof(long), CompareLatency);
+	double timerOverhead = (double)latencies[LOOKUP_COUNT / 2];
+
+	printf("%10s %6s %10s %10s %10s\n", "keys", "cache", "p50 ns", "p99 ns", "mean ns");
+
+	int sizeIndex = 0;
+	for( ; sizeIndex < sizeCount; sizeIndex++)
+	{
+		int keyCount = (argumentKeyCount > 0) ? argumentKeyCount : defaultKeyCounts[sizeIndex];
+		unsigned int state = 20211019;
+
+		int *keys = (int*)malloc(sizeof(int) * (size_t)keyCount);
+		int *rankToKey = (int*)malloc(sizeof(int) * (size_t)keyCount);
+		double *cumulative = (double*)malloc(sizeof(double) * (size_t)keyCount);
+		if(keys == NULL || rankToKey == NULL || cumulative == NULL) return -1;
+
+		JRBTreePtr tree = NewJRBTree(IntType);
+		int keyIndex = 0;
+		for( ; keyIndex < keyCount; keyIndex++)
+		{
+			keys[keyIndex] = keyIndex;
+			rankToKey[keyIndex] = keyIndex;
+		}
+		_Shuffle(keys, keyCount, &state);
+		for(keyIndex = 0; keyIndex < keyCount; keyIndex++) JRBTreeInsertNode(tree, &keys[keyIndex]);
+
+		// 자주 검색하는 키가 트리에서 모여 있지 않도록 순위마다 무작위 키를 정한다.
+		_Shuffle(rankToKey, keyCount, &state);
+		double total = 0.0;
+		for(keyIndex = 0; keyIndex < keyCount; keyIndex++)
+		{
+			total += 1.0 / pow((double)(keyIndex + 1), ZIPF_EXPONENT);
+			cumulative[keyIndex] = total;
+		}
+
+		for(lookupIndex = 0; lookupIndex < LOOKUP_COUNT; lookupIndex++)
+		{
+			double target = (double)_NextRandom(&state) / 4294967296.0 * total;
+			int low = 0;
+			int high = keyCount - 1;
+			while(low < high)
+			{
+				int middle = (low + high) / 2;
+				if(cumulative[middle] < target) low = middle + 1;
+				else high = middle;
+			}
+			lookupKeys[lookupIndex] = &keys[rankToKey[low]];
+		}
+
+		int mode = 0;
+		for( ; mode < 2; mode++)
+		{
+			if(JRBTreeSetHotCache(tree, (mode == 0) ? 0 : HOT_SLOT_COUNT) == NULL) return -1;
+
+			MeasureLookups(tree, lookupKeys, latencies, timerOverhead);
+			double sum = 0.0;
+			for(lookupIndex = 0; lookupIndex < LOOKUP_COUNT; lookupIndex++) sum += (double)latencies[lookupIndex];
+			qsort(latencies, LOOKUP_COUNT, sizeof(long), CompareLatency);
+
+			printf("%10d %6s %10ld %10ld %10.1f\n", keyCount, (mode == 0) ? "off" : "on",
+				latencies[LOOKUP_COUNT / 2], latencies[LOOKUP_COUNT / 100 * 99], sum / LOOKUP_COUNT);
+		}
+
+		DeleteJRBTree(&tree);
+		free(cumulative);
+		free(rankToKey);
+		free(keys);
+	}
+
+	free(lookupKeys);
+	free(latencies);
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Benchmark Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void MeasureLookups(JRBTreePtr tree, int **lookupKeys, long *latencies, double timerOverhead)
+ * @brief 검색 키 배열 순서로 검색하면서 검색 한 번마다 시간을 측정하는 함수
+ * 처음 LOOKUP_COUNT / 10 번은 캐시를 채우는 데 사용하고 측정 결과를 덮어쓴다.
+ * @param tree 검색할 RB Tree(입력)
+ * @param lookupKeys 검색할 키 주소 배열, LOOKUP_COUNT 개(입력)
+ * @param latencies 검색 한 번의 시간 배열, LOOKUP_COUNT 개(출력, ns, 0 미만이면 0)
+ * @param timerOverhead 시계 호출 시간(입력, ns)
+ * @return 반환값 없음
+ */
+static void MeasureLookups(JRBTreePtr tree, int **lookupKeys, long *latencies, double timerOverhead)
+{
+	int lookupIndex = 0;
+	for( ; lookupIndex < LOOKUP_COUNT / 10; lookupIndex++) JRBTreeFindNodeByKey(tree, lookupKeys[lookupIndex]);
+
+	for(lookupIndex = 0; lookupIndex < LOOKUP_COUNT; lookupIndex++)
+	{
+		long startTime = _GetTimeNs();
+		if(JRBTreeFindNodeByKey(tree, lookupKeys[lookupIndex]) == NULL) exit(-1);
+		long latency = (long)((double)(_GetTimeNs() - startTime) - timerOverhead);
+		latencies[lookupIndex] = (latency > 0) ? latency : 0;
+	}
+}
+
+/**
+ * @fn static int CompareLatency(const void *left, const void *right)
+ * @brief qsort 에 사용하는 지연 시간 비교 함수
+ * @param left 비교할 지연 시간의 주소(입력, 읽기 전용)
+ * @param right 비교할 지연 시간의 주소(입력, 읽기 전용)
+ * @return left 가 작으면 음수, 같으면 0, 크면 양수 반환
+ */
+static int CompareLatency(const void *left, const void *right)
+{
+	long leftValue = *((const long*)left);
+	long rightValue = *((const long*)right);
+	return (leftValue > rightValue) - (leftValue < rightValue);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static long _GetTimeNs()
+ * @brief 단조 증가 시계의 현재 시간을 ns 단위로 반환하는 함수
+ * @return 항상 현재 시간(ns) 반환
+ */
+static long _GetTimeNs()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (long)now.tv_sec * 1000000000L + now.tv_nsec;
+}
+
+/**
+ * @fn static unsigned int _NextRandom(unsigned int *state)
+ * @brief 재현 가능한 의사 난수를 생성하는 함수 (xorshift32)
+ * @param state 난수 상태(입력, 출력)
+ * @return 항상 다음 난수 반환
+ */
+static unsigned int _NextRandom(unsigned int *state)
+{
+	unsigned int x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+/**
+ * @fn static void _Shuffle(int *array, int count, unsigned int *state)
+ * @brief 배열을 무작위로 섞는 함수 (Fisher-Yates)
+ * @param array 섞을 배열(입력, 출력)
+ * @param count 배열 원소 개수(입력)
+ * @param state 난수 상태(입력, 출력)
+ * @return 반환값 없음
+ */
+static void _Shuffle(int *array, int count, unsigned int *state)
+{
+	int index = count - 1;
+	for( ; index > 0; index--)
+	{
+		int target = (int)(_NextRandom(state) % (unsigned int)(index + 1));
+		int temp = array[index];
+		array[index] = array[target];
+		array[target] = temp;
+	}
+}
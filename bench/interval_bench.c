@@ -0,0 +1,136 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../include/jrbtree.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions of Benchmark
+////////////////////////////////////////////////////////////////////////////////
+
+// 구간 개수를 지정하지 않은 경우 측정할 구간 개수들
+static const int defaultIntervalCounts[] = { 1000, 100000, 1000000 };
+// 구간 개수와 상관없이 측정할 검색 횟수 (전체 확인은 느리므로 SCAN_COUNT 번만 측정)
+#define QUERY_COUNT 200000
+#define SCAN_COUNT 200
+// 구간의 최대 길이 (시작점은 구간 개수 * 10 범위에 고르게 분포)
+#define MAX_LENGTH 100
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static double _GetTime();
+static unsigned int _NextRandom(unsigned int *state);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Main Function
+/// 사용법: ./interval_bench [구간 개수]
+/// 무작위 구간을 저장한 구간 트리(NewJRBTreeInterval)에서 무작위 점을 포함하는 구간을 찾을 때
+/// 모든 노드를 순회하면서 확인한 경우(scan)와 JRBTreeIntervalStab 으로 검색한 경우(stab)의
+/// 검색 한 번의 평균 시간과 평균 결과 개수, 구간 한 개 추가의 평균 시간을 출력한다.
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char **argv)
+{
+	int sizeCount = (int)(sizeof(defaultIntervalCounts) / sizeof(defaultIntervalCounts[0]));
+	int argumentCount = (argc > 1) ? atoi(argv[1]) : 0;
+	if(argumentCount > 0) sizeCount = 1;
+
+	printf("%10s %12s %12s %12s %10s\n", "intervals", "insert ns", "scan ns", "stab ns", "results");
+
+	int sizeIndex = 0;
+	for( ; sizeIndex < sizeCount; sizeIndex++)
+	{
+		int intervalCount = (argumentCount > 0) ? argumentCount : defaultIntervalCounts[sizeIndex];
+		unsigned int state = 20211019;
+
+		JRBTreeIntervalPtr intervals = (JRBTreeIntervalPtr)malloc(sizeof(JRBTreeInterval) * (size_t)intervalCount);
+		JNodePtr *nodes = (JNodePtr*)malloc(sizeof(JNodePtr) * (size_t)intervalCount);
+		if(intervals == NULL || nodes == NULL) return -1;
+
+		int intervalIndex = 0;
+		for( ; intervalIndex < intervalCount; intervalIndex++)
+		{
+			intervals[intervalIndex].low = (int)(_NextRandom(&state) % (unsigned int)(intervalCount * 10));
+			intervals[intervalIndex].high = intervals[intervalIndex].low + (int)(_NextRandom(&state) % MAX_LENGTH);
+		}
+
+		JRBTreePtr tree = NewJRBTreeInterval();
+		if(tree == NULL) return -1;
+
+		double startTime = _GetTime();
+		for(intervalIndex = 0; intervalIndex < intervalCount; intervalIndex++)
+		{
+			if(JRBTreeInsertNode(tree, &intervals[intervalIndex]) == NULL) return -1;
+		}
+		double insertNs = (_GetTime() - startTime) * 1e9 / intervalCount;
+
+		// 시작점 순서로 순회하다가 시작점이 점보다 크면 멈춘다.
+		long scanFound = 0;
+		startTime = _GetTime();
+		int queryIndex = 0;
+		for( ; queryIndex < SCAN_COUNT; queryIndex++)
+		{
+			int point = (int)(_NextRandom(&state) % (unsigned int)(intervalCount * 10));
+			JNodePtr node = JRBTreeMin(tree);
+			for( ; node != NULL; node = JNodeGetNext(node))
+			{
+				JRBTreeIntervalPtr interval = (JRBTreeIntervalPtr)JNodeGetKey(node);
+				if(interval->low > point) break;
+				if(interval->high >= point) scanFound++;
+			}
+		}
+		double scanNs = (_GetTime() - startTime) * 1e9 / SCAN_COUNT;
+
+		long found = 0;
+		startTime = _GetTime();
+		for(queryIndex = 0; queryIndex < QUERY_COUNT; queryIndex++)
+		{
+			int point = (int)(_NextRandom(&state) % (unsigned int)(intervalCount * 10));
+			found += (long)JRBTreeIntervalStab(tree, point, nodes, (size_t)intervalCount);
+		}
+		double stabNs = (_GetTime() - startTime) * 1e9 / QUERY_COUNT;
+
+		printf("%10d %12.1f %12.1f %12.1f %10.2f\n", intervalCount, insertNs, scanNs, stabNs, (double)found / QUERY_COUNT);
+
+		DeleteJRBTree(&tree);
+		free(nodes);
+		free(intervals);
+	}
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static double _GetTime()
+ * @brief 단조 증가 시계의 현재 시간을 초 단위로 반환하는 함수
+ * @return 항상 현재 시간(초) 반환
+ */
+static double _GetTime()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/**
+ * @fn static unsigned int _NextRandom(unsigned int *state)
+ * @brief 재현 가능한 의사 난수를 생성하는 함수 (xorshift32)
+ * @param state 난수 상태(입력, 출력)
+ * @return 항상 다음 난수 반환
+ */
+static unsigned int _NextRandom(unsigned int *state)
+{
+	unsigned int x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
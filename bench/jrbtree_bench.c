@@ -0,0 +1,710 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../include/jrbtree.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions of Benchmark
+////////////////////////////////////////////////////////////////////////////////
+
+// 기본 키 개수 목록
+#define DEFAULT_SIZES "1000,100000,1000000"
+// 기본 난수 seed
+#define DEFAULT_SEED 20211019u
+// 측정 항목 하나에서 저장하는 지연 시간 표본의 최대 개수
+#define MAX_SAMPLE_COUNT (1 << 20)
+// 검색 실패용 키 개수 (키 개수보다 많으면 반복해서 사용)
+#define MISS_KEY_COUNT (1 << 20)
+// 범위 순회 한 번에 방문하는 노드 개수
+#define SCAN_LENGTH 100
+// 문자열 키 하나의 크기 ("k" + 11 자리 숫자 + 널 문자, 16 bytes 정렬)
+#define STRING_KEY_SIZE 16
+// Zipfian 분포 지수 (YCSB 기본값)
+#define ZIPF_THETA 0.99
+
+// 키 생성 방식 열거형
+typedef enum BenchWorkload
+{
+	// 무작위 순서의 정수 키
+	BenchRandom = 0,
+	// 오름차순 정수 키
+	BenchSequential,
+	// 무작위 순서의 정수 키, 검색은 Zipfian 분포
+	BenchZipf,
+	// 무작위 순서의 문자열 키
+	BenchString,
+	// 키 생성 방식 개수
+	BenchWorkloadCount
+} BenchWorkload;
+
+// 출력 형식 열거형
+typedef enum BenchFormat
+{
+	// 쉼표로 구분한 값
+	BenchCSV = 1,
+	// JSON 배열
+	BenchJSON
+} BenchFormat;
+
+// 벤치마크 실행 정보 구조체
+typedef struct _bench_t {
+	// 출력 형식
+	BenchFormat format;
+	// 빌드 구분용 이름 (결과 비교용)
+	const char *label;
+	// 난수 상태
+	unsigned int state;
+	// 출력한 결과 개수 (JSON 구분자 출력용)
+	int rowCount;
+
+	// 키 개수
+	int keyCount;
+	// 저장할 키 주소 배열
+	void **keys;
+	// 검색 실패용 키 주소 배열
+	void **missKeys;
+	// 검색 순서 (keys 의 인덱스)
+	int *order;
+	// 정수 키 저장 공간
+	int *intKeys;
+	// 문자열 키 저장 공간
+	char *stringKeys;
+
+	// 지연 시간 표본 (ns)
+	long long *samples;
+	// 저장한 표본 개수
+	int sampleCount;
+	// 표본을 측정하는 간격 (연산 sampleStride 번마다 한 번)
+	int sampleStride;
+} Bench, *BenchPtr;
+
+// 측정 결과 구조체
+typedef struct _bench_result_t {
+	// 키 생성 방식 이름
+	const char *workload;
+	// 연산 이름
+	const char *operation;
+	// 키 개수
+	int size;
+	// 연산 횟수
+	long long ops;
+	// 전체 시간 (초)
+	double seconds;
+} BenchResult, *BenchResultPtr;
+
+// 연산 하나를 실행하면서 sampleStride 번마다 지연 시간을 표본으로 저장한다.
+#define BENCH_OP(bench, index, statement) \
+	if(((index) % (bench)->sampleStride) == 0) \
+	{ \
+		long long _opStart = _GetNanoTime(); \
+		statement; \
+		_AddSample((bench), _GetNanoTime() - _opStart); \
+	} \
+	else { statement; }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Bench Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int BenchPrepare(BenchPtr bench, BenchWorkload workload, int keyCount);
+static void BenchRelease(BenchPtr bench);
+static void BenchRun(BenchPtr bench, BenchWorkload workload);
+static void BenchBeginSamples(BenchPtr bench, long long ops);
+static void BenchReport(BenchPtr bench, const BenchResultPtr result);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static long long _GetNanoTime();
+static long _GetRSS();
+static unsigned int _NextRandom(unsigned int *state);
+static void _Shuffle(int *array, int count, unsigned int *state);
+static void _FillZipfOrder(int *order, int count, unsigned int *state);
+static void _AddSample(BenchPtr bench, long long sample);
+static int _CompareSample(const void *a, const void *b);
+static long long _GetPercentile(const long long *samples, int count, double percentile);
+static const char* _BenchWorkloadToString(BenchWorkload workload);
+static void _PrintUsage(const char *name);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Main Function
+/// 사용법: ./jrbtree_bench [-n 키 개수 목록] [-w 키 생성 방식] [-f csv|json] [-s seed] [-l 이름]
+/// 예) ./jrbtree_bench -n 1000,1000000,100000000 -w random -f json -l O2
+/// 키 생성 방식별로 추가, 검색(성공/실패), 범위 순회, 삭제 후 재추가, 삭제, 전체 삭제를 측정해서
+/// 처리량(ops/sec), 지연 시간(p50/p99/p999), RSS 를 CSV 또는 JSON 으로 출력한다.
+/// 같은 seed 로 실행하면 항상 같은 키와 순서를 사용하므로 빌드끼리 결과를 비교할 수 있다.
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char **argv)
+{
+	Bench bench;
+	memset(&bench, 0, sizeof(Bench));
+	bench.format = BenchCSV;
+	bench.label = "default";
+
+	const char *sizes = DEFAULT_SIZES;
+	const char *workloadName = "all";
+	unsigned int seed = DEFAULT_SEED;
+
+	int option = 0;
+	while((option = getopt(argc, argv, "n:w:f:s:l:h")) != -1)
+	{
+		switch(option)
+		{
+			case 'n': sizes = optarg; break;
+			case 'w': workloadName = optarg; break;
+			case 'f':
+				if(strcmp(optarg, "csv") == 0) bench.format = BenchCSV;
+				else if(strcmp(optarg, "json") == 0) bench.format = BenchJSON;
+				else { _PrintUsage(argv[0]); return -1; }
+				break;
+			case 's': seed = (unsigned int)strtoul(optarg, NULL, 10); break;
+			case 'l': bench.label = optarg; break;
+			default: _PrintUsage(argv[0]); return -1;
+		}
+	}
+
+	int workloadIndex = 0;
+	int selectedCount = 0;
+	for( ; workloadIndex < BenchWorkloadCount; workloadIndex++)
+	{
+		if(strcmp(workloadName, "all") == 0 || strcmp(workloadName, _BenchWorkloadToString((BenchWorkload)workloadIndex)) == 0) selectedCount++;
+	}
+	if(selectedCount == 0) { _PrintUsage(argv[0]); return -1; }
+
+	bench.samples = (long long*)malloc(sizeof(long long) * MAX_SAMPLE_COUNT);
+	if(bench.samples == NULL) return -1;
+
+	if(bench.format == BenchCSV) printf("label,workload,operation,size,ops,seconds,ops_per_sec,p50_ns,p99_ns,p999_ns,rss_kb\n");
+	else printf("[\n");
+
+	const char *sizeText = sizes;
+	while(*sizeText != '\0')
+	{
+		char *sizeEnd = NULL;
+		long keyCount = strtol(sizeText, &sizeEnd, 10);
+		if(sizeEnd == sizeText || keyCount <= 0 || keyCount > 1000000000L)
+		{
+			fprintf(stderr, "invalid size: %s\n", sizeText);
+			break;
+		}
+
+		for(workloadIndex = 0; workloadIndex < BenchWorkloadCount; workloadIndex++)
+		{
+			BenchWorkload workload = (BenchWorkload)workloadIndex;
+			if(strcmp(workloadName, "all") != 0 && strcmp(workloadName, _BenchWorkloadToString(workload)) != 0) continue;
+
+			// 키 개수와 키 생성 방식마다 seed 를 다시 설정해서 실행 순서와 상관없이 같은 키를 만든다.
+			bench.state = seed + (unsigned int)keyCount * 31u + (unsigned int)workloadIndex;
+			if(BenchPrepare(&bench, workload, (int)keyCount) == 0)
+			{
+				fprintf(stderr, "out of memory: %ld keys\n", keyCount);
+				BenchRelease(&bench);
+				continue;
+			}
+			BenchRun(&bench, workload);
+			BenchRelease(&bench);
+		}
+
+		sizeText = (*sizeEnd == ',') ? sizeEnd + 1 : sizeEnd;
+	}
+
+	if(bench.format == BenchJSON) printf("\n]\n");
+
+	free(bench.samples);
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Bench Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int BenchPrepare(BenchPtr bench, BenchWorkload workload, int keyCount)
+ * @brief 키 생성 방식에 맞게 저장할 키, 검색 실패용 키, 검색 순서를 만드는 함수
+ * 저장할 키는 모두 짝수, 검색 실패용 키는 모두 홀수라서 서로 겹치지 않는다.
+ * @param bench 벤치마크 실행 정보 구조체 객체의 주소(입력, 출력)
+ * @param workload 키 생성 방식(입력)
+ * @param keyCount 키 개수(입력)
+ * @return 성공 시 1, 메모리 할당 실패 시 0 반환
+ */
+static int BenchPrepare(BenchPtr bench, BenchWorkload workload, int keyCount)
+{
+	int missCount = (keyCount < MISS_KEY_COUNT) ? keyCount : MISS_KEY_COUNT;
+	int keyIndex = 0;
+
+	bench->keyCount = keyCount;
+	bench->keys = (void**)malloc(sizeof(void*) * (size_t)keyCount);
+	bench->missKeys = (void**)malloc(sizeof(void*) * (size_t)missCount);
+	bench->order = (int*)malloc(sizeof(int) * (size_t)keyCount);
+	if(bench->keys == NULL || bench->missKeys == NULL || bench->order == NULL) return 0;
+
+	// 키 값 순서 (무작위 또는 오름차순)
+	int *values = (int*)malloc(sizeof(int) * (size_t)keyCount);
+	if(values == NULL) return 0;
+	for(keyIndex = 0; keyIndex < keyCount; keyIndex++) values[keyIndex] = keyIndex;
+	if(workload != BenchSequential) _Shuffle(values, keyCount, &(bench->state));
+
+	if(workload == BenchString)
+	{
+		bench->stringKeys = (char*)malloc(STRING_KEY_SIZE * ((size_t)keyCount + (size_t)missCount));
+		if(bench->stringKeys == NULL)
+		{
+			free(values);
+			return 0;
+		}
+
+		// 길이가 같은 문자열이므로 사전 순서와 숫자 순서가 같다.
+		for(keyIndex = 0; keyIndex < keyCount; keyIndex++)
+		{
+			char *key = bench->stringKeys + (size_t)keyIndex * STRING_KEY_SIZE;
+			snprintf(key, STRING_KEY_SIZE, "k%011u", (unsigned int)values[keyIndex] * 2u);
+			bench->keys[keyIndex] = key;
+		}
+		for(keyIndex = 0; keyIndex < missCount; keyIndex++)
+		{
+			char *key = bench->stringKeys + ((size_t)keyCount + (size_t)keyIndex) * STRING_KEY_SIZE;
+			snprintf(key, STRING_KEY_SIZE, "k%011u", (unsigned int)(_NextRandom(&(bench->state)) % (unsigned int)keyCount) * 2u + 1u);
+			bench->missKeys[keyIndex] = key;
+		}
+	}
+	else
+	{
+		bench->intKeys = (int*)malloc(sizeof(int) * ((size_t)keyCount + (size_t)missCount));
+		if(bench->intKeys == NULL)
+		{
+			free(values);
+			return 0;
+		}
+
+		for(keyIndex = 0; keyIndex < keyCount; keyIndex++)
+		{
+			bench->intKeys[keyIndex] = values[keyIndex] * 2;
+			bench->keys[keyIndex] = &(bench->intKeys[keyIndex]);
+		}
+		for(keyIndex = 0; keyIndex < missCount; keyIndex++)
+		{
+			int *key = &(bench->intKeys[keyCount + keyIndex]);
+			*key = (int)(_NextRandom(&(bench->state)) % (unsigned int)keyCount) * 2 + 1;
+			bench->missKeys[keyIndex] = key;
+		}
+	}
+	free(values);
+
+	// 검색 순서 (Zipfian 이면 일부 키에 검색이 몰린다.)
+	if(workload == BenchZipf) _FillZipfOrder(bench->order, keyCount, &(bench->state));
+	else
+	{
+		for(keyIndex = 0; keyIndex < keyCount; keyIndex++) bench->order[keyIndex] = keyIndex;
+		_Shuffle(bench->order, keyCount, &(bench->state));
+	}
+
+	return 1;
+}
+
+/**
+ * @fn static void BenchRelease(BenchPtr bench)
+ * @brief BenchPrepare 함수에서 할당한 메모리를 해제하는 함수
+ * @param bench 벤치마크 실행 정보 구조체 객체의 주소(입력, 출력)
+ * @return 반환값 없음
+ */
+static void BenchRelease(BenchPtr bench)
+{
+	free(bench->keys);
+	free(bench->missKeys);
+	free(bench->order);
+	free(bench->intKeys);
+	free(bench->stringKeys);
+
+	bench->keys = NULL;
+	bench->missKeys = NULL;
+	bench->order = NULL;
+	bench->intKeys = NULL;
+	bench->stringKeys = NULL;
+	bench->keyCount = 0;
+}
+
+/**
+ * @fn static void BenchRun(BenchPtr bench, BenchWorkload workload)
+ * @brief 준비된 키로 RB Tree 연산들을 순서대로 측정하고 결과를 출력하는 함수
+ * 측정 순서: insert, lookup_hit, lookup_miss, range_scan, churn, delete, teardown
+ * delete 는 키의 절반을 삭제하고, teardown 은 남은 절반을 DeleteJRBTree 로 한 번에 해제한다.
+ * @param bench 벤치마크 실행 정보 구조체 객체의 주소(입력)
+ * @param workload 키 생성 방식(입력)
+ * @return 반환값 없음
+ */
+static void BenchRun(BenchPtr bench, BenchWorkload workload)
+{
+	int keyCount = bench->keyCount;
+	int missCount = (keyCount < MISS_KEY_COUNT) ? keyCount : MISS_KEY_COUNT;
+	int opIndex = 0;
+	long long startTime = 0;
+	volatile long checksum = 0;
+
+	BenchResult result;
+	result.workload = _BenchWorkloadToString(workload);
+	result.size = keyCount;
+
+	JRBTreePtr tree = NewJRBTree((workload == BenchString) ? StringType : IntType);
+	if(tree == NULL) return;
+
+	// 추가 (키 생성 순서대로)
+	BenchBeginSamples(bench, keyCount);
+	startTime = _GetNanoTime();
+	for(opIndex = 0; opIndex < keyCount; opIndex++)
+	{
+		BENCH_OP(bench, opIndex, JRBTreeInsertNode(tree, bench->keys[opIndex]));
+	}
+	result.operation = "insert";
+	result.ops = keyCount;
+	result.seconds = (double)(_GetNanoTime() - startTime) * 1e-9;
+	BenchReport(bench, &result);
+
+	// 검색 성공 (JRBTreeFindNodeByKey 는 키의 주소로 비교하므로 저장한 주소를 그대로 사용한다.)
+	BenchBeginSamples(bench, keyCount);
+	startTime = _GetNanoTime();
+	for(opIndex = 0; opIndex < keyCount; opIndex++)
+	{
+		BENCH_OP(bench, opIndex, checksum += (JRBTreeFindNodeByKey(tree, bench->keys[bench->order[opIndex]]) != NULL));
+	}
+	result.operation = "lookup_hit";
+	result.ops = keyCount;
+	result.seconds = (double)(_GetNanoTime() - startTime) * 1e-9;
+	BenchReport(bench, &result);
+
+	// 검색 실패
+	BenchBeginSamples(bench, keyCount);
+	startTime = _GetNanoTime();
+	for(opIndex = 0; opIndex < keyCount; opIndex++)
+	{
+		BENCH_OP(bench, opIndex, checksum += (JRBTreeFindNodeByKey(tree, bench->missKeys[opIndex % missCount]) == NULL));
+	}
+	result.operation = "lookup_miss";
+	result.ops = keyCount;
+	result.seconds = (double)(_GetNanoTime() - startTime) * 1e-9;
+	BenchReport(bench, &result);
+
+	// 범위 순회 (시작 노드를 검색한 후 SCAN_LENGTH 개의 노드를 정렬 순서로 방문)
+	int scanCount = (keyCount / SCAN_LENGTH > 0) ? keyCount / SCAN_LENGTH : 1;
+	BenchBeginSamples(bench, scanCount);
+	startTime = _GetNanoTime();
+	for(opIndex = 0; opIndex < scanCount; opIndex++)
+	{
+		BENCH_OP(bench, opIndex,
+		{
+			JNodePtr scanNode = JRBTreeFindNodeByKey(tree, bench->keys[bench->order[opIndex]]);
+			int scanIndex = 0;
+			for( ; (scanNode != NULL) && (scanIndex < SCAN_LENGTH); scanIndex++) scanNode = JNodeGetNext(scanNode);
+			checksum += scanIndex;
+		});
+	}
+	result.operation = "range_scan";
+	result.ops = scanCount;
+	result.seconds = (double)(_GetNanoTime() - startTime) * 1e-9;
+	BenchReport(bench, &result);
+
+	// 삭제 후 재추가 (노드 개수는 그대로 유지)
+	BenchBeginSamples(bench, keyCount);
+	startTime = _GetNanoTime();
+	for(opIndex = 0; opIndex < keyCount; opIndex++)
+	{
+		BENCH_OP(bench, opIndex,
+		{
+			void *key = bench->keys[bench->order[opIndex]];
+			JRBTreeDeleteNodeByKey(tree, key);
+			JRBTreeInsertNode(tree, key);
+		});
+	}
+	result.operation = "churn";
+	result.ops = keyCount;
+	result.seconds = (double)(_GetNanoTime() - startTime) * 1e-9;
+	BenchReport(bench, &result);
+
+	// 삭제 (절반, 무작위 순서)
+	int deleteCount = keyCount / 2;
+	int *deleteOrder = (int*)malloc(sizeof(int) * (size_t)keyCount);
+	if(deleteOrder != NULL)
+	{
+		for(opIndex = 0; opIndex < keyCount; opIndex++) deleteOrder[opIndex] = opIndex;
+		_Shuffle(deleteOrder, keyCount, &(bench->state));
+
+		BenchBeginSamples(bench, deleteCount);
+		startTime = _GetNanoTime();
+		for(opIndex = 0; opIndex < deleteCount; opIndex++)
+		{
+			BENCH_OP(bench, opIndex, JRBTreeDeleteNodeByKey(tree, bench->keys[deleteOrder[opIndex]]));
+		}
+		result.operation = "delete";
+		result.ops = deleteCount;
+		result.seconds = (double)(_GetNanoTime() - startTime) * 1e-9;
+		BenchReport(bench, &result);
+		free(deleteOrder);
+	}
+
+	// 전체 삭제 (지연 시간은 DeleteJRBTree 한 번의 시간)
+	result.operation = "teardown";
+	result.ops = (long long)JRBTreeSize(tree);
+	BenchBeginSamples(bench, 1);
+	startTime = _GetNanoTime();
+	BENCH_OP(bench, 0, DeleteJRBTree(&tree));
+	result.seconds = (double)(_GetNanoTime() - startTime) * 1e-9;
+	BenchReport(bench, &result);
+
+	if(checksum < 0) fprintf(stderr, "unexpected checksum\n");
+}
+
+/**
+ * @fn static void BenchBeginSamples(BenchPtr bench, long long ops)
+ * @brief 측정 항목 하나를 시작하기 전에 표본 버퍼를 비우고 측정 간격을 정하는 함수
+ * 연산이 많으면 MAX_SAMPLE_COUNT 개 이하가 되도록 일정 간격으로만 측정한다.
+ * @param bench 벤치마크 실행 정보 구조체 객체의 주소(출력)
+ * @param ops 측정할 연산 횟수(입력)
+ * @return 반환값 없음
+ */
+static void BenchBeginSamples(BenchPtr bench, long long ops)
+{
+	bench->sampleCount = 0;
+	bench->sampleStride = (int)((ops + MAX_SAMPLE_COUNT - 1) / MAX_SAMPLE_COUNT);
+	if(bench->sampleStride <= 0) bench->sampleStride = 1;
+}
+
+/**
+ * @fn static void BenchReport(BenchPtr bench, const BenchResultPtr result)
+ * @brief 측정 결과와 지연 시간 백분위수, 현재 RSS 를 지정한 형식으로 출력하는 함수
+ * @param bench 벤치마크 실행 정보 구조체 객체의 주소(입력, 표본 정렬)
+ * @param result 측정 결과 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void BenchReport(BenchPtr bench, const BenchResultPtr result)
+{
+	qsort(bench->samples, (size_t)bench->sampleCount, sizeof(long long), _CompareSample);
+
+	double opsPerSec = (result->seconds > 0.0) ? (double)result->ops / result->seconds : 0.0;
+	long long p50 = _GetPercentile(bench->samples, bench->sampleCount, 0.50);
+	long long p99 = _GetPercentile(bench->samples, bench->sampleCount, 0.99);
+	long long p999 = _GetPercentile(bench->samples, bench->sampleCount, 0.999);
+	long rss = _GetRSS();
+
+	if(bench->format == BenchCSV)
+	{
+		printf("%s,%s,%s,%d,%lld,%.6f,%.0f,%lld,%lld,%lld,%ld\n",
+			bench->label, result->workload, result->operation, result->size, result->ops,
+			result->seconds, opsPerSec, p50, p99, p999, rss);
+	}
+	else
+	{
+		printf("%s  {\"label\": \"%s\", \"workload\": \"%s\", \"operation\": \"%s\", \"size\": %d, \"ops\": %lld, "
+			"\"seconds\": %.6f, \"ops_per_sec\": %.0f, \"p50_ns\": %lld, \"p99_ns\": %lld, \"p999_ns\": %lld, \"rss_kb\": %ld}",
+			(bench->rowCount > 0) ? ",\n" : "", bench->label, result->workload, result->operation, result->size, result->ops,
+			result->seconds, opsPerSec, p50, p99, p999, rss);
+	}
+
+	fflush(stdout);
+	bench->rowCount++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static long long _GetNanoTime()
+ * @brief 단조 증가 시계의 현재 시간을 ns 단위로 반환하는 함수
+ * @return 항상 현재 시간(ns) 반환
+ */
+static long long _GetNanoTime()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (long long)now.tv_sec * 1000000000LL + (long long)now.tv_nsec;
+}
+
+/**
+ * @fn static long _GetRSS()
+ * @brief 현재 프로세스의 RSS(Resident Set Size)를 KB 단위로 반환하는 함수
+ * @return 성공 시 RSS(KB), 실패 시 -1 반환
+ */
+static long _GetRSS()
+{
+	FILE *fp = fopen("/proc/self/statm", "r");
+	if(fp == NULL) return -1;
+
+	long totalPages = 0;
+	long residentPages = 0;
+	int readCount = fscanf(fp, "%ld %ld", &totalPages, &residentPages);
+	fclose(fp);
+	if(readCount != 2) return -1;
+
+	return residentPages * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+/**
+ * @fn static unsigned int _NextRandom(unsigned int *state)
+ * @brief 재현 가능한 의사 난수를 생성하는 함수 (xorshift32)
+ * @param state 난수 상태(입력, 출력)
+ * @return 항상 다음 난수 반환
+ */
+static unsigned int _NextRandom(unsigned int *state)
+{
+	unsigned int x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+/**
+ * @fn static void _Shuffle(int *array, int count, unsigned int *state)
+ * @brief 배열을 무작위로 섞는 함수 (Fisher-Yates)
+ * @param array 섞을 배열(입력, 출력)
+ * @param count 배열 원소 개수(입력)
+ * @param state 난수 상태(입력, 출력)
+ * @return 반환값 없음
+ */
+static void _Shuffle(int *array, int count, unsigned int *state)
+{
+	int index = count - 1;
+	for( ; index > 0; index--)
+	{
+		int target = (int)(_NextRandom(state) % (unsigned int)(index + 1));
+		int temp = array[index];
+		array[index] = array[target];
+		array[target] = temp;
+	}
+}
+
+/**
+ * @fn static void _FillZipfOrder(int *order, int count, unsigned int *state)
+ * @brief Zipfian 분포를 따르는 검색 순서를 만드는 함수
+ * Gray et al. 의 방법(YCSB ZipfianGenerator)으로 표본 하나를 O(1) 에 생성한다.
+ * 순위를 무작위 순열로 다시 매핑해서 자주 검색되는 키가 트리 전체에 흩어지게 한다.
+ * @param order 검색 순서를 저장할 배열(출력)
+ * @param count 키 개수(입력)
+ * @param state 난수 상태(입력, 출력)
+ * @return 반환값 없음
+ */
+static void _FillZipfOrder(int *order, int count, unsigned int *state)
+{
+	double zetaN = 0.0;
+	int index = 0;
+	for(index = 1; index <= count; index++) zetaN += 1.0 / pow((double)index, ZIPF_THETA);
+
+	double zeta2 = 1.0 + 1.0 / pow(2.0, ZIPF_THETA);
+	double alpha = 1.0 / (1.0 - ZIPF_THETA);
+	double eta = (1.0 - pow(2.0 / (double)count, 1.0 - ZIPF_THETA)) / (1.0 - zeta2 / zetaN);
+
+	// order 를 순위 -> 키 인덱스 매핑으로 먼저 사용한 후, 그 자리에 표본을 채운다.
+	int *rankToKey = (int*)malloc(sizeof(int) * (size_t)count);
+	if(rankToKey == NULL)
+	{
+		for(index = 0; index < count; index++) order[index] = index;
+		return;
+	}
+	for(index = 0; index < count; index++) rankToKey[index] = index;
+	_Shuffle(rankToKey, count, state);
+
+	for(index = 0; index < count; index++)
+	{
+		double u = (double)_NextRandom(state) / 4294967296.0;
+		double uz = u * zetaN;
+		int rank = 0;
+
+		if(uz < 1.0) rank = 0;
+		else if(uz < zeta2) rank = 1;
+		else rank = (int)((double)count * pow(eta * u - eta + 1.0, alpha));
+		if(rank >= count) rank = count - 1;
+
+		order[index] = rankToKey[rank];
+	}
+
+	free(rankToKey);
+}
+
+/**
+ * @fn static void _AddSample(BenchPtr bench, long long sample)
+ * @brief 지연 시간 표본을 저장하는 함수 (버퍼가 가득 차면 버림)
+ * @param bench 벤치마크 실행 정보 구조체 객체의 주소(출력)
+ * @param sample 지연 시간(ns)(입력)
+ * @return 반환값 없음
+ */
+static void _AddSample(BenchPtr bench, long long sample)
+{
+	if(bench->sampleCount < MAX_SAMPLE_COUNT) bench->samples[bench->sampleCount++] = sample;
+}
+
+/**
+ * @fn static int _CompareSample(const void *a, const void *b)
+ * @brief qsort 용 지연 시간 비교 함수
+ * @param a 비교할 표본 주소(입력)
+ * @param b 비교할 표본 주소(입력)
+ * @return a 가 작으면 음수, 같으면 0, 크면 양수 반환
+ */
+static int _CompareSample(const void *a, const void *b)
+{
+	long long left = *((const long long*)a);
+	long long right = *((const long long*)b);
+	return (left > right) - (left < right);
+}
+
+/**
+ * @fn static long long _GetPercentile(const long long *samples, int count, double percentile)
+ * @brief 정렬된 표본에서 지정한 백분위수를 반환하는 함수 (nearest-rank)
+ * @param samples 정렬된 표본 배열(입력, 읽기 전용)
+ * @param count 표본 개수(입력)
+ * @param percentile 백분위수, 0 ~ 1(입력)
+ * @return 성공 시 백분위수 값(ns), 표본이 없으면 0 반환
+ */
+static long long _GetPercentile(const long long *samples, int count, double percentile)
+{
+	if(count <= 0) return 0;
+
+	int index = (int)ceil(percentile * (double)count) - 1;
+	if(index < 0) index = 0;
+	if(index >= count) index = count - 1;
+	return samples[index];
+}
+
+/**
+ * @fn static const char* _BenchWorkloadToString(BenchWorkload workload)
+ * @brief BenchWorkload 열거형 값을 문자열로 변환하는 함수
+ * @param workload 변환할 키 생성 방식(입력, BenchWorkload 열거형 참고)
+ * @return 항상 변환된 문자열 반환
+ */
+static const char* _BenchWorkloadToString(BenchWorkload workload)
+{
+	switch(workload)
+	{
+		case BenchRandom:
+			return "random";
+		case BenchSequential:
+			return "sequential";
+		case BenchZipf:
+			return "zipf";
+		case BenchString:
+			return "string";
+		default:
+			return "unknown";
+	}
+}
+
+/**
+ * @fn static void _PrintUsage(const char *name)
+ * @brief 사용법을 출력하는 함수
+ * @param name 실행 파일 이름(입력)
+ * @return 반환값 없음
+ */
+static void _PrintUsage(const char *name)
+{
+	fprintf(stderr, "usage: %s [-n sizes] [-w workload] [-f csv|json] [-s seed] [-l label]\n", name);
+	fprintf(stderr, "  -n  comma separated key counts (default %s)\n", DEFAULT_SIZES);
+	fprintf(stderr, "  -w  all, random, sequential, zipf, string (default all)\n");
+	fprintf(stderr, "  -f  output format (default csv)\n");
+	fprintf(stderr, "  -s  random seed (default %u)\n", DEFAULT_SEED);
+	fprintf(stderr, "  -l  label written to every row to tell builds apart\n");
+}
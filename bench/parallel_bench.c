@@ -0,0 +1,203 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../include/jrbtree.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions of Benchmark
+////////////////////////////////////////////////////////////////////////////////
+
+// 키 개수를 지정하지 않은 경우 측정할 키 개수들
+static const int defaultKeyCounts[] = { 100000, 1000000, 4000000 };
+// 측정할 thread 개수들
+static const int threadCounts[] = { 1, 2, 4, 8 };
+// 조각별 합 배열 크기 (조각마다 캐시 라인 하나(8 칸)를 사용하며, 측정하는 thread 개수의 조각 개수보다 충분히 크게 잡는다)
+#define JRBTREE_BENCH_MAX_CHUNKS 4096
+// 조각 하나가 사용하는 칸 개수 (64 bytes / sizeof(long long))
+#define JRBTREE_BENCH_CHUNK_STRIDE 8
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Benchmark Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static void VisitSum(void *key, size_t chunk, void *ctx);
+static void ReduceSum(void *accumulator, void *key, void *ctx);
+static void MergeSum(void *accumulator, const void *chunkAccumulator, void *ctx);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static double _GetTime();
+static unsigned int _NextRandom(unsigned int *state);
+static void _Shuffle(int *array, int count, unsigned int *state);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Main Function
+/// 사용법: ./parallel_bench [키 개수]
+/// 무작위 순서로 추가한 정수 키 트리의 모든 키의 합을 JNodeGetNext 로 순회해서 계산한 경우(serial)와
+/// thread 개수별로 JRBTreeParallelForEach(foreach, 조각별 합), JRBTreeParallelReduce(reduce)로 계산한 경우의
+/// 키 한 개의 평균 시간을 출력한다.
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char **argv)
+{
+	int sizeCount = (int)(sizeof(defaultKeyCounts) / sizeof(defaultKeyCounts[0]));
+	int threadCountCount = (int)(sizeof(threadCounts) / sizeof(threadCounts[0]));
+	int argumentKeyCount = (argc > 1) ? atoi(argv[1]) : 0;
+	if(argumentKeyCount > 0) sizeCount = 1;
+
+	printf("%10s %8s %12s %12s\n", "keys", "threads", "foreach ns", "reduce ns");
+
+	int sizeIndex = 0;
+	for( ; sizeIndex < sizeCount; sizeIndex++)
+	{
+		int keyCount = (argumentKeyCount > 0) ? argumentKeyCount : defaultKeyCounts[sizeIndex];
+		unsigned int state = 20211019;
+
+		int *keys = (int*)malloc(sizeof(int) * (size_t)keyCount);
+		if(keys == NULL) return -1;
+
+		int keyIndex = 0;
+		for( ; keyIndex < keyCount; keyIndex++) keys[keyIndex] = keyIndex;
+		_Shuffle(keys, keyCount, &state);
+
+		JRBTreePtr tree = NewJRBTree(IntType);
+		if(tree == NULL) return -1;
+		for(keyIndex = 0; keyIndex < keyCount; keyIndex++) JRBTreeInsertNode(tree, &keys[keyIndex]);
+
+		long long expectedSum = 0;
+		double startTime = _GetTime();
+		JNodePtr node = JRBTreeMin(tree);
+		for( ; node != NULL; node = JNodeGetNext(node)) expectedSum += *((int*)JNodeGetKey(node));
+		printf("%10d %8s %12.2f %12s\n", keyCount, "serial", (_GetTime() - startTime) * 1e9 / keyCount, "-");
+
+		int threadIndex = 0;
+		for( ; threadIndex < threadCountCount; threadIndex++)
+		{
+			// 조각마다 합을 따로 저장하고 끝난 후에 더한다.
+			long long chunkSums[JRBTREE_BENCH_MAX_CHUNKS];
+			memset(chunkSums, 0, sizeof(chunkSums));
+			startTime = _GetTime();
+			if(JRBTreeParallelForEach(tree, VisitSum, chunkSums, threadCounts[threadIndex]) != (size_t)keyCount) return -1;
+			double forEachNs = (_GetTime() - startTime) * 1e9 / keyCount;
+
+			long long sum = 0;
+			int chunk = 0;
+			for( ; chunk < JRBTREE_BENCH_MAX_CHUNKS; chunk++) sum += chunkSums[chunk];
+			if(sum != expectedSum) return -1;
+
+			sum = 0;
+			startTime = _GetTime();
+			if(JRBTreeParallelReduce(tree, ReduceSum, MergeSum, NULL, threadCounts[threadIndex], sizeof(long long), &sum) == 0) return -1;
+			double reduceNs = (_GetTime() - startTime) * 1e9 / keyCount;
+			if(sum != expectedSum) return -1;
+
+			printf("%10d %8d %12.2f %12.2f\n", keyCount, threadCounts[threadIndex], forEachNs, reduceNs);
+		}
+
+		DeleteJRBTree(&tree);
+		free(keys);
+	}
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Benchmark Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void VisitSum(void *key, size_t chunk, void *ctx)
+ * @brief 조각별 합 배열에 키 값을 더하는 함수 (JRBTreeVisitFunc)
+ * @param key 키(입력)
+ * @param chunk 조각 번호(입력)
+ * @param ctx 조각별 합 배열, long long[JRBTREE_BENCH_MAX_CHUNKS](출력)
+ * @return 반환값 없음
+ */
+static void VisitSum(void *key, size_t chunk, void *ctx)
+{
+	((long long*)ctx)[(chunk * JRBTREE_BENCH_CHUNK_STRIDE) % JRBTREE_BENCH_MAX_CHUNKS] += *((int*)key);
+}
+
+/**
+ * @fn static void ReduceSum(void *accumulator, void *key, void *ctx)
+ * @brief 조각의 합에 키 값을 더하는 함수 (JRBTreeReduceFunc)
+ * @param accumulator 조각의 합, long long(입력, 출력)
+ * @param key 키(입력)
+ * @param ctx 사용하지 않음
+ * @return 반환값 없음
+ */
+static void ReduceSum(void *accumulator, void *key, void *ctx)
+{
+	(void)ctx;
+	*((long long*)accumulator) += *((int*)key);
+}
+
+/**
+ * @fn static void MergeSum(void *accumulator, const void *chunkAccumulator, void *ctx)
+ * @brief 전체 합에 조각의 합을 더하는 함수 (JRBTreeMergeFunc)
+ * @param accumulator 전체 합, long long(입력, 출력)
+ * @param chunkAccumulator 조각의 합, long long(입력, 읽기 전용)
+ * @param ctx 사용하지 않음
+ * @return 반환값 없음
+ */
+static void MergeSum(void *accumulator, const void *chunkAccumulator, void *ctx)
+{
+	(void)ctx;
+	*((long long*)accumulator) += *((const long long*)chunkAccumulator);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static double _GetTime()
+ * @brief 단조 증가 시계의 현재 시간을 초 단위로 반환하는 함수
+ * @return 항상 현재 시간(초) 반환
+ */
+static double _GetTime()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/**
+ * @fn static unsigned int _NextRandom(unsigned int *state)
+ * @brief 재현 가능한 의사 난수를 생성하는 함수 (xorshift32)
+ * @param state 난수 상태(입력, 출력)
+ * @return 항상 다음 난수 반환
+ */
+static unsigned int _NextRandom(unsigned int *state)
+{
+	unsigned int x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+/**
+ * @fn static void _Shuffle(int *array, int count, unsigned int *state)
+ * @brief 배열을 무작위로 섞는 함수 (Fisher-Yates)
+ * @param array 섞을 배열(입력, 출력)
+ * @param count 배열 원소 개수(입력)
+ * @param state 난수 상태(입력, 출력)
+ * @return 반환값 없음
+ */
+static void _Shuffle(int *array, int count, unsigned int *state)
+{
+	int index = count - 1;
+	for( ; index > 0; index--)
+	{
+		int target = (int)(_NextRandom(state) % (unsigned int)(index + 1));
+		int temp = array[index];
+		array[index] = array[target];
+		array[target] = temp;
+	}
+}
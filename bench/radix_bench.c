@@ -0,0 +1,158 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../include/jrbtree.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions of Benchmark
+////////////////////////////////////////////////////////////////////////////////
+
+// 키 개수를 지정하지 않은 경우 측정할 키 개수들 (캐시 안, L2/L3, 메모리)
+static const int defaultKeyCounts[] = { 1000, 100000, 1000000 };
+// 측정할 radix 표 칸의 bit 수 (0 은 radix 표 없는 RB Tree)
+static const unsigned int radixBits[] = { 0, 8, 12, 16 };
+// 키 개수와 상관없이 측정할 검색 횟수
+#define LOOKUP_COUNT 4000000
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static double _GetTime();
+static unsigned int _NextRandom(unsigned int *state);
+static void _Shuffle(int *array, int count, unsigned int *state);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Main Function
+/// 사용법: ./radix_bench [키 개수]
+/// [0, 키 개수) 의 조밀한 정수 키를 섞인 순서로 추가, 무작위 검색, 전부 삭제하면서
+/// radix 표 없는 RB Tree(bits 0)와 NewJRBTreeRadix 로 2^bits 칸을 둔 트리의
+/// 한 번의 평균 시간과 평균 검색 깊이(높이), 키 한 개의 메모리 크기를 출력한다.
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char **argv)
+{
+	int sizeCount = (int)(sizeof(defaultKeyCounts) / sizeof(defaultKeyCounts[0]));
+	int bitsCount = (int)(sizeof(radixBits) / sizeof(radixBits[0]));
+	int argumentKeyCount = (argc > 1) ? atoi(argv[1]) : 0;
+	if(argumentKeyCount > 0) sizeCount = 1;
+
+	printf("%10s %5s %12s %12s %12s %7s %10s\n", "keys", "bits", "insert ns", "find ns", "delete ns", "height", "bytes/key");
+
+	int sizeIndex = 0;
+	for( ; sizeIndex < sizeCount; sizeIndex++)
+	{
+		int keyCount = (argumentKeyCount > 0) ? argumentKeyCount : defaultKeyCounts[sizeIndex];
+		unsigned int state = 20211019;
+
+		int *keys = (int*)malloc(sizeof(int) * (size_t)keyCount);
+		int **lookupKeys = (int**)malloc(sizeof(int*) * LOOKUP_COUNT);
+		if(keys == NULL || lookupKeys == NULL) return -1;
+
+		int keyIndex = 0;
+		for( ; keyIndex < keyCount; keyIndex++) keys[keyIndex] = keyIndex;
+		_Shuffle(keys, keyCount, &state);
+
+		int lookupIndex = 0;
+		for( ; lookupIndex < LOOKUP_COUNT; lookupIndex++) lookupKeys[lookupIndex] = &keys[_NextRandom(&state) % (unsigned int)keyCount];
+
+		int bitsIndex = 0;
+		for( ; bitsIndex < bitsCount; bitsIndex++)
+		{
+			unsigned int bits = radixBits[bitsIndex];
+			JRBTreePtr tree = (bits == 0) ? NewJRBTree(IntType) : NewJRBTreeRadix(0, keyCount - 1, bits);
+			if(tree == NULL) return -1;
+
+			double startTime = _GetTime();
+			for(keyIndex = 0; keyIndex < keyCount; keyIndex++)
+			{
+				if(JRBTreeInsertNode(tree, &keys[keyIndex]) == NULL) return -1;
+			}
+			double insertNs = (_GetTime() - startTime) * 1e9 / keyCount;
+
+			long found = 0;
+			startTime = _GetTime();
+			for(lookupIndex = 0; lookupIndex < LOOKUP_COUNT; lookupIndex++)
+			{
+				if(JRBTreeFindNodeByKey(tree, lookupKeys[lookupIndex]) != NULL) found++;
+			}
+			double findNs = (_GetTime() - startTime) * 1e9 / LOOKUP_COUNT;
+			if(found != LOOKUP_COUNT) return -1;
+
+			JRBTreeStats stats;
+			JRBTreeGetStats(tree, &stats);
+
+			// 추가한 순서의 반대로 삭제한다.
+			startTime = _GetTime();
+			for(keyIndex = keyCount - 1; keyIndex >= 0; keyIndex--)
+			{
+				if(JRBTreeDeleteNodeByKey(tree, &keys[keyIndex]) != DeleteSuccess) return -1;
+			}
+			double deleteNs = (_GetTime() - startTime) * 1e9 / keyCount;
+
+			printf("%10d %5u %12.1f %12.1f %12.1f %7d %10.1f\n", keyCount, bits,
+				insertNs, findNs, deleteNs, stats.height, (double)stats.allocatedBytes / keyCount);
+
+			DeleteJRBTree(&tree);
+		}
+
+		free(lookupKeys);
+		free(keys);
+	}
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static double _GetTime()
+ * @brief 단조 증가 시계의 현재 시간을 초 단위로 반환하는 함수
+ * @return 항상 현재 시간(초) 반환
+ */
+static double _GetTime()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/**
+ * @fn static unsigned int _NextRandom(unsigned int *state)
+ * @brief 재현 가능한 의사 난수를 생성하는 함수 (xorshift32)
+ * @param state 난수 상태(입력, 출력)
+ * @return 항상 다음 난수 반환
+ */
+static unsigned int _NextRandom(unsigned int *state)
+{
+	unsigned int x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+/**
+ * @fn static void _Shuffle(int *array, int count, unsigned int *state)
+ * @brief 배열을 무작위로 섞는 함수 (Fisher-Yates)
+ * @param array 섞을 배열(입력, 출력)
+ * @param count 배열 원소 개수(입력)
+ * @param state 난수 상태(입력, 출력)
+ * @return 반환값 없음
+ */
+static void _Shuffle(int *array, int count, unsigned int *state)
+{
+	int index = count - 1;
+	for( ; index > 0; index--)
+	{
+		int target = (int)(_NextRandom(state) % (unsigned int)(index + 1));
+		int temp = array[index];
+		array[index] = array[target];
+		array[target] = temp;
+	}
+}
@@ -1,6 +1,9 @@
 #ifndef __JRBTREE_H__
 #define __JRBTREE_H__
 
+#include <stdio.h>
+#include <stddef.h>
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Enums
 ///////////////////////////////////////////////////////////////////////////////
@@ -14,6 +17,15 @@ typedef enum DeleteResult
 	DeleteSuccess = 1
 } DeleteResult;
 
+// 저장 결과 열거형
+typedef enum SaveResult
+{
+	// 실패
+	SaveFail = -1,
+	// 성공
+	SaveSuccess = 1
+} SaveResult;
+
 // 키 유형 열거형
 typedef enum KeyType
 {
@@ -36,6 +48,48 @@ typedef enum NodeColor
 	Black
 } NodeColor;
 
+// 정적 검색 트리의 블록 내부 검색 방식 열거형
+typedef enum FrozenSearchType
+{
+	// 일반 비교 (SIMD 미지원 CPU)
+	FrozenScalar = 0,
+	// SSE2 compare + movemask
+	FrozenSSE2,
+	// AVX2 compare + movemask
+	FrozenAVX2
+} FrozenSearchType;
+
+// 정렬 순서로 키를 내보낼 때의 형식 열거형
+typedef enum ExportMode
+{
+	// 키 값 그대로 (IntType: int, CharType: char, StringType: 널 문자로 끝나는 문자열)
+	ExportBinary = 1,
+	// 키마다 텍스트 한 줄 (개행 문자로 구분)
+	ExportNewline,
+	// 키마다 uint32 길이 + 키 값 (StringType 은 널 문자 없음)
+	ExportLengthPrefixed
+} ExportMode;
+
+// 진단 출력 형식 열거형
+typedef enum DumpFormat
+{
+	// JRBTreePrintAll 과 같은 들여쓰기 텍스트
+	DumpText = 1,
+	// Graphviz dot
+	DumpGraphviz,
+	// JSON (노드 배열)
+	DumpJSON
+} DumpFormat;
+
+// 키 순서를 관리하는 엔진 열거형 (NewJRBTreeWithEngine 참고)
+typedef enum JRBTreeEngine
+{
+	// Red-Black Tree (NewJRBTree 와 같음)
+	EngineRedBlack = 1,
+	// 캐시 라인 크기의 노드와 연결된 리프를 사용하는 B+ Tree
+	EngineBPlus
+} JRBTreeEngine;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Definitions
 ///////////////////////////////////////////////////////////////////////////////
@@ -48,22 +102,198 @@ typedef struct _jnode_t {
 	void *key;
 	// 부모 노드 주소
 	struct _jnode_t *parent;
-	// 이전 노드 주소
-	struct _jnode_t *left;
-	// 다음 노드 주소
-	struct _jnode_t *right;
+	union {
+		struct {
+			// 이전 노드 주소
+			struct _jnode_t *left;
+			// 다음 노드 주소
+			struct _jnode_t *right;
+		};
+		// 자식 노드 주소 배열 (child[0] == left, child[1] == right, 비교 결과로 바로 인덱싱하기 위해 사용)
+		struct _jnode_t *child[2];
+	};
 } JNode, *JNodePtr, **JNodePtrContainer;
 
+// 구간 트리에 키로 저장하는 닫힌 구간 [low, high] 구조체 (NewJRBTreeInterval 참고)
+// low 가 첫 번째 멤버이므로 IntType 키로 비교하면 low 순서로 정렬된다.
+typedef struct _jrbtree_interval_t {
+	// 시작점
+	int low;
+	// 끝점 (low 이상)
+	int high;
+} JRBTreeInterval, *JRBTreeIntervalPtr;
+
+// RB Tree 누적 카운터 구조체 (JRBTREE_STATS 로 빌드한 경우에만 증가)
+typedef struct _jrbtree_counters_t {
+	// 노드 추가 횟수
+	unsigned long long inserts;
+	// 노드 삭제 횟수
+	unsigned long long deletes;
+	// 노드 검색 횟수
+	unsigned long long lookups;
+	// 회전 횟수
+	unsigned long long rotations;
+	// 키 비교 횟수
+	unsigned long long comparisons;
+} JRBTreeCounters;
+
+// RB Tree 통계 구조체 (JRBTreeGetStats 참고)
+typedef struct _jrbtree_stats_t {
+	// 노드 개수
+	size_t nodeCount;
+	// 높이 (루트 노드만 있으면 1)
+	int height;
+	// 루트 노드에서 외부 노드까지의 Black 노드 개수
+	int blackHeight;
+	// 라이브러리가 할당한 메모리 크기 (RB Tree 구조체 + 노드)
+	size_t allocatedBytes;
+	// 누적 카운터
+	JRBTreeCounters counters;
+} JRBTreeStats, *JRBTreeStatsPtr;
+
+// 문자열을 연속된 청크에 한 번만 저장하는 문자열 풀 (NewJRBTreeStringPool 참고, 내부 구조는 공개하지 않음)
+typedef struct _jrbtree_arena_t JRBTreeStringPool, *JRBTreeStringPoolPtr, **JRBTreeStringPoolPtrContainer;
+
+// 노드가 삭제될 때 키를 해제하는 함수 (JRBTreeSetKeyDestructor 참고)
+typedef void (*JRBTreeKeyDestructor)(void *key);
+
+// 서브 트리의 집계 값을 계산하는 함수 (NewJRBTreeAugmented 참고)
+// aggregate = leftAggregate + key + rightAggregate (결합 법칙을 만족하는 연산, 자식 서브 트리가 없으면 NULL)
+// aggregate 는 leftAggregate 나 rightAggregate 와 같은 주소일 수 있으므로 입력을 모두 읽은 후에 써야 한다.
+typedef void (*JRBTreeAggregateCombine)(void *aggregate, const void *key, const void *leftAggregate, const void *rightAggregate);
+
+// 병렬 순회에서 키마다 호출하는 함수 (JRBTreeParallelForEach 참고)
+// chunk 는 키 순서로 나눈 조각 번호이며, 번호가 작은 조각의 키가 항상 더 작다. (같은 조각의 키는 키 순서로 호출)
+typedef void (*JRBTreeVisitFunc)(void *key, size_t chunk, void *ctx);
+
+// 병렬 reduce 에서 조각의 누적 값에 키 하나를 더하는 함수 (JRBTreeParallelReduce 참고)
+typedef void (*JRBTreeReduceFunc)(void *accumulator, void *key, void *ctx);
+
+// 병렬 reduce 에서 조각의 누적 값을 키 순서로 합치는 함수 (accumulator = accumulator + chunkAccumulator)
+typedef void (*JRBTreeMergeFunc)(void *accumulator, const void *chunkAccumulator, void *ctx);
+
 // RB Tree 구조체
 typedef struct _jrbtree_t {
 	// 키 데이터 유형
 	KeyType type;
 	// 루트 노드
 	JNodePtr root;
+	// 키 값으로 노드를 찾는 해시 색인 (JRBTreeSetHashIndex 참고, 사용하지 않으면 NULL)
+	struct _jrbtree_hash_index_t *hashIndex;
+	// 자주 검색하는 키의 노드를 기억하는 캐시 (JRBTreeSetHotCache 참고, 사용하지 않으면 NULL)
+	struct _jrbtree_hot_cache_t *hotCache;
+	// B+ Tree 엔진 (EngineBPlus 로 생성한 경우에만 사용, 아니면 NULL, 이 경우 root 는 항상 NULL)
+	struct _jrbtree_bplus_t *bplus;
+	// 정수 키의 상위 bit 로 서브 트리를 고르는 radix 표 (NewJRBTreeRadix 로 생성한 경우에만 사용, 아니면 NULL, 이 경우 root 는 항상 NULL)
+	// 여기까지는 검색할 때 읽으므로 캐시 라인 하나(64 bytes)에 들어가도록 유지한다.
+	struct _jrbtree_radix_t *radix;
+	// 가장 작은 키를 가진 노드 (비어 있으면 NULL)
+	JNodePtr leftmost;
+	// 가장 큰 키를 가진 노드 (비어 있으면 NULL)
+	JNodePtr rightmost;
+	// 노드 개수
+	size_t size;
 	// 사용자 데이터
 	void *data;
+	// 같은 값의 키 허용 여부 (NewJRBTreeMultiset 참고)
+	int multiset;
+	// 구간 트리 여부 (NewJRBTreeInterval 참고, 키는 JRBTreeInterval 이고 집계 값은 서브 트리의 최대 끝점)
+	int interval;
+	// 노드마다 노드 바로 뒤에 저장하는 집계 값의 크기 (NewJRBTreeAugmented 참고, 사용하지 않으면 0)
+	size_t aggregateSize;
+	// 집계 값 계산 함수 (사용하지 않으면 NULL, 회전과 추가/삭제 경로에서 호출)
+	JRBTreeAggregateCombine aggregateCombine;
+	// 누적 카운터 (JRBTREE_STATS 빌드 여부와 상관없이 구조체 크기는 같다)
+	JRBTreeCounters counters;
+	// 키 소멸자 (NULL 이면 키를 해제하지 않음)
+	JRBTreeKeyDestructor keyDestructor;
+	// 키를 복사해서 저장하는 arena (NewJRBTreeOwned 로 생성한 경우에만 사용, 아니면 NULL)
+	struct _jrbtree_arena_t *keyArena;
+	// 노드를 할당하는 arena (NewJRBTreeOwned, JRBTreeBuildParallel 로 생성한 경우에만 사용, 아니면 NULL, keyArena 와 같을 수 있음)
+	struct _jrbtree_arena_t *nodeArena;
+	// 삭제된 노드를 재사용하기 위한 목록 (nodeArena 를 사용하는 경우, right 로 연결)
+	JNodePtr freeNodes;
 } JRBTree, *JRBTreePtr, **JRBTreePtrContainer;
 
+// 한 블록에 저장하는 키 개수 (16 * sizeof(int) = 64 bytes, 캐시 라인 한 개)
+#define JRBTREE_FROZEN_BLOCK_SIZE 16
+
+// 더 이상 변경되지 않는 정수 키 RB Tree 를 검색 전용으로 변환한 정적 다진 검색 트리 구조체
+// 블록 k 의 i 번째 자식 블록은 k * (JRBTREE_FROZEN_BLOCK_SIZE + 1) + i + 1 에 위치한다.
+typedef struct _jrbtree_frozen_t {
+	// 블록 단위로 정렬된 키 배열 (64 bytes 정렬)
+	int *keys;
+	// keys 와 같은 위치에 대응하는 원본 RB Tree 노드 주소 배열
+	JNodePtr *nodes;
+	// 블록 개수
+	size_t blockCount;
+	// 저장된 키 개수
+	size_t count;
+	// 블록 내부 검색 방식 (생성 시점에 CPUID 로 선택)
+	FrozenSearchType searchType;
+} JRBTreeFrozen, *JRBTreeFrozenPtr, **JRBTreeFrozenPtrContainer;
+
+// JRBTreeSave 로 저장한 스냅샷 파일을 mmap 으로 매핑한 읽기 전용 구조체
+typedef struct _jrbtree_mapped_t {
+	// 키 데이터 유형
+	KeyType type;
+	// 저장된 키 개수
+	size_t count;
+	// 정렬된 키 영역 시작 주소 (IntType: int32, CharType: char, StringType: 문자열 영역 오프셋)
+	const void *keys;
+	// 문자열 영역 시작 주소 (StringType)
+	const char *stringHeap;
+	// 매핑 시작 주소
+	void *base;
+	// 매핑 크기
+	size_t length;
+} JRBTreeMapped, *JRBTreeMappedPtr, **JRBTreeMappedPtrContainer;
+
+// 앞부분 압축(front coding) 블록 하나에 저장하는 키 개수
+#define JRBTREE_FROZEN_STRING_BLOCK_SIZE 16
+
+// 더 이상 변경되지 않는 문자열 키 RB Tree 를 검색 전용으로 변환한 앞부분 압축 정렬 배열 구조체
+// 블록마다 첫 키는 (길이, 문자열) 로, 나머지 키는 (이전 키와의 공통 접두사 길이, 나머지 길이, 나머지 문자열) 로 저장한다.
+// 길이는 7 bit 가변 길이 정수이며 문자열에 널 문자는 저장하지 않는다.
+typedef struct _jrbtree_frozen_string_t {
+	// 앞부분 압축된 키 데이터
+	unsigned char *data;
+	// 키 데이터 크기
+	size_t dataSize;
+	// 블록마다 첫 키의 data 오프셋 배열
+	size_t *blockOffsets;
+	// 정렬 순서의 원본 RB Tree 노드 주소 배열
+	JNodePtr *nodes;
+	// 블록 개수
+	size_t blockCount;
+	// 저장된 키 개수
+	size_t count;
+} JRBTreeFrozenString, *JRBTreeFrozenStringPtr, **JRBTreeFrozenStringPtrContainer;
+
+// RB Tree 의 키를 정렬 순서로 나누어 내보내기 위한 커서 구조체
+typedef struct _jrbtree_export_cursor_t {
+	// 키 데이터 유형
+	KeyType type;
+	// 내보낼 형식
+	ExportMode mode;
+	// 다음에 내보낼 노드 (NULL 이면 모두 내보낸 상태)
+	JNodePtr node;
+	// 현재 노드에서 이미 내보낸 크기 (버퍼 경계에 걸친 키를 이어서 내보낼 때 사용)
+	size_t recordOffset;
+	// 정수 문자열과 길이 변환에 사용하는 임시 버퍼
+	char scratch[16];
+} JRBTreeExportCursor, *JRBTreeExportCursorPtr, **JRBTreeExportCursorPtrContainer;
+
+// 진단 출력 옵션 구조체
+typedef struct _jrbtree_dump_option_t {
+	// 출력 형식
+	DumpFormat format;
+	// 출력할 최대 깊이, 루트 노드가 1 (0 이하면 제한 없음)
+	int maxDepth;
+	// 방문한 노드 중 sampleRate 개마다 하나씩 출력 (1 이하면 모두 출력)
+	int sampleRate;
+} JRBTreeDumpOption, *JRBTreeDumpOptionPtr;
+
 ///////////////////////////////////////////////////////////////////////////////
 // Functions for JNode
 ///////////////////////////////////////////////////////////////////////////////
@@ -72,22 +302,103 @@ JNodePtr NewJNode();
 DeleteResult DeleteJNode(JNodePtrContainer container);
 void* JNodeGetKey(const JNodePtr node);
 void* JNodeSetKey(JNodePtr node, void *key);
+JNodePtr JNodeGetNext(const JNodePtr node);
+JNodePtr JNodeGetPrevious(const JNodePtr node);
 
 ///////////////////////////////////////////////////////////////////////////////
 // Functions for JRBTree
 ///////////////////////////////////////////////////////////////////////////////
 
 JRBTreePtr NewJRBTree(KeyType type);
+JRBTreePtr NewJRBTreeMultiset(KeyType type);
+JRBTreePtr NewJRBTreeOwned(KeyType type);
+JRBTreePtr NewJRBTreeWithEngine(KeyType type, JRBTreeEngine engine);
+JRBTreePtr NewJRBTreeRadix(int minKey, int maxKey, unsigned int bits);
+JRBTreePtr NewJRBTreeInterval();
+JRBTreePtr NewJRBTreeAugmented(KeyType type, size_t aggregateSize, JRBTreeAggregateCombine combine);
 DeleteResult DeleteJRBTree(JRBTreePtrContainer container);
+JRBTreePtr JRBTreeSetKeyDestructor(JRBTreePtr tree, JRBTreeKeyDestructor destructor);
+JRBTreePtr JRBTreeSetHotCache(JRBTreePtr tree, size_t slotCount);
+JRBTreePtr JRBTreeSetHashIndex(JRBTreePtr tree, int enable);
 
 void* JRBTreeGetData(const JRBTreePtr tree);
 void* JRBTreeSetData(JRBTreePtr tree, void *data);
 
 JRBTreePtr JRBTreeInsertNode(JRBTreePtr tree, void *data);
+JNodePtr JRBTreeInsertHint(JRBTreePtr tree, void *key, const JNodePtr hint);
 DeleteResult JRBTreeDeleteNodeByKey(JRBTreePtr tree, void *key);
 JNodePtr JRBTreeFindNodeByKey(const JRBTreePtr tree, void *key);
+JNodePtr JRBTreeFindFrom(const JRBTreePtr tree, const JNodePtr hint, void *key);
+JRBTreeStatsPtr JRBTreeGetStats(const JRBTreePtr tree, JRBTreeStatsPtr stats);
+size_t JRBTreeSize(const JRBTreePtr tree);
+JNodePtr JRBTreeMin(const JRBTreePtr tree);
+JNodePtr JRBTreeMax(const JRBTreePtr tree);
+void* JRBTreePopMin(JRBTreePtr tree);
+JNodePtr JRBTreeLowerBound(const JRBTreePtr tree, void *key);
+JNodePtr JRBTreeUpperBound(const JRBTreePtr tree, void *key);
+size_t JRBTreeCount(const JRBTreePtr tree, void *key);
+JNodePtr JRBTreeEqualRange(const JRBTreePtr tree, void *key, JNodePtrContainer end);
+size_t JRBTreeDeleteRange(JRBTreePtr tree, void *lo, void *hi);
+size_t JRBTreeTruncateBelow(JRBTreePtr tree, void *key);
+size_t JRBTreeIntervalFindOverlaps(const JRBTreePtr tree, int low, int high, JNodePtr *nodes, size_t capacity);
+size_t JRBTreeIntervalStab(const JRBTreePtr tree, int point, JNodePtr *nodes, size_t capacity);
+int JRBTreeRangeAggregate(const JRBTreePtr tree, void *lo, void *hi, void *out);
+size_t JRBTreeParallelForEach(const JRBTreePtr tree, JRBTreeVisitFunc fn, void *ctx, int threadCount);
+int JRBTreeParallelReduce(const JRBTreePtr tree, JRBTreeReduceFunc reduce, JRBTreeMergeFunc merge, void *ctx, int threadCount, size_t resultSize, void *result);
+JRBTreePtr JRBTreeBuildParallel(KeyType type, void **keys, size_t count, int threadCount);
 
 void JRBTreePrintAll(const JRBTreePtr tree);
+long long JRBTreeDump(const JRBTreePtr tree, FILE *fp, const JRBTreeDumpOptionPtr option);
+size_t JRBTreeDumpToBuffer(const JRBTreePtr tree, char *buffer, size_t size, const JRBTreeDumpOptionPtr option);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JRBTreeFrozen
+///////////////////////////////////////////////////////////////////////////////
+
+JRBTreeFrozenPtr NewJRBTreeFrozen(const JRBTreePtr tree);
+DeleteResult DeleteJRBTreeFrozen(JRBTreeFrozenPtrContainer container);
+JNodePtr JRBTreeFrozenFindNodeByKey(const JRBTreeFrozenPtr frozen, void *key);
+
+JRBTreeFrozenStringPtr NewJRBTreeFrozenString(const JRBTreePtr tree);
+DeleteResult DeleteJRBTreeFrozenString(JRBTreeFrozenStringPtrContainer container);
+JNodePtr JRBTreeFrozenStringFindNodeByKey(const JRBTreeFrozenStringPtr frozen, const char *key);
+size_t JRBTreeFrozenStringGetBytes(const JRBTreeFrozenStringPtr frozen);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JRBTreeStringPool
+///////////////////////////////////////////////////////////////////////////////
+
+JRBTreeStringPoolPtr NewJRBTreeStringPool();
+DeleteResult DeleteJRBTreeStringPool(JRBTreeStringPoolPtrContainer container);
+char* JRBTreeStringPoolIntern(JRBTreeStringPoolPtr pool, const char *string);
+size_t JRBTreeStringPoolGetCount(const JRBTreeStringPoolPtr pool);
+size_t JRBTreeStringPoolGetBytes(const JRBTreeStringPoolPtr pool);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for Snapshot
+///////////////////////////////////////////////////////////////////////////////
+
+SaveResult JRBTreeSave(const JRBTreePtr tree, int fd);
+JRBTreeMappedPtr JRBTreeLoadMapped(const char *path);
+DeleteResult DeleteJRBTreeMapped(JRBTreeMappedPtrContainer container);
+int JRBTreeMappedVerify(const JRBTreeMappedPtr mapped);
+const void* JRBTreeMappedGetKey(const JRBTreeMappedPtr mapped, size_t index);
+const void* JRBTreeMappedFindKey(const JRBTreeMappedPtr mapped, const void *key);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for Export
+///////////////////////////////////////////////////////////////////////////////
+
+JRBTreeExportCursorPtr NewJRBTreeExportCursor(const JRBTreePtr tree, ExportMode mode);
+DeleteResult DeleteJRBTreeExportCursor(JRBTreeExportCursorPtrContainer container);
+size_t JRBTreeExportToBuffer(JRBTreeExportCursorPtr cursor, char *buffer, size_t size);
+long long JRBTreeExportToFd(const JRBTreePtr tree, int fd, ExportMode mode);
+
+// 호출하는 쪽에서 검색 함수를 인라인하는 모드 (-DJRBTREE_INLINE, include/jrbtree_inline.h 참고)
+#ifdef JRBTREE_INLINE
+#include "jrbtree_inline.h"
+#define JRBTreeFindNodeByKey(tree, key) JRBTreeFindNodeByKeyInline((tree), (key))
+#endif
 
 #endif
 
@@ -0,0 +1,306 @@
+#ifndef __JRBTREE_GEN_H__
+#define __JRBTREE_GEN_H__
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "jrbtree.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// Type-specialized RB Tree Generator
+/// JRBTREE_DEFINE(name, KeyT, ValT, CMP) 는 키 유형마다 특화된 RB Tree 구조체와 함수들을 생성한다.
+/// 키와 값을 노드 안에 직접 저장하고 비교 함수가 컴파일 시간에 정해지므로,
+/// KeyType switch 나 함수 포인터 호출 없이 비교가 인라인된다. (헤더만 사용, libjrbt.a 불필요)
+///
+/// 예) JRBTREE_DEFINE(IntMap, int, double, JRBTREE_CMP_NUM)
+///     IntMapPtr map = NewIntMap();
+///     IntMapInsert(map, 10, 1.5);
+///     IntMapNodePtr node = IntMapFind(map, 10);
+///     IntMapDelete(map, 10);
+///     DeleteIntMap(&map);
+///
+/// 생성되는 이름 (name = IntMap 인 경우)
+///  - 구조체 : IntMap, IntMapPtr, IntMapPtrContainer, IntMapNode, IntMapNodePtr
+///  - 함수   : NewIntMap, DeleteIntMap, IntMapInsert, IntMapFind, IntMapDelete,
+///             IntMapSize, IntMapMin, IntMapMax, IntMapNext
+///
+/// JRBTreeInsertNode 와 달리 키는 값으로 비교하며 같은 키는 하나만 저장한다.
+/// CMP(a, b) 는 a < b 이면 음수, 같으면 0, a > b 이면 양수를 반환하는 매크로 또는 함수이다.
+///////////////////////////////////////////////////////////////////////////////
+
+// 숫자 키 비교 (int, double, 포인터 등)
+#define JRBTREE_CMP_NUM(a, b) (((a) > (b)) - ((a) < (b)))
+// 문자열 키 비교 (const char*)
+#define JRBTREE_CMP_STR(a, b) strcmp((a), (b))
+
+#define JRBTREE_DEFINE(name, KeyT, ValT, CMP) \
+\
+/* 노드 구조체 */ \
+typedef struct _##name##_node_t { \
+	KeyT key; \
+	ValT value; \
+	NodeColor color; \
+	struct _##name##_node_t *parent; \
+	struct _##name##_node_t *left; \
+	struct _##name##_node_t *right; \
+} name##Node, *name##NodePtr; \
+\
+/* RB Tree 구조체 */ \
+typedef struct _##name##_t { \
+	name##NodePtr root; \
+	size_t size; \
+} name, *name##Ptr, **name##PtrContainer; \
+\
+static inline name##Ptr New##name(void) \
+{ \
+	name##Ptr newTree = (name##Ptr)malloc(sizeof(name)); \
+	if(newTree == NULL) return NULL; \
+	newTree->root = NULL; \
+	newTree->size = 0; \
+	return newTree; \
+} \
+\
+static inline void _##name##DeleteNodes(name##NodePtr node) \
+{ \
+	/* 재귀 없이 왼쪽 자식 방향으로 회전하면서 해제한다. */ \
+	while(node != NULL) \
+	{ \
+		if(node->left != NULL) \
+		{ \
+			name##NodePtr leftNode = node->left; \
+			node->left = leftNode->right; \
+			leftNode->right = node; \
+			node = leftNode; \
+		} \
+		else \
+		{ \
+			name##NodePtr rightNode = node->right; \
+			free(node); \
+			node = rightNode; \
+		} \
+	} \
+} \
+\
+static inline DeleteResult Delete##name(name##PtrContainer container) \
+{ \
+	if(container == NULL || *container == NULL) return DeleteFail; \
+	_##name##DeleteNodes((*container)->root); \
+	free(*container); \
+	*container = NULL; \
+	return DeleteSuccess; \
+} \
+\
+static inline size_t name##Size(const name##Ptr tree) \
+{ \
+	return (tree == NULL) ? 0 : tree->size; \
+} \
+\
+static inline name##NodePtr name##Find(const name##Ptr tree, KeyT key) \
+{ \
+	if(tree == NULL) return NULL; \
+	name##NodePtr currentNode = tree->root; \
+	while(currentNode != NULL) \
+	{ \
+		int result = CMP(key, currentNode->key); \
+		if(result == 0) return currentNode; \
+		currentNode = (result < 0) ? currentNode->left : currentNode->right; \
+	} \
+	return NULL; \
+} \
+\
+static inline name##NodePtr name##Min(const name##Ptr tree) \
+{ \
+	if(tree == NULL || tree->root == NULL) return NULL; \
+	name##NodePtr currentNode = tree->root; \
+	while(currentNode->left != NULL) currentNode = currentNode->left; \
+	return currentNode; \
+} \
+\
+static inline name##NodePtr name##Max(const name##Ptr tree) \
+{ \
+	if(tree == NULL || tree->root == NULL) return NULL; \
+	name##NodePtr currentNode = tree->root; \
+	while(currentNode->right != NULL) currentNode = currentNode->right; \
+	return currentNode; \
+} \
+\
+static inline name##NodePtr name##Next(const name##NodePtr node) \
+{ \
+	if(node == NULL) return NULL; \
+	name##NodePtr currentNode = node; \
+	if(currentNode->right != NULL) \
+	{ \
+		currentNode = currentNode->right; \
+		while(currentNode->left != NULL) currentNode = currentNode->left; \
+		return currentNode; \
+	} \
+	while((currentNode->parent != NULL) && (currentNode->parent->right == currentNode)) currentNode = currentNode->parent; \
+	return currentNode->parent; \
+} \
+\
+static inline void _##name##Rotate(name##Ptr tree, name##NodePtr node, int toLeft) \
+{ \
+	name##NodePtr childNode = toLeft ? node->right : node->left; \
+	if(toLeft) \
+	{ \
+		node->right = childNode->left; \
+		if(childNode->left != NULL) childNode->left->parent = node; \
+		childNode->left = node; \
+	} \
+	else \
+	{ \
+		node->left = childNode->right; \
+		if(childNode->right != NULL) childNode->right->parent = node; \
+		childNode->right = node; \
+	} \
+	childNode->parent = node->parent; \
+	if(node->parent == NULL) tree->root = childNode; \
+	else if(node->parent->left == node) node->parent->left = childNode; \
+	else node->parent->right = childNode; \
+	node->parent = childNode; \
+} \
+\
+static inline name##NodePtr name##Insert(name##Ptr tree, KeyT key, ValT value) \
+{ \
+	if(tree == NULL) return NULL; \
+	name##NodePtr parentNode = NULL; \
+	name##NodePtr currentNode = tree->root; \
+	int result = 0; \
+	while(currentNode != NULL) \
+	{ \
+		result = CMP(key, currentNode->key); \
+		if(result == 0) return NULL; \
+		parentNode = currentNode; \
+		currentNode = (result < 0) ? currentNode->left : currentNode->right; \
+	} \
+\
+	name##NodePtr newNode = (name##NodePtr)malloc(sizeof(name##Node)); \
+	if(newNode == NULL) return NULL; \
+	newNode->key = key; \
+	newNode->value = value; \
+	newNode->color = Red; \
+	newNode->parent = parentNode; \
+	newNode->left = NULL; \
+	newNode->right = NULL; \
+	if(parentNode == NULL) tree->root = newNode; \
+	else if(result < 0) parentNode->left = newNode; \
+	else parentNode->right = newNode; \
+	tree->size++; \
+\
+	/* Double Red 복구 (src/jrbtree.c 의 JRBTreeInsertFixup 과 같음) */ \
+	currentNode = newNode; \
+	while((currentNode->parent != NULL) && (currentNode->parent->color == Red)) \
+	{ \
+		name##NodePtr fixParentNode = currentNode->parent; \
+		name##NodePtr grandParentNode = fixParentNode->parent; \
+		int parentIsLeft = (fixParentNode == grandParentNode->left); \
+		name##NodePtr uncleNode = parentIsLeft ? grandParentNode->right : grandParentNode->left; \
+		if(uncleNode != NULL && uncleNode->color == Red) \
+		{ \
+			fixParentNode->color = Black; \
+			uncleNode->color = Black; \
+			grandParentNode->color = Red; \
+			currentNode = grandParentNode; \
+			continue; \
+		} \
+		if(currentNode == (parentIsLeft ? fixParentNode->right : fixParentNode->left)) \
+		{ \
+			currentNode = fixParentNode; \
+			_##name##Rotate(tree, currentNode, parentIsLeft); \
+			fixParentNode = currentNode->parent; \
+		} \
+		fixParentNode->color = Black; \
+		grandParentNode->color = Red; \
+		_##name##Rotate(tree, grandParentNode, !parentIsLeft); \
+	} \
+	tree->root->color = Black; \
+	return newNode; \
+} \
+\
+static inline void _##name##Transplant(name##Ptr tree, name##NodePtr oldNode, name##NodePtr newNode) \
+{ \
+	if(oldNode->parent == NULL) tree->root = newNode; \
+	else if(oldNode->parent->left == oldNode) oldNode->parent->left = newNode; \
+	else oldNode->parent->right = newNode; \
+	if(newNode != NULL) newNode->parent = oldNode->parent; \
+} \
+\
+static inline DeleteResult name##Delete(name##Ptr tree, KeyT key) \
+{ \
+	name##NodePtr node = name##Find(tree, key); \
+	if(node == NULL) return DeleteFail; \
+\
+	name##NodePtr childNode = NULL; \
+	name##NodePtr childParentNode = NULL; \
+	NodeColor removedColor = node->color; \
+	if(node->left == NULL || node->right == NULL) \
+	{ \
+		childNode = (node->left != NULL) ? node->left : node->right; \
+		childParentNode = node->parent; \
+		_##name##Transplant(tree, node, childNode); \
+	} \
+	else \
+	{ \
+		name##NodePtr successorNode = node->right; \
+		while(successorNode->left != NULL) successorNode = successorNode->left; \
+		removedColor = successorNode->color; \
+		childNode = successorNode->right; \
+		if(successorNode->parent == node) childParentNode = successorNode; \
+		else \
+		{ \
+			childParentNode = successorNode->parent; \
+			_##name##Transplant(tree, successorNode, successorNode->right); \
+			successorNode->right = node->right; \
+			successorNode->right->parent = successorNode; \
+		} \
+		_##name##Transplant(tree, node, successorNode); \
+		successorNode->left = node->left; \
+		successorNode->left->parent = successorNode; \
+		successorNode->color = node->color; \
+	} \
+	free(node); \
+	tree->size--; \
+\
+	/* Black 노드가 빠진 경우 복구 (src/jrbtree.c 의 JRBTreeDeleteFixup 과 같음) */ \
+	if(removedColor == Black) \
+	{ \
+		while((childNode != tree->root) && (childNode == NULL || childNode->color == Black)) \
+		{ \
+			int childIsLeft = (childNode == childParentNode->left); \
+			name##NodePtr siblingNode = childIsLeft ? childParentNode->right : childParentNode->left; \
+			if(siblingNode->color == Red) \
+			{ \
+				siblingNode->color = Black; \
+				childParentNode->color = Red; \
+				_##name##Rotate(tree, childParentNode, childIsLeft); \
+				siblingNode = childIsLeft ? childParentNode->right : childParentNode->left; \
+			} \
+			name##NodePtr nearNode = childIsLeft ? siblingNode->left : siblingNode->right; \
+			name##NodePtr farNode = childIsLeft ? siblingNode->right : siblingNode->left; \
+			if((nearNode == NULL || nearNode->color == Black) && (farNode == NULL || farNode->color == Black)) \
+			{ \
+				siblingNode->color = Red; \
+				childNode = childParentNode; \
+				childParentNode = childNode->parent; \
+				continue; \
+			} \
+			if(farNode == NULL || farNode->color == Black) \
+			{ \
+				nearNode->color = Black; \
+				siblingNode->color = Red; \
+				_##name##Rotate(tree, siblingNode, !childIsLeft); \
+				siblingNode = childIsLeft ? childParentNode->right : childParentNode->left; \
+				farNode = childIsLeft ? siblingNode->right : siblingNode->left; \
+			} \
+			siblingNode->color = childParentNode->color; \
+			childParentNode->color = Black; \
+			farNode->color = Black; \
+			_##name##Rotate(tree, childParentNode, childIsLeft); \
+			childNode = tree->root; \
+		} \
+		if(childNode != NULL) childNode->color = Black; \
+	} \
+	return DeleteSuccess; \
+}
+
+#endif
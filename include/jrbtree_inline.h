@@ -0,0 +1,114 @@
+#ifndef __JRBTREE_INLINE_H__
+#define __JRBTREE_INLINE_H__
+
+#include <string.h>
+
+#include "jrbtree.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// Inline Functions
+/// 검색 경로의 키 비교 함수를 호출하는 쪽에서 인라인할 수 있도록 헤더에 정의한다.
+/// 라이브러리 내부(src/jrbtree.c)도 같은 정의를 사용한다.
+/// JRBTREE_INLINE 을 정의하고 jrbtree.h 를 포함하면 JRBTreeFindNodeByKey 호출이
+/// JRBTreeFindNodeByKeyInline 으로 바뀐다. (JRBTREE_STATS 카운터는 증가하지 않음)
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static inline int JNodeCompareKeyInline(const void *key1, const void *key2, KeyType type)
+ * @brief 두 키의 값을 비교하는 함수
+ * 매개변수 NULL 체크를 수행하지 않음
+ * @param key1 첫 번째 비교할 키(입력, 읽기 전용)
+ * @param key2 두 번째 비교할 키(입력, 읽기 전용)
+ * @param type 키의 데이터 유형(입력)
+ * @return key1 이 작으면 음수, 같으면 0, 크면 양수 반환 (알 수 없는 유형이면 0)
+ */
+static inline int JNodeCompareKeyInline(const void *key1, const void *key2, KeyType type)
+{
+	switch(type)
+	{
+		case IntType:
+			return (*((const int*)(key1)) > *((const int*)(key2))) - (*((const int*)(key1)) < *((const int*)(key2)));
+		case CharType:
+			return (*((const char*)(key1)) > *((const char*)(key2))) - (*((const char*)(key1)) < *((const char*)(key2)));
+		case StringType:
+			return strcmp((const char*)(key1), (const char*)(key2));
+		default:
+			return 0;
+	}
+}
+
+/**
+ * @fn static inline JNodePtr JNodeMoveInline(const JNodePtr node, void *key, KeyType type)
+ * @brief 지정한 노드의 키와 전달받은 키를 비교해서 다음에 방문할 자식 노드의 주소를 반환하는 함수
+ * 같은 값이면 오른쪽으로 이동한다. 매개변수 NULL 체크를 수행하지 않음
+ * @param node 위치를 움직일 노드의 주소(입력, 읽기 전용)
+ * @param key 전달받은 키(입력)
+ * @param type 키의 데이터 유형(입력)
+ * @return 성공 시 자식 노드의 주소(없으면 NULL), 실패 시 NULL 반환
+ */
+static inline JNodePtr JNodeMoveInline(const JNodePtr node, void *key, KeyType type)
+{
+	switch(type)
+	{
+		case IntType:
+			return (*((int*)(node->key)) > *((int*)(key))) ? node->left : node->right;
+		case CharType:
+			return (*((char*)(node->key)) > *((char*)(key))) ? node->left : node->right;
+		case StringType:
+			return (strcmp((char*)(node->key), (char*)(key)) > 0) ? node->left : node->right;
+		default:
+			return NULL;
+	}
+}
+
+/**
+ * @fn static inline JNodePtr JNodeFindIntInline(JNodePtr node, void *key)
+ * @brief 정수 키 서브 트리에서 키 주소가 같은 노드를 검색하는 함수
+ * 비교 결과(0 또는 1)로 child 배열을 바로 인덱싱하므로 키 유형 switch 와 예측할 수 없는 분기가 없다.
+ * (남는 분기는 노드가 NULL 이거나 찾은 경우뿐이라 거의 항상 예측에 성공한다.)
+ * @param node 검색을 시작할 서브 트리의 루트 노드(입력)
+ * @param key 검색할 정수 키의 주소(입력)
+ * @return 성공 시 노드의 주소, 실패 시 NULL 반환
+ */
+static inline JNodePtr JNodeFindIntInline(JNodePtr node, void *key)
+{
+	int value = *((int*)key);
+	JNodePtr currentNode = node;
+	while((currentNode != NULL) && (key != currentNode->key))
+	{
+		// 같은 값이면 오른쪽으로 이동한다. (JNodeMoveInline 과 같음)
+		currentNode = currentNode->child[*((int*)(currentNode->key)) <= value];
+	}
+	return currentNode;
+}
+
+/**
+ * @fn static inline JNodePtr JRBTreeFindNodeByKeyInline(const JRBTreePtr tree, void *key)
+ * @brief JRBTreeFindNodeByKey 의 인라인 버전
+ * 키 주소로 트리를 내려가는 일반 트리만 인라인으로 검색하고, 나머지는 JRBTreeFindNodeByKey 를 호출한다.
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키의 주소(입력)
+ * @return 성공 시 노드의 주소, 실패 시 NULL 반환
+ */
+static inline JNodePtr JRBTreeFindNodeByKeyInline(const JRBTreePtr tree, void *key)
+{
+	if(tree == NULL || key == NULL) return NULL;
+	// 트리를 내려가면서 키 주소만 비교하는 경우가 아니면 라이브러리 함수로 검색한다.
+	// (B+ Tree 엔진과 radix 표는 tree->root 에 노드가 없고, 키를 복사해서 저장하는 트리는 키 값으로 비교하며,
+	//  multiset 은 같은 값의 범위를 순회해야 한다. 해시 색인과 검색 캐시도 라이브러리 함수가 관리한다.)
+	if(tree->hashIndex != NULL || tree->hotCache != NULL || tree->multiset == 1
+		|| tree->keyArena != NULL || tree->bplus != NULL || tree->radix != NULL)
+	{
+		return JRBTreeFindNodeByKey(tree, key);
+	}
+	if(tree->type == IntType) return JNodeFindIntInline(tree->root, key);
+
+	JNodePtr currentNode = tree->root;
+	while((currentNode != NULL) && (key != currentNode->key))
+	{
+		currentNode = JNodeMoveInline(currentNode, key, tree->type);
+	}
+	return currentNode;
+}
+
+#endif
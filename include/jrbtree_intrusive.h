@@ -0,0 +1,76 @@
+#ifndef __JRBTREE_INTRUSIVE_H__
+#define __JRBTREE_INTRUSIVE_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "jrbtree.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// Intrusive RB Tree
+/// 호출하는 쪽의 구조체 안에 JRBTreeLink 를 넣어서 사용하는 RB Tree (Linux 커널 rbtree 방식)
+/// 트리는 노드를 할당하지 않으며, 한 객체에 링크를 여러 개 넣으면 추가 할당 없이 여러 트리에 동시에 넣을 수 있다.
+/// 비교 함수는 JRBTREE_CONTAINER_OF 로 링크에서 객체 주소를 구해서 비교한다.
+///
+/// 예) typedef struct { int id; JRBTreeLink byId; } Task;
+///     static int CompareTaskById(const JRBTreeLink *link1, const JRBTreeLink *link2)
+///     {
+///         const Task *task1 = JRBTREE_CONTAINER_OF(link1, const Task, byId);
+///         const Task *task2 = JRBTREE_CONTAINER_OF(link2, const Task, byId);
+///         return (task1->id > task2->id) - (task1->id < task2->id);
+///     }
+///     JRBTreeIntrusive tree;
+///     JRBTreeIntrusiveInit(&tree, CompareTaskById);
+///     JRBTreeIntrusiveInsert(&tree, &task->byId);
+///////////////////////////////////////////////////////////////////////////////
+
+// 링크 주소로 링크를 포함한 객체의 주소를 구하는 매크로
+#define JRBTREE_CONTAINER_OF(pointer, type, member) ((type*)((uintptr_t)(pointer) - offsetof(type, member)))
+
+// 호출하는 쪽의 구조체에 넣는 링크 구조체 (JNode 에서 key 를 뺀 것과 같다)
+typedef struct _jrbtree_link_t {
+	// 노드 색
+	NodeColor color;
+	// 부모 링크 주소
+	struct _jrbtree_link_t *parent;
+	union {
+		struct {
+			// 왼쪽 자식 링크 주소
+			struct _jrbtree_link_t *left;
+			// 오른쪽 자식 링크 주소
+			struct _jrbtree_link_t *right;
+		};
+		// 자식 링크 주소 배열 (child[0] == left, child[1] == right)
+		struct _jrbtree_link_t *child[2];
+	};
+} JRBTreeLink, *JRBTreeLinkPtr;
+
+// 두 링크를 포함한 객체를 비교하는 함수 (link1 이 작으면 음수, 같으면 0, 크면 양수)
+typedef int (*JRBTreeLinkCompare)(const JRBTreeLink *link1, const JRBTreeLink *link2);
+// 검색할 키와 링크를 포함한 객체를 비교하는 함수 (key 가 작으면 음수, 같으면 0, 크면 양수)
+typedef int (*JRBTreeLinkKeyCompare)(const void *key, const JRBTreeLink *link);
+
+// Intrusive RB Tree 구조체 (호출하는 쪽의 구조체에 넣거나 지역 변수로 사용, JRBTreeIntrusiveInit 으로 초기화)
+typedef struct _jrbtree_intrusive_t {
+	// 루트 링크
+	JRBTreeLinkPtr root;
+	// 링크 비교 함수
+	JRBTreeLinkCompare compare;
+	// 링크 개수
+	size_t size;
+} JRBTreeIntrusive, *JRBTreeIntrusivePtr;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JRBTreeIntrusive
+///////////////////////////////////////////////////////////////////////////////
+
+JRBTreeIntrusivePtr JRBTreeIntrusiveInit(JRBTreeIntrusivePtr tree, JRBTreeLinkCompare compare);
+JRBTreeLinkPtr JRBTreeIntrusiveInsert(JRBTreeIntrusivePtr tree, JRBTreeLinkPtr link);
+DeleteResult JRBTreeIntrusiveRemove(JRBTreeIntrusivePtr tree, JRBTreeLinkPtr link);
+JRBTreeLinkPtr JRBTreeIntrusiveFind(const JRBTreeIntrusivePtr tree, const void *key, JRBTreeLinkKeyCompare keyCompare);
+JRBTreeLinkPtr JRBTreeIntrusiveFirst(const JRBTreeIntrusivePtr tree);
+JRBTreeLinkPtr JRBTreeIntrusiveLast(const JRBTreeIntrusivePtr tree);
+JRBTreeLinkPtr JRBTreeLinkGetNext(const JRBTreeLinkPtr link);
+JRBTreeLinkPtr JRBTreeLinkGetPrevious(const JRBTreeLinkPtr link);
+
+#endif
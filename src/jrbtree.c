@@ -3,34 +3,39 @@
 #include <string.h>
 
 #include "../include/jrbtree.h"
+#include "../include/jrbtree_inline.h"
+#include "jrbtree_internal.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Predefinition of JNode Static Functions
 ////////////////////////////////////////////////////////////////////////////////
 
-static JNodePtr JNodeRightRotate(const JNodePtr node);
-static JNodePtr JNodeLeftRotate(const JNodePtr node);
-static void JNodeDeleteChilds(JNodePtr node);
-static JNodePtr JNodeMove(JNodePtr node, void *key, KeyType type);
-static void JNodePrintKey(const JNodePtr node, KeyType type);
+static JNodePtr JNodeRightRotate(JRBTreePtr tree, const JNodePtr node);
+static JNodePtr JNodeLeftRotate(JRBTreePtr tree, const JNodePtr node);
 static JNodePtr JNodeGetUncle(const JNodePtr node);
 static JNodePtr JNodeGetGrandParent(const JNodePtr node);
-static JNodePtr JNodeSetParentPtr(const JNodePtr node);
+static int JNodeIsBlack(const JNodePtr node);
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Predefinition of JRBTree Static Functions
 ////////////////////////////////////////////////////////////////////////////////
 
-static void JRBTreePrintHeight(const JNodePtr node, int height, KeyType type, char position);
 static JRBTreePtr JRBTreeSetChildNode(const JRBTreePtr tree, const JNodePtr parentNode, const JNodePtr childNode);
+static JNodePtr JRBTreeInsertBelow(JRBTreePtr tree, JNodePtr startNode, void *key);
+static JNodePtr JRBTreeInsertRadix(JRBTreePtr tree, void *key);
+static JNodePtr JRBTreeGetSearchRoot(const JRBTreePtr tree, const JNodePtr hint, void *key);
+static JNodePtr JRBTreeFindUncached(const JRBTreePtr tree, void *key);
+static JNodePtr JRBTreeFindBelow(const JRBTreePtr tree, JNodePtr startNode, void *key);
+static void JRBTreeTransplant(JRBTreePtr tree, const JNodePtr oldNode, JNodePtr newNode);
+static void JRBTreeDeleteFixup(JRBTreePtr tree, JNodePtr node, JNodePtr parentNode);
+static void JRBTreeAddSubtreeStats(const JNodePtr root, int baseDepth, JRBTreeStatsPtr stats);
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Predefinition of Util Static Functions
 ////////////////////////////////////////////////////////////////////////////////
 
 static KeyType _CheckKeyType(KeyType type);
-static int _GetCompareLength(const char *s1, const char *s2);
-static char _NodeColorToChar(NodeColor color);
+static size_t _GetKeySize(KeyType type, const void *key);
 
 ///////////////////////////////////////////////////////////////////////////////
 // Functions for JNode
@@ -88,6 +93,7 @@ void* JNodeGetKey(const JNodePtr node)
 /**
  * @fn void* JNodeSetKey(JNodePtr node, void *key)
  * @brief 노드에 의 주소를 저장하는 함수
+ * 검색 캐시(JRBTreeSetHotCache)나 해시 색인(JRBTreeSetHashIndex)을 사용하는 트리의 노드의 키를 바꾸면 검색 결과가 맞지 않을 수 있다.
  * @param node 노드 구조체 객체의 주소(출력)
  * @param key 저장할 키의 주소(입력)
  * @return 성공 시 저장된 키의 주소, 실패 시 NULL 반환
@@ -99,6 +105,55 @@ void* JNodeSetKey(JNodePtr node, void *key)
 	return node->key;
 }
 
+/**
+ * @fn JNodePtr JNodeGetNext(const JNodePtr node)
+ * @brief 중위 순회 기준으로 지정한 노드의 다음 노드를 반환하는 함수
+ * 부모 노드 주소를 따라 이동하므로 재귀나 별도의 스택을 사용하지 않는다.
+ * @param node 기준 노드(입력, 읽기 전용)
+ * @return 성공 시 다음 노드의 주소, 다음 노드가 없으면 NULL 반환
+ */
+JNodePtr JNodeGetNext(const JNodePtr node)
+{
+	if(node == NULL) return NULL;
+	// B+ Tree 엔진의 노드는 정렬 순서의 연결 리스트로 연결되어 있다.
+	if(node->color == JRBTREE_LIST_COLOR) return node->right;
+	if(node->right != NULL) return JNodeGetLeftmost(node->right);
+
+	JNodePtr currentNode = node;
+	JNodePtr parentNode = node->parent;
+	while((parentNode != NULL) && (parentNode->right == currentNode))
+	{
+		currentNode = parentNode;
+		parentNode = parentNode->parent;
+	}
+	// radix 표의 서브 트리 루트 노드까지 올라간 경우 다음 칸으로 넘어간다.
+	if(parentNode != NULL && parentNode->color == JRBTREE_SLOT_COLOR) return JRBTreeRadixGetNext(parentNode);
+	return parentNode;
+}
+
+/**
+ * @fn JNodePtr JNodeGetPrevious(const JNodePtr node)
+ * @brief 중위 순회 기준으로 지정한 노드의 이전 노드를 반환하는 함수
+ * @param node 기준 노드(입력, 읽기 전용)
+ * @return 성공 시 이전 노드의 주소, 이전 노드가 없으면 NULL 반환
+ */
+JNodePtr JNodeGetPrevious(const JNodePtr node)
+{
+	if(node == NULL) return NULL;
+	if(node->color == JRBTREE_LIST_COLOR) return node->left;
+	if(node->left != NULL) return JNodeGetRightmost(node->left);
+
+	JNodePtr currentNode = node;
+	JNodePtr parentNode = node->parent;
+	while((parentNode != NULL) && (parentNode->left == currentNode))
+	{
+		currentNode = parentNode;
+		parentNode = parentNode->parent;
+	}
+	if(parentNode != NULL && parentNode->color == JRBTREE_SLOT_COLOR) return JRBTreeRadixGetPrevious(parentNode);
+	return parentNode;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Functions for JRBTree
 ///////////////////////////////////////////////////////////////////////////////
@@ -122,13 +177,101 @@ JRBTreePtr NewJRBTree(KeyType type)
 	newTree->type = type;
 	newTree->root = NULL;
 	newTree->data = NULL;
+	newTree->size = 0;
+	newTree->leftmost = NULL;
+	newTree->rightmost = NULL;
+	newTree->multiset = 0;
+	newTree->interval = 0;
+	newTree->aggregateSize = 0;
+	newTree->aggregateCombine = NULL;
+	memset(&(newTree->counters), 0, sizeof(JRBTreeCounters));
+	newTree->keyDestructor = NULL;
+	newTree->keyArena = NULL;
+	newTree->nodeArena = NULL;
+	newTree->freeNodes = NULL;
+	newTree->bplus = NULL;
+	newTree->hotCache = NULL;
+	newTree->hashIndex = NULL;
+	newTree->radix = NULL;
+
+	return newTree;
+}
+
+/**
+ * @fn JRBTreePtr NewJRBTreeMultiset(KeyType type)
+ * @brief 같은 값의 키를 여러 개 저장할 수 있는 RB Tree 구조체 객체를 생성하는 함수
+ * 같은 값의 키는 인접한 노드로 추가한 순서대로 저장된다. (같은 키 주소도 다시 추가할 수 있음)
+ * 검색과 삭제는 같은 값의 노드들 중에서 키 주소가 같은 노드를 찾는다. (O(log n + k))
+ * @param type 저장할 키 데이터 유형(입력)
+ * @return 성공 시 생성된 RB Tree 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JRBTreePtr NewJRBTreeMultiset(KeyType type)
+{
+	JRBTreePtr newTree = NewJRBTree(type);
+	if(newTree == NULL) return NULL;
+
+	newTree->multiset = 1;
+	return newTree;
+}
+
+/**
+ * @fn JRBTreePtr NewJRBTreeOwned(KeyType type)
+ * @brief 키를 복사해서 소유하는 RB Tree 구조체 객체를 생성하는 함수
+ * 추가할 때 키의 값(StringType 은 널 문자까지)을 트리 내부 arena 에 복사하므로 호출한 쪽은 키를 바로 해제해도 된다.
+ * 노드도 arena 에서 청크 단위로 할당하므로 DeleteJRBTree 는 노드를 방문하지 않고 청크들만 해제한다.
+ * 키 주소가 아니라 값으로 검색/삭제하며(복사본의 주소는 호출한 쪽이 모르므로), 같은 값의 키는 하나만 저장한다.
+ * 삭제된 노드는 재사용되지만 키 복사본의 공간은 DeleteJRBTree 까지 유지된다.
+ * @param type 저장할 키 데이터 유형(입력)
+ * @return 성공 시 생성된 RB Tree 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JRBTreePtr NewJRBTreeOwned(KeyType type)
+{
+	JRBTreePtr newTree = NewJRBTree(type);
+	if(newTree == NULL) return NULL;
+
+	// 키 복사본 바로 뒤에 노드를 할당하도록 같은 arena 를 사용한다. (검색할 때 노드와 키가 가까이 있음)
+	newTree->keyArena = NewJRBTreeArena(0);
+	newTree->nodeArena = newTree->keyArena;
+	if(newTree->keyArena == NULL)
+	{
+		DeleteJRBTree(&newTree);
+		return NULL;
+	}
+	return newTree;
+}
+
+/**
+ * @fn JRBTreePtr NewJRBTreeWithEngine(KeyType type, JRBTreeEngine engine)
+ * @brief 키 순서를 관리하는 엔진을 지정해서 RB Tree 구조체 객체를 생성하는 함수
+ * EngineBPlus 는 노드 한 개에 키 16 개(캐시 라인 하나)를 저장하고 리프를 연결한 B+ Tree 로 키 순서를 관리한다. (src/jrbtree_bplus.c 참고)
+ * 키마다 JNode 를 할당하므로 추가/검색/삭제 함수, JNode 를 반환하는 함수와 JNodeGetNext 순회는 엔진과 상관없이 같은 의미로 동작한다.
+ * (키 주소로 검색/삭제하고, 같은 키 주소는 한 번만 저장)
+ * JRBTreeDump, JRBTreePrintAll 은 RB Tree 모양을 출력하므로 B+ Tree 엔진에서는 아무 노드도 출력하지 않는다.
+ * @param type 저장할 키 데이터 유형(입력)
+ * @param engine 엔진(입력, JRBTreeEngine 열거형 참고)
+ * @return 성공 시 생성된 RB Tree 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JRBTreePtr NewJRBTreeWithEngine(KeyType type, JRBTreeEngine engine)
+{
+	if(engine != EngineRedBlack && engine != EngineBPlus) return NULL;
+
+	JRBTreePtr newTree = NewJRBTree(type);
+	if(newTree == NULL || engine == EngineRedBlack) return newTree;
 
+	newTree->bplus = NewJRBTreeBPlus(type);
+	if(newTree->bplus == NULL)
+	{
+		DeleteJRBTree(&newTree);
+		return NULL;
+	}
 	return newTree;
 }
 
 /**
  * @fn DeleteResult DeleteJRBTree(JRBTreePtrContainer container)
  * @brief RB Tree 구조체 객체를 삭제하는 함수
+ * 키 소멸자가 지정되어 있으면 노드를 해제하면서 같은 순회에서 키도 해제한다.
+ * NewJRBTreeOwned 로 생성한 경우 노드와 키 복사본을 arena 청크 단위로 한 번에 해제한다.
  * @param container RB Tree 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
  * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
  */
@@ -136,12 +279,24 @@ DeleteResult DeleteJRBTree(JRBTreePtrContainer container)
 {
 	if(container == NULL || *container == NULL) return DeleteFail;
 
-	JNodePtr rootNode = (*container)->root;
-	if(rootNode != NULL)
+	JRBTreePtr tree = *container;
+	// 모든 노드를 해제하므로 노드마다 캐시 칸과 색인을 갱신하지 않도록 먼저 삭제한다.
+	DeleteJRBTreeHotCache(&(tree->hotCache));
+	DeleteJRBTreeHashIndex(&(tree->hashIndex));
+	if(tree->bplus != NULL)
+	{
+		JRBTreeBPlusReleaseNodes(tree);
+		DeleteJRBTreeBPlus(&(tree->bplus));
+	}
+	if(tree->radix != NULL)
 	{
-		JNodeDeleteChilds(rootNode);
-		free(rootNode);
+		JRBTreeRadixReleaseNodes(tree);
+		DeleteJRBTreeRadixTable(&(tree->radix));
 	}
+	// arena 의 노드는 청크 단위로 해제하므로 키 소멸자가 있을 때만 노드를 순회한다.
+	if(tree->nodeArena == NULL || tree->keyDestructor != NULL) JRBTreeReleaseNodes(tree, tree->root);
+	if(tree->keyArena != NULL && tree->keyArena != tree->nodeArena) DeleteJRBTreeArena(&(tree->keyArena));
+	if(tree->nodeArena != NULL) DeleteJRBTreeArena(&(tree->nodeArena));
 
 	free(*container);
 	*container = NULL;
@@ -149,6 +304,23 @@ DeleteResult DeleteJRBTree(JRBTreePtrContainer container)
 	return DeleteSuccess;
 }
 
+/**
+ * @fn JRBTreePtr JRBTreeSetKeyDestructor(JRBTreePtr tree, JRBTreeKeyDestructor destructor)
+ * @brief 노드가 삭제될 때 키를 해제하는 함수를 지정하는 함수
+ * JRBTreeDeleteNodeByKey, JRBTreeDeleteRange, JRBTreeTruncateBelow, DeleteJRBTree 에서 삭제되는 노드의 키마다 호출된다.
+ * JRBTreePopMin 은 키를 반환하므로 호출하지 않는다.
+ * NewJRBTreeOwned 로 생성한 트리는 키를 직접 소유하므로 지정할 수 없다.
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param destructor 키 소멸자(입력, NULL 이면 키를 해제하지 않음, 예: free)
+ * @return 성공 시 RB Tree 구조체의 주소, 실패 시 NULL 반환
+ */
+JRBTreePtr JRBTreeSetKeyDestructor(JRBTreePtr tree, JRBTreeKeyDestructor destructor)
+{
+	if(tree == NULL || tree->keyArena != NULL) return NULL;
+	tree->keyDestructor = destructor;
+	return tree;
+}
+
 /**
  * @fn void* JRBTreeGetData(const JRBTreePtr tree)
  * @brief RB Tree에 저장된 데이터의 주소를 반환하는 함수
@@ -178,7 +350,7 @@ void* JRBTreeSetData(JRBTreePtr tree, void *data)
 /**
  * @fn JRBTreePtr JRBTreeInsertNode(JRBTreePtr tree, void *key)
  * @brief RB Tree에 새로운 노드를 추가하는 함수
- * 중복 허용하지 않음
+ * 중복 허용하지 않음 (multiset 이면 허용, 같은 값의 키 중 가장 뒤에 추가)
  * @param tree RB Tree 구조체 객체의 주소(출력)
  * @param key 저장할 노드의 키 주소(입력)
  * @return 성공 시 RB Tree 구조체의 주소, 실패 시 NULL 반환
@@ -186,111 +358,32 @@ void* JRBTreeSetData(JRBTreePtr tree, void *data)
 JRBTreePtr JRBTreeInsertNode(JRBTreePtr tree, void *key)
 {
 	if((tree == NULL || key == NULL)) return NULL;
-
-	JNodePtr parentNode = NULL;
-	JNodePtr currentNode = tree->root;
-
-	// 추가할 노드의 위치를 검색
-	while(currentNode != NULL)
-	{
-		if(key == currentNode->key) return NULL;
-
-		parentNode = currentNode;
-		currentNode = JNodeMove(currentNode, key, tree->type);
-	}
-
-	// 지정한 키를 저장할 새로운 노드 생성
-	JNodePtr newNode = NewJNode();
-	if(JNodeSetKey(newNode, key) == NULL) return NULL;
-
-	// 첫 노드가 아니면 자식 노드 추가
-	if(parentNode != NULL)
-	{
-		if(JRBTreeSetChildNode(tree, parentNode, newNode) == NULL)
-		{
-				DeleteJNode(&newNode);
-				return NULL;
-		}
-
-		newNode->color = Red;
-
-		JNodePtr grandParentNode = JNodeGetGrandParent(newNode);
-		if(grandParentNode != NULL)
-		{
-			JNodePtr parentNode = newNode->parent;
-			JNodePtr uncleNode = JNodeGetUncle(newNode);
-
-			// case 1) 부모와 삼촌 노드가 모두 R 인 경우
-			if((parentNode->color == Red) && (uncleNode != NULL) && (uncleNode->color == Red))
-			{
-				parentNode->color = Black;
-				uncleNode->color = Black;
-				if(grandParentNode != tree->root) grandParentNode->color = Red;
-			}
-			// case 2) 부모 노드는 R 이고 삼촌 노드가 없거나 B 인 경우
-			else if((parentNode->color == Red) && ((uncleNode == NULL) || (uncleNode != NULL) && (uncleNode->color == Black)))
-			{
-				JNodePtr _newNode = newNode;
-
-				// case 2-1) 추가할 자식 노드가 부모 노드의 오른쪽인 경우
-				if(_newNode == parentNode->right)
-				{
-					// case 2-1-1)
-					// 부모 노드가 조부모 노드의 오른쪽인 경우
-					// 조부모 노드를 기준으로 왼쪽으로 회전한다.
-					if((grandParentNode->right == parentNode))
-					{
-						parentNode->color = Black;
-						grandParentNode->color = Red;
-						grandParentNode = JNodeLeftRotate(grandParentNode);
-						tree->root = JNodeSetParentPtr(grandParentNode);
-					}
-					// case 2-1-2)
-					// 부모 노드가 조부모 노드의 왼쪽인 경우
-					// 부모 노드를 기준으로 왼쪽으로 회전한다. -> case 2-2-2)
-					else if((grandParentNode->left == parentNode))
-					{
-						_newNode = parentNode;
-						parentNode = JNodeLeftRotate(parentNode);
-					}
-				}
-
-				// case 2-2) 추가할 자식 노드가 부모 노드의 왼쪽인 경우
-				// 자식 노드와 부모 노드를 검은색으로 변경하고, (루트 노드가 아닌)조부모 노드를 빨간색으로 변경하고 조부모 노드를 기준으로 방향에 맞게 회전한다.
-				if(_newNode == parentNode->left)
-				{
-					// 노드 색 변경
-					_newNode->color = Red;
-					parentNode->color = Black;
-					if(grandParentNode != tree->root) grandParentNode->color = Red;
-
-					// case 2-2-1)
-					// 부모 노드가 조부모 노드의 오른쪽 자식인 경우
-					// 부모 노드를 기준으로 오른쪽 회전 후, 조부모 노드를 기준으로 왼쪽 회전
-					if(grandParentNode->right == parentNode)
-					{
-						parentNode = JNodeRightRotate(parentNode);
-						grandParentNode = JNodeLeftRotate(grandParentNode);
-					}
-					// case 2-2-2)
-					// 부모 노드가 조부모 노드의 왼쪽 자식인 경우
-					// 조부모 노드를 기준으로 오른쪽 회전
-					else
-					{
-						grandParentNode = JNodeRightRotate(grandParentNode);
-					}
-					tree->root = JNodeSetParentPtr(grandParentNode);
-				}
-			}
-		}
-	}
-	// 첫 노드이면 루트 노드에 추가
-	else tree->root = newNode;
-
-	tree->root->color = Black;
+	if(tree->bplus != NULL) return (JRBTreeBPlusInsert(tree, key) != NULL) ? tree : NULL;
+	if(tree->radix != NULL) return (JRBTreeInsertRadix(tree, key) != NULL) ? tree : NULL;
+	if(JRBTreeInsertBelow(tree, tree->root, key) == NULL) return NULL;
 	return tree;
 }
 
+/**
+ * @fn JNodePtr JRBTreeInsertHint(JRBTreePtr tree, void *key, const JNodePtr hint)
+ * @brief 지정한 노드(hint) 근처에서 위치를 찾아 새로운 노드를 추가하는 함수 (finger search)
+ * 루트 노드부터 내려가지 않고 hint 에서 부모 노드 주소를 따라 키가 들어갈 서브 트리까지만 올라간 후 내려간다.
+ * hint 와 추가할 위치의 거리가 d 이면 O(log d) 이고, 반환된 노드를 다음 hint 로 사용하면
+ * 정렬된 순서(또는 거의 정렬된 순서)로 추가할 때 분할 상환 O(1) 이다.
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param key 저장할 노드의 키 주소(입력)
+ * @param hint 검색을 시작할 노드, 반드시 tree 에 속한 노드여야 하며 NULL 이면 루트 노드부터 검색(입력, 읽기 전용)
+ * @return 성공 시 추가된 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JRBTreeInsertHint(JRBTreePtr tree, void *key, const JNodePtr hint)
+{
+	if((tree == NULL || key == NULL)) return NULL;
+	// B+ Tree 엔진은 높이가 낮으므로 hint 를 사용하지 않고 루트 노드부터 검색한다. (radix 표도 칸에서 바로 시작)
+	if(tree->bplus != NULL) return JRBTreeBPlusInsert(tree, key);
+	if(tree->radix != NULL) return JRBTreeInsertRadix(tree, key);
+	return JRBTreeInsertBelow(tree, JRBTreeGetSearchRoot(tree, hint, key), key);
+}
+
 /**
  * @fn DeleteResult JRBTreeDeleteNodeByKey(JRBTreePtr tree, void *key)
  * @brief RB Tree에 지정한 키를 가진 노드를 삭제하는 함수
@@ -303,297 +396,709 @@ DeleteResult JRBTreeDeleteNodeByKey(JRBTreePtr tree, void *key)
 	JNodePtr selectedNode = JRBTreeFindNodeByKey(tree, key);
 	if(selectedNode == NULL) return DeleteFail;
 
-	DeleteResult result = DeleteSuccess;
+	JRBTreeRemoveNode(tree, selectedNode);
+	if(tree->keyDestructor != NULL) tree->keyDestructor(selectedNode->key);
+	JRBTreeFreeNode(tree, selectedNode);
+	return DeleteSuccess;
+}
+
+/**
+ * @fn JNodePtr JRBTreeFindNodeByKey(const JRBTreePtr tree, void *key)
+ * @brief RB Tree에서 지정한 키를 가진 노드를 검색하는 함수
+ * 해시 색인(JRBTreeSetHashIndex)이 있으면 트리를 내려가지 않고 색인에서 찾는다.
+ * 검색 캐시(JRBTreeSetHotCache)가 있으면 먼저 키 주소의 캐시 칸을 확인하고, 없으면 트리에서 찾는다.
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키의 주소(입력)
+ * @return 성공 시 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JRBTreeFindNodeByKey(const JRBTreePtr tree, void *key)
+{
+	if(tree == NULL || key == NULL) return NULL;
 
-	JNodePtr dummyNode = NewJNode();
-	if(dummyNode == NULL) return DeleteFail;
-	dummyNode->right = tree->root;
+	JRBTREE_STAT_ADD(tree, lookups, 1);
 
-	JNodePtr parentNode = selectedNode->parent;
-	JNodePtr currentNode = selectedNode;
+	if(tree->hashIndex != NULL) return JRBTreeHashIndexFind(tree->hashIndex, key);
+	if(tree->hotCache == NULL) return JRBTreeFindUncached(tree, key);
 
-	// 자식 노드가 없는 경우(최하위 노드)
-	if((selectedNode->left == NULL) && (selectedNode->right == NULL))
+	// 키 주소가 같으면 트리를 내려가지 않는다. (삭제된 노드는 JRBTreeRemoveNode 에서 칸을 비움)
+	JRBTreeHotSlotPtr slot = JRBTREE_HOT_SLOT(tree->hotCache, key);
+	if(slot->key == key)
 	{
-		if(parentNode->left == currentNode) parentNode->left = NULL;
-		else parentNode->right = NULL;
+		if(slot->hits < JRBTREE_HOT_MAX_HITS) slot->hits++;
+		return slot->node;
 	}
-	// 자식 노드가 하나밖에 없는 경우
-	else if((selectedNode->left == NULL) || (selectedNode->right == NULL))
-	{
-		// child node of selected node
-		JNodePtr parentNode = selectedNode->parent;
-		JNodePtr scNode = NULL;
-
-		if(selectedNode->left != NULL) scNode = selectedNode->left;
-		else scNode = selectedNode->right;
-
-		if(parentNode->left == selectedNode) parentNode->left = scNode;
-		else parentNode->right = scNode;
 
-		scNode->parent = parentNode;
-
-		// Black 노드 삭제 시 Double Red 문제 발생
-		// 삭제할 노드가 Black 이고 부모 노드가 Red 이면, 자식 노드를 Black 으로 바꾼다.
-		if((selectedNode->color == Black) && (parentNode->color == Red))
-		{
-			if(scNode->color != Black) scNode->color = Black;
-		}
-	}
-	// 자식 노드가 두 개 다 있는 경우
-	else if((selectedNode->left != NULL) && (selectedNode->right != NULL))
+	// 같은 칸을 쓰는 다른 키가 검색될 때마다 횟수를 줄이고, 0 이 된 후에 새 키로 바꾼다.
+	JNodePtr foundNode = JRBTreeFindUncached(tree, key);
+	if(slot->hits > 0) slot->hits--;
+	else if(foundNode != NULL)
 	{
-		// child node of selected node
-		JNodePtr scNode = selectedNode->right;
-		// parent node of child node of selected node
-		JNodePtr spNode = selectedNode;
+		slot->key = key;
+		slot->node = foundNode;
+		slot->hits = 1;
+	}
+	return foundNode;
+}
 
-		while(scNode->left != NULL)
-		{
-			spNode = scNode;
-			scNode = scNode->left;
-		}
+/**
+ * @fn JNodePtr JRBTreeFindFrom(const JRBTreePtr tree, const JNodePtr hint, void *key)
+ * @brief 지정한 노드(hint) 근처부터 지정한 키를 가진 노드를 검색하는 함수 (finger search)
+ * hint 와 찾는 노드의 거리가 d 이면 O(log d) 이다. (JRBTreeInsertHint 참고)
+ * multiset 이거나 키를 복사해서 저장하거나 B+ Tree 엔진이나 radix 표를 사용하는 경우 JRBTreeFindNodeByKey 와 같다.
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param hint 검색을 시작할 노드, 반드시 tree 에 속한 노드여야 하며 NULL 이면 루트 노드부터 검색(입력, 읽기 전용)
+ * @param key 검색할 키의 주소(입력)
+ * @return 성공 시 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JRBTreeFindFrom(const JRBTreePtr tree, const JNodePtr hint, void *key)
+{
+	if(tree == NULL || key == NULL) return NULL;
+	if(tree->multiset == 1 || tree->keyArena != NULL || tree->bplus != NULL || tree->radix != NULL) return JRBTreeFindNodeByKey(tree, key);
 
-		void *tempKey = scNode->key;
+	JRBTREE_STAT_ADD(tree, lookups, 1);
+	return JRBTreeFindBelow(tree, JRBTreeGetSearchRoot(tree, hint, key), key);
+}
 
-		if(spNode->left == scNode) spNode->left = scNode->right;
-		else spNode->right = scNode->right;
+/**
+ * @fn JNodePtr JRBTreeLowerBound(const JRBTreePtr tree, void *key)
+ * @brief RB Tree 에서 지정한 키의 값 이상인 첫 번째 노드를 검색하는 함수
+ * 키 주소가 아니라 값으로 비교한다.
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키의 주소(입력)
+ * @return 성공 시 노드의 주소, 없거나 실패 시 NULL 반환
+ */
+JNodePtr JRBTreeLowerBound(const JRBTreePtr tree, void *key)
+{
+	if(tree == NULL || key == NULL) return NULL;
+	if(tree->bplus != NULL) return JRBTreeBPlusBound(tree->bplus, key, 0);
+	if(tree->radix != NULL) return JRBTreeRadixBound(tree, key, 0);
 
-		// 대체 노드가 Black 이고, 대체 노드의 오른쪽 노드와 삭제할 노드가 Red 인 경우
-		// Black height 조건을 성립시키기 위해 대체 노드의 오른쪽 노드를 Black 으로 바꾼다.
-		if((scNode->right != NULL) && (scNode->right->color == Red) && (selectedNode->color == Red))
+	JNodePtr resultNode = NULL;
+	JNodePtr currentNode = tree->root;
+	int moveCount = 0;
+	while(currentNode != NULL)
+	{
+		if(JNodeCompareKeyInline(currentNode->key, key, tree->type) >= 0)
 		{
-			scNode->right->color = Black;
+			resultNode = currentNode;
+			currentNode = currentNode->left;
 		}
-
-		JNodeSetKey(selectedNode, tempKey);
-		selectedNode = scNode;
+		else currentNode = currentNode->right;
+		moveCount++;
 	}
 
-	// 루트 노드 삭제 시 변경된 다른 노드로 바꾼다.
-	if(dummyNode->right != tree->root) tree->root = dummyNode->right;
-
-	DeleteJNode(&selectedNode);
-	DeleteJNode(&dummyNode);
-	
-	return result;
+	JRBTREE_STAT_ADD(tree, comparisons, moveCount);
+	return resultNode;
 }
 
 /**
- * @fn JNodePtr JRBTreeFindNodeByKey(const JRBTreePtr tree, void *key)
- * @brief RB Tree에서 지정한 키를 가진 노드를 검색하는 함수
+ * @fn JNodePtr JRBTreeUpperBound(const JRBTreePtr tree, void *key)
+ * @brief RB Tree 에서 지정한 키의 값보다 큰 첫 번째 노드를 검색하는 함수
+ * 키 주소가 아니라 값으로 비교한다.
  * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
  * @param key 검색할 키의 주소(입력)
- * @return 성공 시 노드의 주소, 실패 시 NULL 반환
+ * @return 성공 시 노드의 주소, 없거나 실패 시 NULL 반환
  */
-JNodePtr JRBTreeFindNodeByKey(const JRBTreePtr tree, void *key)
+JNodePtr JRBTreeUpperBound(const JRBTreePtr tree, void *key)
 {
 	if(tree == NULL || key == NULL) return NULL;
+	if(tree->bplus != NULL) return JRBTreeBPlusBound(tree->bplus, key, 1);
+	if(tree->radix != NULL) return JRBTreeRadixBound(tree, key, 1);
 
+	JNodePtr resultNode = NULL;
 	JNodePtr currentNode = tree->root;
-	while((currentNode != NULL) && (key != currentNode->key))
+	int moveCount = 0;
+	while(currentNode != NULL)
 	{
-		currentNode = JNodeMove(currentNode, key, tree->type);
+		if(JNodeCompareKeyInline(currentNode->key, key, tree->type) > 0)
+		{
+			resultNode = currentNode;
+			currentNode = currentNode->left;
+		}
+		else currentNode = currentNode->right;
+		moveCount++;
 	}
 
-	return currentNode;
+	JRBTREE_STAT_ADD(tree, comparisons, moveCount);
+	return resultNode;
 }
 
 /**
- * @fn void JRBTreePrintAll(const JRBTreePtr tree)
- * @brief RB Tree 에 저장된 모든 노드들의 키를 출력하는 함수
+ * @fn size_t JRBTreeCount(const JRBTreePtr tree, void *key)
+ * @brief RB Tree 에서 지정한 키와 값이 같은 노드의 개수를 반환하는 함수 (O(log n + k))
  * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
- * @return 반환값 없음
+ * @param key 검색할 키의 주소(입력)
+ * @return 성공 시 노드 개수, 실패 시 0 반환
  */
-void JRBTreePrintAll(const JRBTreePtr tree)
+size_t JRBTreeCount(const JRBTreePtr tree, void *key)
 {
-	if(tree == NULL) return;
-	JRBTreePrintHeight(tree->root, 1, tree->type, 'B');
+	size_t count = 0;
+	JNodePtr currentNode = JRBTreeLowerBound(tree, key);
+	for( ; currentNode != NULL; currentNode = JNodeGetNext(currentNode))
+	{
+		if(JNodeCompareKeyInline(currentNode->key, key, tree->type) != 0) break;
+		count++;
+	}
+	return count;
 }
 
-////////////////////////////////////////////////////////////////////////////////
-/// JNode Static Functions
-////////////////////////////////////////////////////////////////////////////////
-
 /**
- * @fn static JNodePtr JNodeRightRotate(JNodePtr node)
- * @brief 지정한 노드를 기준으로 오른쪽으로 회전하는 함수
- * @param node 회전하기 위한 기준 노드(입력, 읽기 전용) 
- * @return 성공 시 회전된 기준 노드, 실패 시 NULL 반환
+ * @fn JNodePtr JRBTreeEqualRange(const JRBTreePtr tree, void *key, JNodePtrContainer end)
+ * @brief RB Tree 에서 지정한 키와 값이 같은 노드들의 범위를 반환하는 함수
+ * 반환된 노드부터 JNodeGetNext 로 end 전까지 순회하면 같은 값의 노드들을 추가한 순서대로 방문한다.
+ * 예) for(node = JRBTreeEqualRange(tree, key, &end); node != end; node = JNodeGetNext(node))
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키의 주소(입력)
+ * @param end 범위 다음 노드의 주소를 저장할 컨테이너 변수, 범위가 트리 끝까지면 NULL(출력)
+ * @return 성공 시 범위의 첫 번째 노드 주소, 같은 값이 없으면 *end 와 같은 주소, 실패 시 NULL 반환
  */
-static JNodePtr JNodeRightRotate(const JNodePtr node)
+JNodePtr JRBTreeEqualRange(const JRBTreePtr tree, void *key, JNodePtrContainer end)
 {
-	if(node == NULL) return NULL;
-
-	JNodePtr grandParentNode = node->parent;
-	JNodePtr parentNode = node;
-	JNodePtr currentNode = parentNode->left;
-
-	if(grandParentNode != NULL)
-	{
-		if(grandParentNode->right == parentNode) grandParentNode->right = currentNode;
-		else if(grandParentNode->left == parentNode) grandParentNode->left = currentNode;
-	}
-
-	if(currentNode != NULL)
-	{
-		parentNode->left = currentNode->right;
-		currentNode->right = parentNode;
-		currentNode->parent = grandParentNode;
-		parentNode->parent = currentNode;
-		return currentNode;
-	}
+	if(tree == NULL || key == NULL || end == NULL) return NULL;
 
-	return node;
+	*end = JRBTreeUpperBound(tree, key);
+	return JRBTreeLowerBound(tree, key);
 }
 
 /**
- * @fn static JNodePtr JNodeLeftRotate(const JNodePtr node)
- * @brief 지정한 노드를 기준으로 왼쪽으로 회전하는 함수
- * @param node 회전하기 위한 기준 노드(입력, 읽기 전용) 
- * @return 성공 시 회전된 기준 노드, 실패 시 NULL 반환
+ * @fn JRBTreeStatsPtr JRBTreeGetStats(const JRBTreePtr tree, JRBTreeStatsPtr stats)
+ * @brief RB Tree 의 현재 상태(노드 개수, 높이, Black height, 메모리)와 누적 카운터를 반환하는 함수
+ * 현재 상태는 호출할 때마다 전체 노드를 한 번 순회(재귀 없음)해서 계산한다.
+ * 누적 카운터는 JRBTREE_STATS 로 빌드한 경우에만 증가하고, 아니면 항상 0 이다.
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param stats 통계를 저장할 구조체 객체의 주소(출력)
+ * @return 성공 시 stats, 실패 시 NULL 반환
  */
-static JNodePtr JNodeLeftRotate(const JNodePtr node)
+JRBTreeStatsPtr JRBTreeGetStats(const JRBTreePtr tree, JRBTreeStatsPtr stats)
 {
-	if(node == NULL) return NULL;
+	if(tree == NULL || stats == NULL) return NULL;
 
-	JNodePtr grandParentNode = node->parent;
-	JNodePtr parentNode = node;
-	JNodePtr currentNode = parentNode->right;
+	memset(stats, 0, sizeof(JRBTreeStats));
+	stats->counters = tree->counters;
 
-	if(grandParentNode != NULL)
+	// B+ Tree 엔진은 높이를 B+ Tree 높이로, Black height 는 0 으로 반환한다.
+	if(tree->bplus != NULL)
 	{
-		if(grandParentNode->right == parentNode) grandParentNode->right = currentNode;
-		else grandParentNode->left = currentNode;
+		stats->nodeCount = tree->size;
+		stats->height = tree->bplus->height;
+		stats->allocatedBytes = sizeof(JRBTree) + tree->size * sizeof(JNode) + JRBTreeBPlusGetBytes(tree->bplus) + JRBTreeHotCacheGetBytes(tree->hotCache);
+		stats->allocatedBytes += JRBTreeHashIndexGetBytes(tree->hashIndex);
+		return stats;
 	}
 
-	if(currentNode != NULL)
+	// radix 표는 칸마다 서브 트리를 순회하고, 높이는 표 한 단계를 포함한다. (Black height 는 0)
+	if(tree->radix != NULL)
+	{
+		size_t slotIndex = 0;
+		for( ; slotIndex < tree->radix->slotCount; slotIndex++)
+		{
+			JNodePtr header = &(tree->radix->headers[slotIndex]);
+			if(header->key != NULL) JRBTreeAddSubtreeStats((JNodePtr)header->key, 1, stats);
+		}
+	}
+	else
 	{
-		parentNode->right = currentNode->left;
-		currentNode->left = parentNode;
-		currentNode->parent = grandParentNode;
-		parentNode->parent = currentNode;
-		return currentNode;
+		// 모든 외부 노드까지의 Black 노드 개수가 같으므로 가장 왼쪽 경로만 센다.
+		JNodePtr currentNode = tree->root;
+		for( ; currentNode != NULL; currentNode = currentNode->left)
+		{
+			if(currentNode->color == Black) stats->blackHeight++;
+		}
+		JRBTreeAddSubtreeStats(tree->root, 0, stats);
 	}
-	
-	return node;
+
+	if(tree->nodeArena != NULL) stats->allocatedBytes = sizeof(JRBTree) + JRBTreeArenaGetBytes(tree->nodeArena) + ((tree->keyArena != tree->nodeArena) ? JRBTreeArenaGetBytes(tree->keyArena) : 0);
+	else stats->allocatedBytes = sizeof(JRBTree) + stats->nodeCount * (sizeof(JNode) + tree->aggregateSize);
+	stats->allocatedBytes += JRBTreeHotCacheGetBytes(tree->hotCache);
+	stats->allocatedBytes += JRBTreeHashIndexGetBytes(tree->hashIndex);
+	stats->allocatedBytes += JRBTreeRadixGetBytes(tree->radix);
+	return stats;
 }
 
 /**
- * @fn static void JNodeDeleteChilds(JNodePtr node)
- * @brief RB Tree 에 저장된 노드들을 모두 삭제하는 함수(재귀)
- * @param node 자식 노드들을 삭제하기 위한 기준 노드(입력)
- * @return 반환값 없음
+ * @fn size_t JRBTreeSize(const JRBTreePtr tree)
+ * @brief RB Tree 에 저장된 노드 개수를 반환하는 함수 (O(1))
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 노드 개수, 실패 시 0 반환
  */
-static void JNodeDeleteChilds(JNodePtr node)
+size_t JRBTreeSize(const JRBTreePtr tree)
 {
-	if(node == NULL) return;
-	
-	if(node->left != NULL)
-	{
-		JNodeDeleteChilds(node->left);
-		free(node->left);
-		node->left = NULL;
-	}
-
-	if(node->right != NULL)
-	{
-		JNodeDeleteChilds(node->right);
-		free(node->right);
-		node->right = NULL;
-	}
+	if(tree == NULL) return 0;
+	return tree->size;
 }
 
 /**
- * @fn static JNodePtr JNodeMove(JNodePtr node, void *key, KeyType type)
- * @brief 지정한 노드의 키와 전달받은 키를 비교해서 저장할 노드의 위치를 찾아 그 노드의 주소를 반환하는 함수 
- * JRBTreeInsertNode 와 JRBTreeFindNodeByKey 함수에서 호출되므로 매개변수 NULL 체크를 수행하지 않음
- * @param node 위치를 움직일 노드의 주소(입력)
- * @param key 전달받은 키(입력)
- * @param type 키의 데이터 유형(입력)
- * @return 성공 시 위치가 변경된 노드의 주소, 실패 시 NULL 반환
+ * @fn JNodePtr JRBTreeMin(const JRBTreePtr tree)
+ * @brief RB Tree 에서 가장 작은 키를 가진 노드를 반환하는 함수 (O(1))
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 노드의 주소, 비어 있거나 실패 시 NULL 반환
  */
-static JNodePtr JNodeMove(JNodePtr node, void *key, KeyType type)
+JNodePtr JRBTreeMin(const JRBTreePtr tree)
 {
-	switch(type)
-	{
-		case IntType:
-			if(*((int*)(node->key)) > *((int*)(key))) node = node->left;
-			else node = node->right;
-			break;
-		case CharType:
-			if(*((char*)(node->key)) > *((char*)(key))) node = node->left;
-			else node = node->right;
-			break;
-		case StringType:
-		{
-			if(strncmp((char*)(node->key), (char*)(key), _GetCompareLength((char*)(node->key), (char*)(key))) > 0) node = node->left;
-			else node = node->right;
-			break;
-		}
-		default: return NULL;
-	}
-	return node;
+	if(tree == NULL) return NULL;
+	return tree->leftmost;
 }
 
 /**
- * @fn static void JNodePrintKey(const JNodePtr node, KeyType type)
- * @brief 지정한 노드의 키를 출력하는 함수
- * @param node 출력할 노드의 주소(입력, 읽기 전용)
- * @param type 출력할 키의 데이터 유형(입력)
- * @return 반환값 없음
+ * @fn JNodePtr JRBTreeMax(const JRBTreePtr tree)
+ * @brief RB Tree 에서 가장 큰 키를 가진 노드를 반환하는 함수 (O(1))
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 노드의 주소, 비어 있거나 실패 시 NULL 반환
  */
-static void JNodePrintKey(const JNodePtr node, KeyType type)
+JNodePtr JRBTreeMax(const JRBTreePtr tree)
 {
-	if(node == NULL) return;
-	switch(type)
-	{
-		case IntType:
-			printf("%d(%c) ", *((int*)(node->key)), _NodeColorToChar(node->color));
-			break;
-		case CharType:
-			printf("%c(%c) ", *((char*)(node->key)), _NodeColorToChar(node->color));	
-			break;
-		case StringType:
-			printf("%s(%c) ", (char*)(node->key), _NodeColorToChar(node->color));
-			break;
-		default: return;
-	}
+	if(tree == NULL) return NULL;
+	return tree->rightmost;
 }
 
 /**
- * @fn static JNodePtr JNodeSetParentPtr(const JNodePtr node )
- * @brief 지정한 노드의 부모 노드에게 주소를 전달하는 함수(재귀)
- * @param node 주소를 전달할 노드(입력, 읽기 전용)
- * @return 반환값 없음
+ * @fn void* JRBTreePopMin(JRBTreePtr tree)
+ * @brief RB Tree 에서 가장 작은 키를 가진 노드를 삭제하고 그 키를 반환하는 함수
+ * 키 검색 없이 저장된 최소 노드를 바로 분리하므로 분할 상환 O(1) 이다. (우선순위 큐 용도)
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @return 성공 시 삭제된 노드의 키 주소, 비어 있거나 실패 시 NULL 반환
  */
-static JNodePtr JNodeSetParentPtr(const JNodePtr node)
+void* JRBTreePopMin(JRBTreePtr tree)
 {
-	if(node == NULL) return NULL;
-	if(node->parent == NULL) return node;
+	if(tree == NULL || tree->leftmost == NULL) return NULL;
+
+	JNodePtr minNode = tree->leftmost;
+	void *key = minNode->key;
 
-	if(node->parent->left == node) node->parent->left = node;
-	else if(node->parent->right == node) node->parent->right = node;
-	else return NULL;
+	JRBTreeRemoveNode(tree, minNode);
+	JRBTreeFreeNode(tree, minNode);
 
-	return JNodeSetParentPtr(node->parent);
+	return key;
 }
 
 /**
- * @fn static JNodePtr JNodeGetGrandParent(const JNodePtr node)
- * @brief 지정한 노드의 조부모 노드(node->parent->parent)를 반환하는 함수
- * @param node 조부모 노드를 반환할 노드(입력, 읽기 전용)
- * @return 성공 시 조부모 노드의 주소, 실패 시 NULL 반환
+ * @fn void JRBTreePrintAll(const JRBTreePtr tree)
+ * @brief RB Tree 에 저장된 모든 노드들의 키를 출력하는 함수
+ * 전위 순회 순서로 깊이만큼 들여써서 출력한다. (JRBTreeDump 의 텍스트 형식)
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 반환값 없음
  */
-static JNodePtr JNodeGetGrandParent(const JNodePtr node)
+void JRBTreePrintAll(const JRBTreePtr tree)
 {
-	if(node == NULL) return NULL;
-	JNodePtr parentNode = node->parent;
-	if(parentNode == NULL) return NULL;
-	return parentNode->parent;
+	if(tree == NULL) return;
+	JRBTreeDump(tree, stdout, NULL);
 }
 
-/**
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions (src/jrbtree_internal.h)
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JNodePtr JNodeGetLeftmost(const JNodePtr node)
+ * @brief 지정한 노드를 루트로 하는 서브 트리에서 가장 왼쪽(가장 작은 키)의 노드를 반환하는 함수
+ * @param node 서브 트리의 루트 노드(입력, 읽기 전용)
+ * @return 성공 시 가장 왼쪽 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JNodeGetLeftmost(const JNodePtr node)
+{
+	if(node == NULL) return NULL;
+
+	JNodePtr currentNode = node;
+	while(currentNode->left != NULL) currentNode = currentNode->left;
+	return currentNode;
+}
+
+/**
+ * @fn JNodePtr JNodeGetRightmost(const JNodePtr node)
+ * @brief 지정한 노드를 루트로 하는 서브 트리에서 가장 오른쪽(가장 큰 키)의 노드를 반환하는 함수
+ * @param node 서브 트리의 루트 노드(입력, 읽기 전용)
+ * @return 성공 시 가장 오른쪽 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JNodeGetRightmost(const JNodePtr node)
+{
+	if(node == NULL) return NULL;
+
+	JNodePtr currentNode = node;
+	while(currentNode->right != NULL) currentNode = currentNode->right;
+	return currentNode;
+}
+
+/**
+ * @fn size_t JRBTreeFormatInt(int value, char *buffer)
+ * @brief 정수를 10진수 문자열로 변환하는 함수 (널 문자 없음, printf 보다 빠름)
+ * @param value 변환할 정수(입력)
+ * @param buffer 변환된 문자열을 저장할 버퍼, 최소 11 bytes(출력)
+ * @return 항상 변환된 문자열 길이 반환
+ */
+size_t JRBTreeFormatInt(int value, char *buffer)
+{
+	char digits[16];
+	size_t digitCount = 0;
+	size_t length = 0;
+	unsigned int absolute = (value < 0) ? (0u - (unsigned int)value) : (unsigned int)value;
+
+	do
+	{
+		digits[digitCount++] = (char)('0' + (absolute % 10));
+		absolute /= 10;
+	} while(absolute > 0);
+
+	if(value < 0) buffer[length++] = '-';
+	while(digitCount > 0) buffer[length++] = digits[--digitCount];
+
+	return length;
+}
+
+/**
+ * @fn JNodePtr JRBTreeAllocNode(JRBTreePtr tree)
+ * @brief RB Tree 에 추가할 새로운 노드를 할당하는 함수
+ * 노드 arena 를 사용하면 삭제된 노드 목록이나 arena 에서, 아니면 NewJNode 로 할당한다.
+ * 집계 값을 저장하는 트리는 노드 뒤에 집계 값 크기만큼 더 할당한다. (JRBTreeFreeNode 는 그대로 free 로 해제)
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @return 성공 시 초기화된 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JRBTreeAllocNode(JRBTreePtr tree)
+{
+	JNodePtr newNode = NULL;
+	if(tree->nodeArena == NULL)
+	{
+		if(tree->aggregateSize == 0) return NewJNode();
+
+		// 집계 값은 같은 할당에서 노드 바로 뒤에 둔다. (JRBTREE_NODE_AGGREGATE)
+		newNode = (JNodePtr)malloc(sizeof(JNode) + tree->aggregateSize);
+		if(newNode == NULL) return NULL;
+	}
+	else
+	{
+		newNode = tree->freeNodes;
+		if(newNode != NULL) tree->freeNodes = newNode->right;
+		else
+		{
+			newNode = (JNodePtr)JRBTreeArenaAlloc(tree->nodeArena, sizeof(JNode), sizeof(void*));
+			if(newNode == NULL) return NULL;
+		}
+	}
+
+	newNode->color = Black;
+	newNode->parent = NULL;
+	newNode->left = NULL;
+	newNode->right = NULL;
+	newNode->key = NULL;
+	return newNode;
+}
+
+/**
+ * @fn void JRBTreeFreeNode(JRBTreePtr tree, JNodePtr node)
+ * @brief JRBTreeAllocNode 로 할당한 노드를 해제하는 함수 (키는 해제하지 않음)
+ * 노드 arena 를 사용하면 삭제된 노드 목록에 넣어서 재사용한다.
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param node 해제할 노드, 트리에서 분리된 노드여야 한다.(입력)
+ * @return 반환값 없음
+ */
+void JRBTreeFreeNode(JRBTreePtr tree, JNodePtr node)
+{
+	if(tree->nodeArena == NULL)
+	{
+		free(node);
+		return;
+	}
+
+	node->right = tree->freeNodes;
+	tree->freeNodes = node;
+}
+
+/**
+ * @fn size_t JRBTreeReleaseNodes(JRBTreePtr tree, JNodePtr root)
+ * @brief 서브 트리의 모든 노드를 해제하는 함수 (재귀 없음)
+ * 왼쪽 자식 노드가 있으면 오른쪽으로 회전해서 왼쪽 자식 노드가 없는 노드부터 해제하고,
+ * 키 소멸자가 지정되어 있으면 같은 순회에서 키도 해제한다.
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param root 서브 트리의 루트 노드, 트리에서 분리된 노드여야 한다.(입력)
+ * @return 해제한 노드 개수 반환
+ */
+size_t JRBTreeReleaseNodes(JRBTreePtr tree, JNodePtr root)
+{
+	size_t count = 0;
+	JNodePtr currentNode = root;
+	while(currentNode != NULL)
+	{
+		if(currentNode->left != NULL)
+		{
+			JNodePtr leftNode = currentNode->left;
+			currentNode->left = leftNode->right;
+			leftNode->right = currentNode;
+			currentNode = leftNode;
+		}
+		else
+		{
+			JNodePtr rightNode = currentNode->right;
+			// 해제한 키의 주소가 다시 할당될 수 있으므로 캐시 칸도 비운다. (색인은 키 값으로 찾으므로 키를 해제하기 전에 삭제)
+			if(tree->hotCache != NULL) JRBTreeHotCacheRemove(tree->hotCache, currentNode);
+			if(tree->hashIndex != NULL) JRBTreeHashIndexRemove(tree->hashIndex, currentNode);
+			if(tree->keyDestructor != NULL) tree->keyDestructor(currentNode->key);
+			JRBTreeFreeNode(tree, currentNode);
+			currentNode = rightNode;
+			count++;
+		}
+	}
+	return count;
+}
+
+/**
+ * @fn void JRBTreeRemoveNode(JRBTreePtr tree, JNodePtr node)
+ * @brief RB Tree 에서 지정한 노드를 분리하는 함수(메모리는 해제하지 않음)
+ * 노드 개수와 최소(최대) 노드도 같이 갱신한다.
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param node 분리할 노드, 반드시 tree 에 속한 노드여야 한다.(입력)
+ * @return 반환값 없음
+ */
+void JRBTreeRemoveNode(JRBTreePtr tree, JNodePtr node)
+{
+	// 최소(최대) 노드가 삭제되면 다음(이전) 노드가 새로운 최소(최대) 노드가 된다.
+	// 노드를 옮겨도 다른 노드의 주소는 바뀌지 않으므로 분리하기 전에 갱신한다.
+	if(node == tree->leftmost) tree->leftmost = JNodeGetNext(node);
+	if(node == tree->rightmost) tree->rightmost = JNodeGetPrevious(node);
+	tree->size--;
+	if(tree->hotCache != NULL) JRBTreeHotCacheRemove(tree->hotCache, node);
+	if(tree->hashIndex != NULL) JRBTreeHashIndexRemove(tree->hashIndex, node);
+
+	if(tree->bplus != NULL) JRBTreeBPlusRemove(tree, node);
+	else if(tree->radix != NULL)
+	{
+		JNodePtr header = JRBTreeRadixGetHeader(tree->radix, node->key);
+		JRBTreeRadixDetach(tree, header);
+		JRBTreeUnlinkNode(tree, node);
+		JRBTreeRadixAttach(tree, header);
+	}
+	else JRBTreeUnlinkNode(tree, node);
+	JRBTREE_STAT_ADD(tree, deletes, 1);
+}
+
+/**
+ * @fn void JRBTreeUnlinkNode(JRBTreePtr tree, JNodePtr node)
+ * @brief tree->root 를 루트로 하는 트리에서 지정한 노드를 분리하고 RB Tree 조건을 복구하는 함수
+ * 자식 노드가 두 개인 경우 키를 복사하지 않고 후속 노드를 그 자리로 옮기므로,
+ * 삭제되지 않은 다른 노드의 주소와 키는 그대로 유지된다.
+ * 노드 개수와 최소(최대) 노드는 갱신하지 않는다. (분할/병합 중인 서브 트리에도 사용)
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param node 분리할 노드, 반드시 tree->root 아래에 있는 노드여야 한다.(입력)
+ * @return 반환값 없음
+ */
+void JRBTreeUnlinkNode(JRBTreePtr tree, JNodePtr node)
+{
+	JNodePtr childNode = NULL;
+	JNodePtr childParentNode = NULL;
+	NodeColor removedColor = node->color;
+
+	// 자식 노드가 하나 이하인 경우, 자식 노드를 삭제할 노드 자리로 올린다.
+	if(node->left == NULL)
+	{
+		childNode = node->right;
+		childParentNode = node->parent;
+		JRBTreeTransplant(tree, node, node->right);
+	}
+	else if(node->right == NULL)
+	{
+		childNode = node->left;
+		childParentNode = node->parent;
+		JRBTreeTransplant(tree, node, node->left);
+	}
+	// 자식 노드가 두 개 다 있는 경우, 후속 노드(오른쪽 서브 트리의 최소 노드)를 삭제할 노드 자리로 옮긴다.
+	else
+	{
+		JNodePtr successorNode = JNodeGetLeftmost(node->right);
+		removedColor = successorNode->color;
+		childNode = successorNode->right;
+
+		if(successorNode->parent == node) childParentNode = successorNode;
+		else
+		{
+			childParentNode = successorNode->parent;
+			JRBTreeTransplant(tree, successorNode, successorNode->right);
+			successorNode->right = node->right;
+			successorNode->right->parent = successorNode;
+		}
+
+		JRBTreeTransplant(tree, node, successorNode);
+		successorNode->left = node->left;
+		successorNode->left->parent = successorNode;
+		successorNode->color = node->color;
+	}
+
+	// 집계 값을 저장하는 트리는 Fixup 의 회전 전에 자식 노드가 바뀐 노드부터 루트 노드까지 다시 계산한다.
+	if(tree->aggregateCombine != NULL) JRBTreeAugmentUpdatePath(tree, childParentNode);
+
+	// Black 노드가 빠지면 Black height 조건이 깨지므로 복구한다.
+	if(removedColor == Black) JRBTreeDeleteFixup(tree, childNode, childParentNode);
+
+	node->parent = NULL;
+	node->left = NULL;
+	node->right = NULL;
+}
+
+/**
+ * @fn int JRBTreeInsertFixup(JRBTreePtr tree, JNodePtr node)
+ * @brief 새로 추가된 Red 노드 때문에 깨진 RB Tree 조건을 복구하는 함수
+ * 매개변수 NULL 체크를 수행하지 않음
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param node 새로 추가된 노드(입력)
+ * @return 루트 노드를 Black 으로 바꿔서 Black height 가 1 증가했으면 1, 아니면 0 반환
+ */
+int JRBTreeInsertFixup(JRBTreePtr tree, JNodePtr node)
+{
+	JNodePtr currentNode = node;
+
+	// 부모 노드가 Red 이면 Double Red 문제 발생
+	while((currentNode->parent != NULL) && (currentNode->parent->color == Red))
+	{
+		JNodePtr parentNode = currentNode->parent;
+		// 부모 노드가 Red 이므로 루트 노드가 아니고, 조부모 노드가 항상 존재한다.
+		JNodePtr grandParentNode = JNodeGetGrandParent(currentNode);
+		JNodePtr uncleNode = JNodeGetUncle(currentNode);
+
+		// case 1) 부모와 삼촌 노드가 모두 R 인 경우
+		// 부모와 삼촌 노드를 B 로, 조부모 노드를 R 로 바꾸고 조부모 노드에서 다시 검사한다.
+		if(JNodeIsBlack(uncleNode) == 0)
+		{
+			parentNode->color = Black;
+			uncleNode->color = Black;
+			grandParentNode->color = Red;
+			currentNode = grandParentNode;
+			continue;
+		}
+
+		// case 2) 부모 노드는 R 이고 삼촌 노드가 없거나 B 인 경우
+		if(parentNode == grandParentNode->left)
+		{
+			// case 2-1) 추가한 노드가 부모 노드의 오른쪽인 경우
+			// 부모 노드를 기준으로 왼쪽으로 회전한다. -> case 2-2)
+			if(currentNode == parentNode->right)
+			{
+				currentNode = parentNode;
+				parentNode = JNodeLeftRotate(tree, currentNode);
+			}
+
+			// case 2-2) 추가한 노드가 부모 노드의 왼쪽인 경우
+			// 부모 노드를 B 로, 조부모 노드를 R 로 바꾸고 조부모 노드를 기준으로 오른쪽으로 회전한다.
+			parentNode->color = Black;
+			grandParentNode->color = Red;
+			JNodeRightRotate(tree, grandParentNode);
+		}
+		else
+		{
+			// case 2-1) 의 반대 방향
+			if(currentNode == parentNode->left)
+			{
+				currentNode = parentNode;
+				parentNode = JNodeRightRotate(tree, currentNode);
+			}
+
+			// case 2-2) 의 반대 방향
+			parentNode->color = Black;
+			grandParentNode->color = Red;
+			JNodeLeftRotate(tree, grandParentNode);
+		}
+		break;
+	}
+
+	int isRootRed = (tree->root->color == Red);
+	tree->root->color = Black;
+	return isRootRed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// JNode Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static JNodePtr JNodeRightRotate(JRBTreePtr tree, const JNodePtr node)
+ * @brief 지정한 노드를 기준으로 오른쪽으로 회전하는 함수
+ * 회전으로 루트 노드가 바뀌면 RB Tree 의 루트 노드도 같이 변경한다.
+ * @param tree 회전할 노드가 속한 RB Tree 구조체 객체의 주소(출력)
+ * @param node 회전하기 위한 기준 노드(입력, 읽기 전용) 
+ * @return 성공 시 회전된 기준 노드, 실패 시 NULL 반환
+ */
+static JNodePtr JNodeRightRotate(JRBTreePtr tree, const JNodePtr node)
+{
+	if(node == NULL) return NULL;
+
+	JNodePtr grandParentNode = node->parent;
+	JNodePtr parentNode = node;
+	JNodePtr currentNode = parentNode->left;
+
+	if(currentNode == NULL) return node;
+
+	parentNode->left = currentNode->right;
+	if(currentNode->right != NULL) currentNode->right->parent = parentNode;
+
+	currentNode->parent = grandParentNode;
+	if(grandParentNode == NULL) tree->root = currentNode;
+	else if(grandParentNode->right == parentNode) grandParentNode->right = currentNode;
+	else grandParentNode->left = currentNode;
+
+	currentNode->right = parentNode;
+	parentNode->parent = currentNode;
+
+	// 집계 값은 내려간 노드, 올라간 노드 순서로 다시 계산한다.
+	if(tree->aggregateCombine != NULL)
+	{
+		JRBTreeAugmentUpdate(tree, parentNode);
+		JRBTreeAugmentUpdate(tree, currentNode);
+	}
+
+	JRBTREE_STAT_ADD(tree, rotations, 1);
+	return currentNode;
+}
+
+/**
+ * @fn static JNodePtr JNodeLeftRotate(JRBTreePtr tree, const JNodePtr node)
+ * @brief 지정한 노드를 기준으로 왼쪽으로 회전하는 함수
+ * 회전으로 루트 노드가 바뀌면 RB Tree 의 루트 노드도 같이 변경한다.
+ * @param tree 회전할 노드가 속한 RB Tree 구조체 객체의 주소(출력)
+ * @param node 회전하기 위한 기준 노드(입력, 읽기 전용) 
+ * @return 성공 시 회전된 기준 노드, 실패 시 NULL 반환
+ */
+static JNodePtr JNodeLeftRotate(JRBTreePtr tree, const JNodePtr node)
+{
+	if(node == NULL) return NULL;
+
+	JNodePtr grandParentNode = node->parent;
+	JNodePtr parentNode = node;
+	JNodePtr currentNode = parentNode->right;
+
+	if(currentNode == NULL) return node;
+
+	parentNode->right = currentNode->left;
+	if(currentNode->left != NULL) currentNode->left->parent = parentNode;
+
+	currentNode->parent = grandParentNode;
+	if(grandParentNode == NULL) tree->root = currentNode;
+	else if(grandParentNode->right == parentNode) grandParentNode->right = currentNode;
+	else grandParentNode->left = currentNode;
+
+	currentNode->left = parentNode;
+	parentNode->parent = currentNode;
+
+	if(tree->aggregateCombine != NULL)
+	{
+		JRBTreeAugmentUpdate(tree, parentNode);
+		JRBTreeAugmentUpdate(tree, currentNode);
+	}
+
+	JRBTREE_STAT_ADD(tree, rotations, 1);
+	return currentNode;
+}
+
+/**
+ * @fn static JNodePtr JNodeGetGrandParent(const JNodePtr node)
+ * @brief 지정한 노드의 조부모 노드(node->parent->parent)를 반환하는 함수
+ * @param node 조부모 노드를 반환할 노드(입력, 읽기 전용)
+ * @return 성공 시 조부모 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JNodeGetGrandParent(const JNodePtr node)
+{
+	if(node == NULL) return NULL;
+	JNodePtr parentNode = node->parent;
+	if(parentNode == NULL) return NULL;
+	return parentNode->parent;
+}
+
+/**
  * @fn static JNodePtr JNodeGetGrandParent(const JNodePtr node)
  * @brief 지정한 노드의 부모의 형제 노드(node->parent->other_child)를 반환하는 함수
  * @param node 부모의 형제 노드를 반환할 노드(입력, 읽기 전용)
@@ -608,33 +1113,410 @@ static JNodePtr JNodeGetUncle(const JNodePtr node)
 	return grandParentNode->right;
 }
 
+/**
+ * @fn static int JNodeIsBlack(const JNodePtr node)
+ * @brief 지정한 노드가 Black 인지 검사하는 함수
+ * 외부 노드(NULL)는 Black 으로 취급한다.
+ * @param node 검사할 노드(입력, 읽기 전용)
+ * @return Black 이면 1, Red 이면 0 반환
+ */
+static int JNodeIsBlack(const JNodePtr node)
+{
+	return (node == NULL) || (node->color == Black);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// JRBTree Static Functions
 ////////////////////////////////////////////////////////////////////////////////
 
 /**
- * @fn static void JRBTreePrintHeight(const JNodePtr node, int height, KeyType type, char position)
- * @brief RB Tree 에서 지정한 높이에 있는 노드들의 키를 모두 출력하는 함수(재귀)
- * @param node 지정한 높이의 부모 노드(입력, 읽기 전용)
- * @param height 출력할 높이(입력)
- * @param type 출력할 키의 데이터 유형(입력)
- * @param position 현재 노드의 위치를 알려주는 문자, 출력에 사용(입력)
+ * @fn static JNodePtr JRBTreeInsertBelow(JRBTreePtr tree, JNodePtr startNode, void *key)
+ * @brief 지정한 서브 트리 안에서 위치를 찾아 새로운 노드를 추가하고 RB Tree 조건을 복구하는 함수
+ * JRBTreeInsertNode 와 JRBTreeInsertHint 함수에서 호출되므로 매개변수 NULL 체크를 수행하지 않음
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param startNode 검색을 시작할 서브 트리의 루트 노드, 키가 들어갈 위치를 포함해야 한다.(입력)
+ * @param key 저장할 노드의 키 주소(입력)
+ * @return 성공 시 추가된 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JRBTreeInsertBelow(JRBTreePtr tree, JNodePtr startNode, void *key)
+{
+	JNodePtr parentNode = NULL;
+	JNodePtr currentNode = startNode;
+	int moveCount = 0;
+
+	// 추가할 노드의 위치를 검색
+	while(currentNode != NULL)
+	{
+		if((tree->multiset == 0) && ((key == currentNode->key) || ((tree->keyArena != NULL) && (JNodeCompareKeyInline(key, currentNode->key, tree->type) == 0))))
+		{
+			JRBTREE_STAT_ADD(tree, comparisons, moveCount);
+			return NULL;
+		}
+
+		parentNode = currentNode;
+		currentNode = JNodeMoveInline(currentNode, key, tree->type);
+		moveCount++;
+	}
+	JRBTREE_STAT_ADD(tree, comparisons, moveCount);
+
+	// 키를 소유하는 경우 arena 에 복사한다.
+	if(tree->keyArena != NULL)
+	{
+		size_t keySize = _GetKeySize(tree->type, key);
+		key = JRBTreeArenaCopy(tree->keyArena, key, keySize, (tree->type == IntType) ? sizeof(int) : 1);
+		if(key == NULL) return NULL;
+	}
+
+	// 지정한 키를 저장할 새로운 노드 생성
+	JNodePtr newNode = JRBTreeAllocNode(tree);
+	if(newNode == NULL) return NULL;
+	JNodeSetKey(newNode, key);
+
+	// 첫 노드가 아니면 자식 노드 추가
+	if(parentNode != NULL)
+	{
+		if(JRBTreeSetChildNode(tree, parentNode, newNode) == NULL)
+		{
+			JRBTreeFreeNode(tree, newNode);
+			return NULL;
+		}
+
+		// 기존 최소(최대) 노드의 왼쪽(오른쪽)에 추가된 경우에만 최소(최대) 노드가 바뀐다.
+		// 회전은 중위 순회 순서를 바꾸지 않으므로 Fixup 전에 갱신해도 된다.
+		if(parentNode == tree->leftmost && parentNode->left == newNode) tree->leftmost = newNode;
+		else if(parentNode == tree->rightmost && parentNode->right == newNode) tree->rightmost = newNode;
+
+		// 집계 값을 저장하는 트리는 Fixup 의 회전 전에 추가한 경로의 집계 값을 먼저 맞춘다.
+		if(tree->aggregateCombine != NULL) JRBTreeAugmentUpdatePath(tree, newNode);
+
+		newNode->color = Red;
+		JRBTreeInsertFixup(tree, newNode);
+	}
+	// 첫 노드이면 루트 노드에 추가
+	else
+	{
+		tree->root = newNode;
+		tree->leftmost = newNode;
+		tree->rightmost = newNode;
+		if(tree->aggregateCombine != NULL) JRBTreeAugmentUpdate(tree, newNode);
+	}
+
+	tree->root->color = Black;
+	tree->size++;
+	JRBTREE_STAT_ADD(tree, inserts, 1);
+
+	if(tree->hashIndex != NULL) JRBTreeHashIndexInsert(tree, newNode);
+	return newNode;
+}
+
+/**
+ * @fn static JNodePtr JRBTreeInsertRadix(JRBTreePtr tree, void *key)
+ * @brief radix 표에서 키 값이 들어갈 칸의 서브 트리에 새로운 노드를 추가하는 함수
+ * 칸의 서브 트리를 tree->root 로 옮겨서 JRBTreeInsertBelow 를 그대로 사용하고 다시 칸에 연결한다.
+ * 빈 칸에 처음 추가되면 JRBTreeInsertBelow 가 최소(최대) 노드를 새 노드로 바꾸므로 다른 칸과 비교해서 되돌린다.
+ * 매개변수 NULL 체크를 수행하지 않음
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param key 저장할 노드의 키 주소(입력)
+ * @return 성공 시 추가된 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JRBTreeInsertRadix(JRBTreePtr tree, void *key)
+{
+	JNodePtr header = JRBTreeRadixGetHeader(tree->radix, key);
+	JNodePtr oldLeftmost = tree->leftmost;
+	JNodePtr oldRightmost = tree->rightmost;
+	int isEmptySlot = (header->key == NULL);
+
+	JRBTreeRadixDetach(tree, header);
+	JNodePtr newNode = JRBTreeInsertBelow(tree, tree->root, key);
+	JRBTreeRadixAttach(tree, header);
+	if(newNode == NULL || isEmptySlot == 0) return newNode;
+
+	// 빈 칸에는 같은 값의 노드가 없으므로 값으로만 비교한다.
+	int value = *((int*)key);
+	tree->leftmost = (oldLeftmost == NULL || value < *((int*)(oldLeftmost->key))) ? newNode : oldLeftmost;
+	tree->rightmost = (oldRightmost == NULL || value > *((int*)(oldRightmost->key))) ? newNode : oldRightmost;
+	return newNode;
+}
+
+/**
+ * @fn static JNodePtr JRBTreeGetSearchRoot(const JRBTreePtr tree, const JNodePtr hint, void *key)
+ * @brief hint 에서 부모 노드 주소를 따라 올라가서 지정한 키가 들어갈 위치를 포함하는 서브 트리의 루트 노드를 반환하는 함수
+ * 키가 hint 이상이면 키보다 큰 부모 노드의 왼쪽 자식이 될 때까지, 작으면 키 이하인 부모 노드의 오른쪽 자식이 될 때까지 올라간다.
+ * 키가 가장 큰(작은) 노드 이상(미만)이면 그 노드부터 검색하므로 끝에 추가하는 경우 O(1) 이다.
+ * 반환한 서브 트리 위쪽(루트 노드부터의 경로)에 키와 값이 같은 노드가 있으면 중복 검사와 검색 결과가
+ * 루트 노드부터 내려갈 때와 달라지므로, hint 나 경계 노드(가장 큰 노드, 멈춘 부모 노드)의 값이 키와 같으면 루트 노드를 반환한다.
+ * (그 외에는 경로의 노드들이 모두 키보다 작거나 크다.)
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param hint 검색을 시작할 노드(입력, 읽기 전용, NULL 이면 루트 노드 반환)
+ * @param key 검색할 키의 주소(입력)
+ * @return 항상 검색을 시작할 노드의 주소 반환 (빈 트리면 NULL)
+ */
+static JNodePtr JRBTreeGetSearchRoot(const JRBTreePtr tree, const JNodePtr hint, void *key)
+{
+	if(hint == NULL) return tree->root;
+
+	int hintCompare = JNodeCompareKeyInline(key, hint->key, tree->type);
+	if(hintCompare == 0) return tree->root;
+
+	int toRight = (hintCompare > 0);
+	if(toRight)
+	{
+		int rightmostCompare = JNodeCompareKeyInline(key, tree->rightmost->key, tree->type);
+		if(rightmostCompare == 0) return tree->root;
+		if(rightmostCompare > 0) return tree->rightmost;
+	}
+	else if(JNodeCompareKeyInline(key, tree->leftmost->key, tree->type) < 0) return tree->leftmost;
+
+	JNodePtr currentNode = hint;
+	while(currentNode->parent != NULL)
+	{
+		JNodePtr parentNode = currentNode->parent;
+		if(toRight)
+		{
+			if((parentNode->left == currentNode) && (JNodeCompareKeyInline(parentNode->key, key, tree->type) > 0)) break;
+		}
+		else
+		{
+			int parentCompare = JNodeCompareKeyInline(parentNode->key, key, tree->type);
+			if(parentCompare == 0) return tree->root;
+			if((parentNode->right == currentNode) && (parentCompare < 0)) break;
+		}
+		currentNode = parentNode;
+	}
+
+	return currentNode;
+}
+
+/**
+ * @fn static JNodePtr JRBTreeFindUncached(const JRBTreePtr tree, void *key)
+ * @brief 검색 캐시를 사용하지 않고 엔진과 저장 방식에 맞게 지정한 키를 가진 노드를 검색하는 함수
+ * JRBTreeFindNodeByKey 함수에서 호출되므로 매개변수 NULL 체크를 수행하지 않음
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키의 주소(입력)
+ * @return 성공 시 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JRBTreeFindUncached(const JRBTreePtr tree, void *key)
+{
+	if(tree->bplus != NULL) return JRBTreeBPlusFind(tree->bplus, key);
+	// radix 표는 키 값으로 칸을 바로 골라서 그 칸의 서브 트리만 내려간다.
+	if(tree->radix != NULL) return JRBTreeFindBelow(tree, (JNodePtr)JRBTreeRadixGetHeader(tree->radix, key)->key, key);
+
+	// 키를 복사해서 저장하는 경우 주소가 다르므로 값이 같은 노드를 찾는다.
+	if(tree->keyArena != NULL)
+	{
+		JNodePtr lowerNode = JRBTreeLowerBound(tree, key);
+		if(lowerNode != NULL && JNodeCompareKeyInline(lowerNode->key, key, tree->type) == 0) return lowerNode;
+		return NULL;
+	}
+
+	// 같은 값의 키가 여러 개이면 주소가 같은 노드가 검색 경로 밖에 있을 수 있으므로 같은 값의 범위를 순회한다.
+	if(tree->multiset == 1)
+	{
+		JNodePtr currentNode = JRBTreeLowerBound(tree, key);
+		for( ; currentNode != NULL; currentNode = JNodeGetNext(currentNode))
+		{
+			if(currentNode->key == key) return currentNode;
+			if(JNodeCompareKeyInline(currentNode->key, key, tree->type) != 0) break;
+		}
+		return NULL;
+	}
+
+	return JRBTreeFindBelow(tree, tree->root, key);
+}
+
+/**
+ * @fn static JNodePtr JRBTreeFindBelow(const JRBTreePtr tree, JNodePtr startNode, void *key)
+ * @brief 지정한 서브 트리 안에서 키 주소가 같은 노드를 검색하는 함수
+ * IntType 은 분기 없이 내려가는 JNodeFindIntInline 을 사용한다. (JRBTREE_STATS 빌드는 비교 횟수를 세기 위해 일반 경로 사용)
+ * JRBTreeFindNodeByKey 와 JRBTreeFindFrom 함수에서 호출되므로 매개변수 NULL 체크를 수행하지 않음
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param startNode 검색을 시작할 서브 트리의 루트 노드(입력)
+ * @param key 검색할 키의 주소(입력)
+ * @return 성공 시 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JRBTreeFindBelow(const JRBTreePtr tree, JNodePtr startNode, void *key)
+{
+#ifndef JRBTREE_STATS
+	if(tree->type == IntType) return JNodeFindIntInline(startNode, key);
+#endif
+
+	JNodePtr currentNode = startNode;
+	int moveCount = 0;
+	while((currentNode != NULL) && (key != currentNode->key))
+	{
+		currentNode = JNodeMoveInline(currentNode, key, tree->type);
+		moveCount++;
+	}
+
+	JRBTREE_STAT_ADD(tree, comparisons, moveCount);
+	return currentNode;
+}
+
+/**
+ * @fn static void JRBTreeTransplant(JRBTreePtr tree, const JNodePtr oldNode, JNodePtr newNode)
+ * @brief 지정한 노드가 있던 자리에 다른 노드(서브 트리)를 연결하는 함수
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param oldNode 자리를 내어줄 노드(입력, 읽기 전용)
+ * @param newNode 새로 연결할 노드, NULL 가능(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeTransplant(JRBTreePtr tree, const JNodePtr oldNode, JNodePtr newNode)
+{
+	JNodePtr parentNode = oldNode->parent;
+
+	if(parentNode == NULL) tree->root = newNode;
+	else if(parentNode->left == oldNode) parentNode->left = newNode;
+	else parentNode->right = newNode;
+
+	if(newNode != NULL) newNode->parent = parentNode;
+}
+
+/**
+ * @fn static void JRBTreeDeleteFixup(JRBTreePtr tree, JNodePtr node, JNodePtr parentNode)
+ * @brief Black 노드가 삭제되어 깨진 RB Tree 조건(Black height)을 복구하는 함수
+ * 외부 노드(NULL)도 처리하기 위해 부모 노드를 같이 전달받는다.
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param node 삭제된 노드 자리로 올라온 노드, NULL 가능(입력)
+ * @param parentNode node 의 부모 노드(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeDeleteFixup(JRBTreePtr tree, JNodePtr node, JNodePtr parentNode)
+{
+	JNodePtr currentNode = node;
+	JNodePtr currentParentNode = parentNode;
+
+	while((currentNode != tree->root) && JNodeIsBlack(currentNode))
+	{
+		if(currentNode == currentParentNode->left)
+		{
+			JNodePtr siblingNode = currentParentNode->right;
+
+			// case 1) 형제 노드가 R 인 경우, 부모 노드를 기준으로 회전해서 형제 노드를 B 로 만든다.
+			if(siblingNode->color == Red)
+			{
+				siblingNode->color = Black;
+				currentParentNode->color = Red;
+				JNodeLeftRotate(tree, currentParentNode);
+				siblingNode = currentParentNode->right;
+			}
+
+			// case 2) 형제 노드의 자식 노드가 모두 B 인 경우, 형제 노드를 R 로 바꾸고 부모 노드에서 다시 검사한다.
+			if(JNodeIsBlack(siblingNode->left) && JNodeIsBlack(siblingNode->right))
+			{
+				siblingNode->color = Red;
+				currentNode = currentParentNode;
+				currentParentNode = currentNode->parent;
+			}
+			else
+			{
+				// case 3) 형제 노드의 바깥쪽 자식 노드가 B 인 경우, 형제 노드를 기준으로 회전한다. -> case 4)
+				if(JNodeIsBlack(siblingNode->right))
+				{
+					siblingNode->left->color = Black;
+					siblingNode->color = Red;
+					JNodeRightRotate(tree, siblingNode);
+					siblingNode = currentParentNode->right;
+				}
+
+				// case 4) 형제 노드의 바깥쪽 자식 노드가 R 인 경우, 부모 노드를 기준으로 회전하고 종료한다.
+				siblingNode->color = currentParentNode->color;
+				currentParentNode->color = Black;
+				siblingNode->right->color = Black;
+				JNodeLeftRotate(tree, currentParentNode);
+				currentNode = tree->root;
+			}
+		}
+		else
+		{
+			JNodePtr siblingNode = currentParentNode->left;
+
+			// case 1) 의 반대 방향
+			if(siblingNode->color == Red)
+			{
+				siblingNode->color = Black;
+				currentParentNode->color = Red;
+				JNodeRightRotate(tree, currentParentNode);
+				siblingNode = currentParentNode->left;
+			}
+
+			// case 2) 의 반대 방향
+			if(JNodeIsBlack(siblingNode->left) && JNodeIsBlack(siblingNode->right))
+			{
+				siblingNode->color = Red;
+				currentNode = currentParentNode;
+				currentParentNode = currentNode->parent;
+			}
+			else
+			{
+				// case 3) 의 반대 방향
+				if(JNodeIsBlack(siblingNode->left))
+				{
+					siblingNode->right->color = Black;
+					siblingNode->color = Red;
+					JNodeLeftRotate(tree, siblingNode);
+					siblingNode = currentParentNode->left;
+				}
+
+				// case 4) 의 반대 방향
+				siblingNode->color = currentParentNode->color;
+				currentParentNode->color = Black;
+				siblingNode->left->color = Black;
+				JNodeRightRotate(tree, currentParentNode);
+				currentNode = tree->root;
+			}
+		}
+	}
+
+	if(currentNode != NULL) currentNode->color = Black;
+}
+
+/**
+ * @fn static void JRBTreeAddSubtreeStats(const JNodePtr root, int baseDepth, JRBTreeStatsPtr stats)
+ * @brief 서브 트리를 중위 순회하면서 노드 개수와 최대 깊이를 통계에 더하는 함수 (JRBTreeGetStats 에서 호출)
+ * 부모 노드 주소를 따라 이동하므로 서브 트리 루트 노드의 부모 노드(radix 표의 헤더 노드 등)에서 멈춘다.
+ * @param root 서브 트리의 루트 노드(입력, 읽기 전용, NULL 가능)
+ * @param baseDepth 서브 트리 루트 노드 위의 깊이(입력)
+ * @param stats 노드 개수와 높이를 갱신할 통계 구조체 주소(출력)
  * @return 반환값 없음
  */
-static void JRBTreePrintHeight(const JNodePtr node, int height, KeyType type, char position)
+static void JRBTreeAddSubtreeStats(const JNodePtr root, int baseDepth, JRBTreeStatsPtr stats)
 {
-	if(node == NULL) return;
+	if(root == NULL) return;
 
-	int tabIndex = 0;
-	int heightIndex = 0;
+	JNodePtr stopNode = root->parent;
+	JNodePtr currentNode = root;
+	int depth = baseDepth;
+	while(currentNode != stopNode)
+	{
+		depth++;
+		if(currentNode->left != NULL)
+		{
+			currentNode = currentNode->left;
+			continue;
+		}
 
-	for( ; tabIndex < height; tabIndex++) printf("\t");
-	printf("[%c] ", position);
-	JNodePrintKey(node, type);
-	printf("\n");
+		// 왼쪽 서브 트리를 모두 방문한 노드를 세고, 오른쪽 서브 트리가 있는 노드까지 올라간다.
+		while(currentNode != stopNode)
+		{
+			stats->nodeCount++;
+			if(depth > stats->height) stats->height = depth;
+			if(currentNode->right != NULL)
+			{
+				currentNode = currentNode->right;
+				break;
+			}
 
-	JRBTreePrintHeight(node->left, height + 1, type, 'L');
-	JRBTreePrintHeight(node->right, height + 1, type, 'R');
+			JNodePtr childNode = currentNode;
+			currentNode = currentNode->parent;
+			depth--;
+			while((currentNode != stopNode) && (currentNode->right == childNode))
+			{
+				childNode = currentNode;
+				currentNode = currentNode->parent;
+				depth--;
+			}
+		}
+	}
 }
 
 /**
@@ -659,7 +1541,7 @@ static JRBTreePtr JRBTreeSetChildNode(const JRBTreePtr tree, const JNodePtr pare
 			else parentNode->right = childNode;
 			break;
 		case StringType:
-			if(strncmp((char*)(parentNode->key), (char*)(childNode->key), _GetCompareLength((char*)(parentNode->key), (char*)(childNode->key))) > 0) parentNode->left = childNode;
+			if(strcmp((char*)(parentNode->key), (char*)(childNode->key)) > 0) parentNode->left = childNode;
 			else parentNode->right = childNode;
 			break;
 		default:
@@ -695,35 +1577,21 @@ static KeyType _CheckKeyType(KeyType type)
 }
 
 /**
- * @fn static int _GetCompareLength(const char *s1, const char *s2)
- * @brief 두 문자열을 비교할 때 가장 긴 문자열의 길이를 반환하는 함수
- * @param s1 첫 번째 비교할 문자열(입력, 읽기 전용)
- * @param s2 두 번째 비교할 문자열(입력, 읽기 전용)
- * @return 항상 비교할 길이 반환
- */
-static int _GetCompareLength(const char *s1, const char *s2)
-{
-	int s1Length = strlen(s1);
-	int s2Length = strlen(s2);
-	return s1Length > s2Length ? s1Length : s2Length;
-}
-
-/**
- * @fn static char _NodeColorToChar(NodeColor color)
- * @brief NodeColor 열거형 값을 특정 색을 가리키는 문자로 변환하는 함수
- * @param color 문자로 변경할 노드의 색(입력, NodeColor 열거형 참고)
- * @return 성공 시 변환된 문자, 실패 시 널 문자 반환
+ * @fn static size_t _GetKeySize(KeyType type, const void *key)
+ * @brief 키를 복사할 때의 크기를 반환하는 함수
+ * @param type 키의 데이터 유형(입력)
+ * @param key 키 주소(입력, 읽기 전용)
+ * @return 항상 키의 크기 반환 (StringType 은 널 문자 포함)
  */
-static char _NodeColorToChar(NodeColor color)
+static size_t _GetKeySize(KeyType type, const void *key)
 {
-	switch(color)
+	switch(type)
 	{
-		case Red:
-			return 'R';
-		case Black:
-			return 'B';
+		case IntType:
+			return sizeof(int);
+		case CharType:
+			return sizeof(char);
 		default:
-			return '\0';
+			return strlen((const char*)key) + 1;
 	}
 }
-
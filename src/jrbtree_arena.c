@@ -0,0 +1,329 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../include/jrbtree.h"
+#include "jrbtree_internal.h"
+
+// 청크 크기의 1/4 보다 큰 요청은 전용 청크를 할당해서 현재 청크의 남은 공간을 버리지 않는다.
+#define ARENA_LARGE_DIVISOR 4
+// 문자열 중복 제거 해시 테이블의 처음 칸 개수
+#define INTERN_INITIAL_CAPACITY 64
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static JRBTreeArenaChunkPtr _NewChunk(size_t size);
+static size_t _HashString(const char *string, size_t length);
+static int _GrowInternSlots(JRBTreeArenaPtr arena);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JRBTreeArena
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JRBTreeArenaPtr NewJRBTreeArena(size_t chunkSize)
+ * @brief 새로운 arena 구조체 객체를 생성하는 함수
+ * arena 는 큰 청크 단위로 메모리를 할당하고 요청마다 청크 안의 공간을 순서대로 나눠준다.
+ * 개별 해제는 없고 DeleteJRBTreeArena 에서 청크들만 한 번에 해제한다.
+ * @param chunkSize 청크 한 개의 크기(입력, 0 이면 JRBTREE_ARENA_CHUNK_SIZE)
+ * @return 성공 시 생성된 arena 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JRBTreeArenaPtr NewJRBTreeArena(size_t chunkSize)
+{
+	JRBTreeArenaPtr newArena = (JRBTreeArenaPtr)malloc(sizeof(JRBTreeArena));
+	if(newArena == NULL) return NULL;
+
+	newArena->head = NULL;
+	newArena->chunkSize = (chunkSize > 0) ? chunkSize : JRBTREE_ARENA_CHUNK_SIZE;
+	newArena->allocatedBytes = 0;
+	newArena->internSlots = NULL;
+	newArena->internCapacity = 0;
+	newArena->internCount = 0;
+	return newArena;
+}
+
+/**
+ * @fn DeleteResult DeleteJRBTreeArena(JRBTreeArenaPtrContainer container)
+ * @brief arena 구조체 객체와 할당한 모든 청크를 삭제하는 함수 (청크 개수만큼만 free 호출)
+ * @param container arena 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJRBTreeArena(JRBTreeArenaPtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	JRBTreeArenaChunkPtr chunk = (*container)->head;
+	while(chunk != NULL)
+	{
+		JRBTreeArenaChunkPtr nextChunk = chunk->next;
+		free(chunk);
+		chunk = nextChunk;
+	}
+
+	free((*container)->internSlots);
+	free(*container);
+	*container = NULL;
+	return DeleteSuccess;
+}
+
+/**
+ * @fn void* JRBTreeArenaAlloc(JRBTreeArenaPtr arena, size_t size, size_t align)
+ * @brief arena 에서 지정한 크기의 메모리를 할당하는 함수
+ * 매개변수 NULL 체크를 수행하지 않음
+ * @param arena arena 구조체 객체의 주소(출력)
+ * @param size 할당할 크기(입력)
+ * @param align 정렬 단위, 2 의 거듭제곱(입력)
+ * @return 성공 시 할당한 메모리의 주소, 실패 시 NULL 반환
+ */
+void* JRBTreeArenaAlloc(JRBTreeArenaPtr arena, size_t size, size_t align)
+{
+	JRBTreeArenaChunkPtr chunk = arena->head;
+	if(chunk != NULL)
+	{
+		uintptr_t address = ((uintptr_t)(chunk->data + chunk->used) + (align - 1)) & ~((uintptr_t)(align - 1));
+		size_t offset = (size_t)(address - (uintptr_t)chunk->data);
+		if(offset + size <= chunk->size)
+		{
+			chunk->used = offset + size;
+			return chunk->data + offset;
+		}
+	}
+
+	// 큰 요청은 전용 청크를 현재 청크 뒤에 연결한다.
+	if(size > arena->chunkSize / ARENA_LARGE_DIVISOR)
+	{
+		JRBTreeArenaChunkPtr largeChunk = _NewChunk(size + align);
+		if(largeChunk == NULL) return NULL;
+		arena->allocatedBytes += sizeof(JRBTreeArenaChunk) + largeChunk->size;
+
+		if(chunk == NULL) arena->head = largeChunk;
+		else
+		{
+			largeChunk->next = chunk->next;
+			chunk->next = largeChunk;
+		}
+
+		uintptr_t address = ((uintptr_t)largeChunk->data + (align - 1)) & ~((uintptr_t)(align - 1));
+		largeChunk->used = largeChunk->size;
+		return (void*)address;
+	}
+
+	JRBTreeArenaChunkPtr newChunk = _NewChunk(arena->chunkSize);
+	if(newChunk == NULL) return NULL;
+	arena->allocatedBytes += sizeof(JRBTreeArenaChunk) + newChunk->size;
+	newChunk->next = chunk;
+	arena->head = newChunk;
+
+	return JRBTreeArenaAlloc(arena, size, align);
+}
+
+/**
+ * @fn void* JRBTreeArenaCopy(JRBTreeArenaPtr arena, const void *source, size_t size, size_t align)
+ * @brief arena 에 지정한 메모리의 내용을 복사하는 함수
+ * 매개변수 NULL 체크를 수행하지 않음
+ * @param arena arena 구조체 객체의 주소(출력)
+ * @param source 복사할 메모리의 주소(입력, 읽기 전용)
+ * @param size 복사할 크기(입력)
+ * @param align 정렬 단위, 2 의 거듭제곱(입력)
+ * @return 성공 시 복사된 메모리의 주소, 실패 시 NULL 반환
+ */
+void* JRBTreeArenaCopy(JRBTreeArenaPtr arena, const void *source, size_t size, size_t align)
+{
+	void *target = JRBTreeArenaAlloc(arena, size, align);
+	if(target == NULL) return NULL;
+	memcpy(target, source, size);
+	return target;
+}
+
+/**
+ * @fn size_t JRBTreeArenaGetBytes(const JRBTreeArenaPtr arena)
+ * @brief arena 가 할당한 전체 메모리 크기를 반환하는 함수 (구조체 + 청크 + 해시 테이블)
+ * @param arena arena 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 메모리 크기, 실패 시 0 반환
+ */
+size_t JRBTreeArenaGetBytes(const JRBTreeArenaPtr arena)
+{
+	if(arena == NULL) return 0;
+	return sizeof(JRBTreeArena) + arena->allocatedBytes + arena->internCapacity * sizeof(JRBTreeInternSlot);
+}
+
+/**
+ * @fn char* JRBTreeArenaIntern(JRBTreeArenaPtr arena, const char *string)
+ * @brief arena 에 문자열을 한 번만 저장하는 함수 (중복 제거)
+ * 같은 내용의 문자열이 이미 저장되어 있으면 그 주소를, 없으면 arena 에 복사한 주소를 반환한다.
+ * 따라서 반환된 주소가 같으면 내용도 같다.
+ * 매개변수 NULL 체크를 수행하지 않음
+ * @param arena arena 구조체 객체의 주소(출력)
+ * @param string 저장할 문자열(입력, 읽기 전용)
+ * @return 성공 시 arena 에 저장된 문자열의 주소, 실패 시 NULL 반환
+ */
+char* JRBTreeArenaIntern(JRBTreeArenaPtr arena, const char *string)
+{
+	// 사용률을 3/4 이하로 유지한다.
+	if((arena->internCount + 1) * 4 > arena->internCapacity * 3)
+	{
+		if(_GrowInternSlots(arena) == -1) return NULL;
+	}
+
+	size_t length = strlen(string);
+	size_t hash = _HashString(string, length);
+	size_t mask = arena->internCapacity - 1;
+	size_t slotIndex = hash & mask;
+
+	// 선형 탐사
+	while(arena->internSlots[slotIndex].string != NULL)
+	{
+		JRBTreeInternSlotPtr slot = &(arena->internSlots[slotIndex]);
+		// 해시 값이 같아도 저장된 문자열이 더 짧을 수 있으므로 널 문자까지만 비교한다.
+		if(slot->hash == hash && strcmp(slot->string, string) == 0) return slot->string;
+		slotIndex = (slotIndex + 1) & mask;
+	}
+
+	char *newString = (char*)JRBTreeArenaCopy(arena, string, length + 1, 1);
+	if(newString == NULL) return NULL;
+
+	arena->internSlots[slotIndex].string = newString;
+	arena->internSlots[slotIndex].hash = hash;
+	arena->internCount++;
+	return newString;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JRBTreeStringPool
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JRBTreeStringPoolPtr NewJRBTreeStringPool()
+ * @brief 새로운 문자열 풀 구조체 객체를 생성하는 함수
+ * 문자열 풀은 문자열을 연속된 청크에 한 번만 저장한다. (같은 내용이면 같은 주소)
+ * 풀에서 받은 주소를 키로 사용하면 주소가 같을 때만 같은 키로 취급하는 JRBTreeFindNodeByKey 로도 값으로 검색할 수 있고,
+ * 여러 RB Tree 가 같은 문자열을 공유한다.
+ * @return 성공 시 생성된 문자열 풀 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JRBTreeStringPoolPtr NewJRBTreeStringPool()
+{
+	return NewJRBTreeArena(0);
+}
+
+/**
+ * @fn DeleteResult DeleteJRBTreeStringPool(JRBTreeStringPoolPtrContainer container)
+ * @brief 문자열 풀 구조체 객체와 저장된 모든 문자열을 삭제하는 함수
+ * 풀의 문자열을 키로 사용하는 RB Tree 보다 나중에 삭제해야 한다.
+ * @param container 문자열 풀 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJRBTreeStringPool(JRBTreeStringPoolPtrContainer container)
+{
+	return DeleteJRBTreeArena(container);
+}
+
+/**
+ * @fn char* JRBTreeStringPoolIntern(JRBTreeStringPoolPtr pool, const char *string)
+ * @brief 문자열 풀에 문자열을 저장하고 저장된 주소를 반환하는 함수
+ * 같은 내용의 문자열이 이미 있으면 새로 저장하지 않고 기존 주소를 반환한다.
+ * @param pool 문자열 풀 구조체 객체의 주소(출력)
+ * @param string 저장할 문자열(입력, 읽기 전용)
+ * @return 성공 시 풀에 저장된 문자열의 주소(풀을 삭제할 때까지 유효), 실패 시 NULL 반환
+ */
+char* JRBTreeStringPoolIntern(JRBTreeStringPoolPtr pool, const char *string)
+{
+	if(pool == NULL || string == NULL) return NULL;
+	return JRBTreeArenaIntern(pool, string);
+}
+
+/**
+ * @fn size_t JRBTreeStringPoolGetCount(const JRBTreeStringPoolPtr pool)
+ * @brief 문자열 풀에 저장된 서로 다른 문자열의 개수를 반환하는 함수
+ * @param pool 문자열 풀 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 문자열 개수, 실패 시 0 반환
+ */
+size_t JRBTreeStringPoolGetCount(const JRBTreeStringPoolPtr pool)
+{
+	if(pool == NULL) return 0;
+	return pool->internCount;
+}
+
+/**
+ * @fn size_t JRBTreeStringPoolGetBytes(const JRBTreeStringPoolPtr pool)
+ * @brief 문자열 풀이 할당한 전체 메모리 크기를 반환하는 함수 (구조체 + 청크 + 해시 테이블)
+ * @param pool 문자열 풀 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 메모리 크기, 실패 시 0 반환
+ */
+size_t JRBTreeStringPoolGetBytes(const JRBTreeStringPoolPtr pool)
+{
+	return JRBTreeArenaGetBytes(pool);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static JRBTreeArenaChunkPtr _NewChunk(size_t size)
+ * @brief 지정한 크기의 데이터 영역을 가진 청크를 할당하는 함수
+ * @param size 데이터 영역 크기(입력)
+ * @return 성공 시 청크의 주소, 실패 시 NULL 반환
+ */
+static JRBTreeArenaChunkPtr _NewChunk(size_t size)
+{
+	JRBTreeArenaChunkPtr newChunk = (JRBTreeArenaChunkPtr)malloc(sizeof(JRBTreeArenaChunk) + size);
+	if(newChunk == NULL) return NULL;
+
+	newChunk->next = NULL;
+	newChunk->size = size;
+	newChunk->used = 0;
+	return newChunk;
+}
+
+/**
+ * @fn static size_t _HashString(const char *string, size_t length)
+ * @brief 문자열의 해시 값을 계산하는 함수 (FNV-1a)
+ * @param string 문자열(입력, 읽기 전용)
+ * @param length 문자열 길이(입력)
+ * @return 항상 해시 값 반환
+ */
+static size_t _HashString(const char *string, size_t length)
+{
+	unsigned long long hash = 14695981039346656037ULL;
+	size_t index = 0;
+	for( ; index < length; index++)
+	{
+		hash ^= (unsigned char)string[index];
+		hash *= 1099511628211ULL;
+	}
+	return (size_t)hash;
+}
+
+/**
+ * @fn static int _GrowInternSlots(JRBTreeArenaPtr arena)
+ * @brief 문자열 중복 제거 해시 테이블의 칸 개수를 두 배로 늘리는 함수 (처음이면 새로 할당)
+ * 저장된 해시 값을 사용하므로 문자열을 다시 읽지 않는다.
+ * @param arena arena 구조체 객체의 주소(출력)
+ * @return 성공 시 1, 실패 시 -1 반환
+ */
+static int _GrowInternSlots(JRBTreeArenaPtr arena)
+{
+	size_t newCapacity = (arena->internCapacity > 0) ? arena->internCapacity * 2 : INTERN_INITIAL_CAPACITY;
+	JRBTreeInternSlotPtr newSlots = (JRBTreeInternSlotPtr)calloc(newCapacity, sizeof(JRBTreeInternSlot));
+	if(newSlots == NULL) return -1;
+
+	size_t mask = newCapacity - 1;
+	size_t slotIndex = 0;
+	for( ; slotIndex < arena->internCapacity; slotIndex++)
+	{
+		JRBTreeInternSlotPtr slot = &(arena->internSlots[slotIndex]);
+		if(slot->string == NULL) continue;
+
+		size_t newIndex = slot->hash & mask;
+		while(newSlots[newIndex].string != NULL) newIndex = (newIndex + 1) & mask;
+		newSlots[newIndex] = *slot;
+	}
+
+	free(arena->internSlots);
+	arena->internSlots = newSlots;
+	arena->internCapacity = newCapacity;
+	return 1;
+}
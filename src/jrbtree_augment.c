@@ -0,0 +1,186 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/jrbtree.h"
+#include "../include/jrbtree_inline.h"
+#include "jrbtree_internal.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Augment Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int JRBTreeAggregateBoundary(const JRBTreePtr tree, JNodePtr root, void *bound, int isUpper, void *aggregate);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static const void* _GetAggregate(const JNodePtr node);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JRBTree
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JRBTreePtr NewJRBTreeAugmented(KeyType type, size_t aggregateSize, JRBTreeAggregateCombine combine)
+ * @brief 노드마다 서브 트리의 집계 값(합, 최소, 최대 등)을 저장하는 RB Tree 구조체 객체를 생성하는 함수
+ * 집계 값은 노드 바로 뒤에 aggregateSize 만큼 같이 할당되고(8 bytes 정렬), 노드를 추가/삭제한 경로와
+ * 회전한 노드마다 combine 으로 다시 계산하므로 항상 그 노드를 루트로 하는 서브 트리 전체의 집계 값이다.
+ * 키의 값(예: 키 구조체의 다른 멤버)을 집계하려면 combine 에서 키를 읽는다.
+ * JRBTreeRangeAggregate 로 키 범위의 집계 값을 O(log n) 에 계산할 수 있다.
+ * JRBTreeDeleteRange, JRBTreeTruncateBelow 는 노드를 하나씩 삭제한다.
+ * @param type 저장할 키 데이터 유형(입력)
+ * @param aggregateSize 노드마다 저장할 집계 값 크기(입력, 0 보다 커야 한다)
+ * @param combine 집계 값 계산 함수(입력, JRBTreeAggregateCombine 참고)
+ * @return 성공 시 생성된 RB Tree 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JRBTreePtr NewJRBTreeAugmented(KeyType type, size_t aggregateSize, JRBTreeAggregateCombine combine)
+{
+	if(aggregateSize == 0 || combine == NULL) return NULL;
+
+	JRBTreePtr newTree = NewJRBTree(type);
+	if(newTree == NULL) return NULL;
+
+	newTree->aggregateSize = aggregateSize;
+	newTree->aggregateCombine = combine;
+	return newTree;
+}
+
+/**
+ * @fn int JRBTreeRangeAggregate(const JRBTreePtr tree, void *lo, void *hi, void *out)
+ * @brief 집계 값을 저장하는 RB Tree 에서 키의 값이 lo 이상 hi 이하인 노드들의 집계 값을 계산하는 함수
+ * 범위 안에서 가장 위의 노드를 찾은 후, 그 노드의 왼쪽(오른쪽) 서브 트리에서 lo(hi) 경계 경로만 내려가면서
+ * 범위에 완전히 포함되는 서브 트리는 저장된 집계 값을 그대로 사용하므로 O(log n) 이다.
+ * 키 주소가 아니라 값으로 비교하며, 키 순서대로 combine 을 적용한 결과와 같다.
+ * @param tree NewJRBTreeAugmented 로 생성한 RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param lo 범위의 시작 키 주소, 포함(입력)
+ * @param hi 범위의 끝 키 주소, 포함(입력)
+ * @param out 집계 값을 저장할 주소, aggregateSize 크기(출력, 범위가 비어 있으면 바꾸지 않음)
+ * @return 범위에 노드가 있으면 1, 없거나 실패 시 0 반환
+ */
+int JRBTreeRangeAggregate(const JRBTreePtr tree, void *lo, void *hi, void *out)
+{
+	if(tree == NULL || lo == NULL || hi == NULL || out == NULL || tree->aggregateCombine == NULL) return 0;
+	if(JNodeCompareKeyInline(lo, hi, tree->type) > 0) return 0;
+
+	// 범위 안의 노드 중 가장 위에 있는 노드를 찾는다. (범위 안의 노드는 모두 이 노드의 서브 트리에 있다)
+	JNodePtr splitNode = tree->root;
+	while(splitNode != NULL)
+	{
+		if(JNodeCompareKeyInline(splitNode->key, lo, tree->type) < 0) splitNode = splitNode->right;
+		else if(JNodeCompareKeyInline(splitNode->key, hi, tree->type) > 0) splitNode = splitNode->left;
+		else break;
+	}
+	if(splitNode == NULL) return 0;
+
+	// 왼쪽 경계의 집계 값은 out 에, 오른쪽 경계의 집계 값은 임시 버퍼에 계산한다.
+	union {
+		long long integerAlignment;
+		double realAlignment;
+		void *pointerAlignment;
+		unsigned char bytes[JRBTREE_AGGREGATE_LOCAL_SIZE];
+	} localBuffer;
+	void *rightAggregate = localBuffer.bytes;
+	if(tree->aggregateSize > JRBTREE_AGGREGATE_LOCAL_SIZE)
+	{
+		rightAggregate = malloc(tree->aggregateSize);
+		if(rightAggregate == NULL) return 0;
+	}
+
+	int hasLeft = JRBTreeAggregateBoundary(tree, splitNode->left, lo, 0, out);
+	int hasRight = JRBTreeAggregateBoundary(tree, splitNode->right, hi, 1, rightAggregate);
+	tree->aggregateCombine(out, splitNode->key, (hasLeft == 1) ? out : NULL, (hasRight == 1) ? rightAggregate : NULL);
+
+	if(rightAggregate != localBuffer.bytes) free(rightAggregate);
+	return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for Augment
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn void JRBTreeAugmentUpdate(const JRBTreePtr tree, JNodePtr node)
+ * @brief 자식 노드들의 집계 값으로 지정한 노드의 집계 값을 다시 계산하는 함수 (회전할 때 호출)
+ * 매개변수 NULL 체크를 수행하지 않음 (tree->aggregateCombine 이 NULL 이 아니어야 한다)
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param node 다시 계산할 노드, 자식 노드들의 집계 값은 맞아야 한다.(입력, 출력)
+ * @return 반환값 없음
+ */
+void JRBTreeAugmentUpdate(const JRBTreePtr tree, JNodePtr node)
+{
+	tree->aggregateCombine(JRBTREE_NODE_AGGREGATE(node), node->key, _GetAggregate(node->left), _GetAggregate(node->right));
+}
+
+/**
+ * @fn void JRBTreeAugmentUpdatePath(const JRBTreePtr tree, JNodePtr node)
+ * @brief 지정한 노드부터 루트 노드까지 집계 값을 다시 계산하는 함수 (노드를 연결하거나 분리한 후 호출)
+ * 매개변수 NULL 체크를 수행하지 않음 (tree->aggregateCombine 이 NULL 이 아니어야 한다)
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param node 자식 노드가 바뀐 가장 아래 노드(입력, 출력, NULL 이면 아무 것도 하지 않음)
+ * @return 반환값 없음
+ */
+void JRBTreeAugmentUpdatePath(const JRBTreePtr tree, JNodePtr node)
+{
+	for( ; node != NULL; node = node->parent) JRBTreeAugmentUpdate(tree, node);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Augment Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int JRBTreeAggregateBoundary(const JRBTreePtr tree, JNodePtr root, void *bound, int isUpper, void *aggregate)
+ * @brief 서브 트리에서 키의 값이 bound 이상(isUpper 이면 이하)인 노드들의 집계 값을 계산하는 함수
+ * 경계 경로에서 범위 안에 있는 노드를 기억한 후, 가장 깊은 노드부터 그 노드와 범위 쪽 자식 서브 트리의 집계 값을 합친다.
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param root 서브 트리의 루트 노드(입력, NULL 가능)
+ * @param bound 경계 키 주소(입력)
+ * @param isUpper 0 이면 bound 이상(왼쪽 경계), 아니면 bound 이하(오른쪽 경계)(입력)
+ * @param aggregate 집계 값을 저장할 주소(출력, 해당하는 노드가 없으면 바꾸지 않음)
+ * @return 해당하는 노드가 있으면 1, 없으면 0 반환
+ */
+static int JRBTreeAggregateBoundary(const JRBTreePtr tree, JNodePtr root, void *bound, int isUpper, void *aggregate)
+{
+	JNodePtr path[JRBTREE_AGGREGATE_MAX_DEPTH];
+	int depth = 0;
+
+	JNodePtr currentNode = root;
+	while(currentNode != NULL)
+	{
+		int compareResult = JNodeCompareKeyInline(currentNode->key, bound, tree->type);
+		int isInside = (isUpper == 0) ? (compareResult >= 0) : (compareResult <= 0);
+		if(isInside == 1) path[depth++] = currentNode;
+
+		// 범위 안의 노드는 경계 쪽 자식으로, 범위 밖의 노드는 범위 쪽 자식으로 내려간다.
+		currentNode = currentNode->child[(isInside == 1) ? (isUpper != 0) : (isUpper == 0)];
+	}
+
+	int hasAggregate = 0;
+	for(depth--; depth >= 0; depth--)
+	{
+		JNodePtr node = path[depth];
+		const void *innerAggregate = (hasAggregate == 1) ? aggregate : NULL;
+		if(isUpper == 0) tree->aggregateCombine(aggregate, node->key, innerAggregate, _GetAggregate(node->right));
+		else tree->aggregateCombine(aggregate, node->key, _GetAggregate(node->left), innerAggregate);
+		hasAggregate = 1;
+	}
+	return hasAggregate;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static const void* _GetAggregate(const JNodePtr node)
+ * @brief 노드의 집계 값 주소를 반환하는 함수
+ * @param node 노드(입력, 읽기 전용, NULL 가능)
+ * @return 집계 값 주소 반환 (NULL 이면 NULL)
+ */
+static const void* _GetAggregate(const JNodePtr node)
+{
+	if(node == NULL) return NULL;
+	return JRBTREE_NODE_AGGREGATE(node);
+}
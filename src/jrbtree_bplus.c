@@ -0,0 +1,735 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "../include/jrbtree.h"
+#include "jrbtree_internal.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of BPlus Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static JRBTreeBPlusNodePtr JRBTreeBPlusSplitChild(JRBTreeBPlusPtr bplus, JRBTreeBPlusNodePtr parent, int index);
+static int JRBTreeBPlusFillChild(JRBTreeBPlusPtr bplus, JRBTreeBPlusNodePtr parent, int index);
+static void JRBTreeBPlusBorrowLeft(JRBTreeBPlusNodePtr parent, int index);
+static void JRBTreeBPlusBorrowRight(JRBTreeBPlusNodePtr parent, int index);
+static void JRBTreeBPlusMerge(JRBTreeBPlusPtr bplus, JRBTreeBPlusNodePtr parent, int index);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static JRBTreeBPlusNodePtr _NewBPlusNode(JRBTreeBPlusPtr bplus, int leaf);
+static void _FreeBPlusNode(JRBTreeBPlusPtr bplus, JRBTreeBPlusNodePtr node);
+static void _FreeBPlusSubtree(JRBTreeBPlusPtr bplus, JRBTreeBPlusNodePtr node);
+static size_t _GetNodeSize(int leaf);
+static void _InsertEntry(JRBTreeBPlusNodePtr node, int position, int value, JNodePtr entryNode, JRBTreeBPlusNodePtr child);
+static void _RemoveEntry(JRBTreeBPlusNodePtr node, int position);
+static int _IsEntry(const JRBTreeBPlusNodePtr node, int position, int value, const void *key);
+static int _CountLess(const JRBTreeBPlusPtr bplus, const JRBTreeBPlusNodePtr node, int value, const void *key);
+static int _CountByValue(const JRBTreeBPlusPtr bplus, const JRBTreeBPlusNodePtr node, const void *key, int upper);
+static int _GetValue(KeyType type, const void *key);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JRBTreeBPlus
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JRBTreeBPlusPtr NewJRBTreeBPlus(KeyType type)
+ * @brief 새로운 B+ Tree 엔진 구조체 객체를 생성하는 함수
+ * 노드마다 키 값 배열이 캐시 라인 하나(JRBTREE_BPLUS_ORDER 개)를 차지하므로 한 단계에서 16 개를 비교하고,
+ * 높이가 RB Tree 의 1/4 정도라서 검색 경로의 포인터 이동(캐시 미스)이 적다.
+ * 키마다 JNode 를 하나씩 할당해서 키 순서의 이중 연결 리스트로 연결하므로, JNode 를 반환하는 함수와 JNodeGetNext 는 그대로 동작한다.
+ * @param type 저장할 키 데이터 유형(입력)
+ * @return 성공 시 생성된 B+ Tree 엔진 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JRBTreeBPlusPtr NewJRBTreeBPlus(KeyType type)
+{
+	JRBTreeBPlusPtr newBPlus = (JRBTreeBPlusPtr)malloc(sizeof(JRBTreeBPlus));
+	if(newBPlus == NULL)
+	{
+		return NULL;
+	}
+
+	newBPlus->type = type;
+	newBPlus->height = 0;
+	newBPlus->root = NULL;
+	newBPlus->allocatedBytes = 0;
+	return newBPlus;
+}
+
+/**
+ * @fn DeleteResult DeleteJRBTreeBPlus(JRBTreeBPlusPtrContainer container)
+ * @brief B+ Tree 엔진 구조체 객체를 삭제하는 함수 (키마다 할당한 JNode 는 해제하지 않음, JRBTreeBPlusReleaseNodes 참고)
+ * @param container B+ Tree 엔진 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJRBTreeBPlus(JRBTreeBPlusPtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	_FreeBPlusSubtree(*container, (*container)->root);
+	free(*container);
+	*container = NULL;
+	return DeleteSuccess;
+}
+
+/**
+ * @fn JNodePtr JRBTreeBPlusInsert(JRBTreePtr tree, void *key)
+ * @brief B+ Tree 엔진에 새로운 키를 추가하는 함수
+ * 내려가면서 가득 찬 노드를 미리 나누므로(top-down split) 부모 노드로 다시 올라가지 않는다.
+ * 키 주소가 같은 키가 이미 있으면 추가하지 않는다. (같은 값의 다른 키 주소는 키 주소 순서로 추가)
+ * 매개변수 NULL 체크를 수행하지 않음 (tree->bplus 가 NULL 이 아니어야 한다)
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param key 저장할 키의 주소(입력)
+ * @return 성공 시 추가된 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JRBTreeBPlusInsert(JRBTreePtr tree, void *key)
+{
+	JRBTreeBPlusPtr bplus = tree->bplus;
+	int value = _GetValue(bplus->type, key);
+
+	if(bplus->root == NULL)
+	{
+		bplus->root = _NewBPlusNode(bplus, 1);
+		if(bplus->root == NULL) return NULL;
+		bplus->height = 1;
+	}
+
+	// 가득 찬 루트 노드는 새로운 루트 노드 아래에서 나눠서 높이를 늘린다.
+	if(bplus->root->count == JRBTREE_BPLUS_ORDER)
+	{
+		JRBTreeBPlusNodePtr newRoot = _NewBPlusNode(bplus, 0);
+		if(newRoot == NULL) return NULL;
+
+		newRoot->children[0] = bplus->root;
+		if(JRBTreeBPlusSplitChild(bplus, newRoot, 0) == NULL)
+		{
+			_FreeBPlusNode(bplus, newRoot);
+			return NULL;
+		}
+		bplus->root = newRoot;
+		bplus->height++;
+	}
+
+	JRBTreeBPlusNodePtr currentNode = bplus->root;
+	while(!currentNode->leaf)
+	{
+		int position = _CountLess(bplus, currentNode, value, key);
+		if(_IsEntry(currentNode, position, value, key)) return NULL;
+
+		// 가득 찬 자식 노드는 나눈 후 같은 노드에서 다시 위치를 찾는다.
+		if(currentNode->children[position]->count == JRBTREE_BPLUS_ORDER)
+		{
+			if(JRBTreeBPlusSplitChild(bplus, currentNode, position) == NULL) return NULL;
+			continue;
+		}
+		currentNode = currentNode->children[position];
+	}
+
+	int position = _CountLess(bplus, currentNode, value, key);
+	if(_IsEntry(currentNode, position, value, key)) return NULL;
+
+	JNodePtr newNode = JRBTreeAllocNode(tree);
+	if(newNode == NULL) return NULL;
+	newNode->key = key;
+	newNode->color = JRBTREE_LIST_COLOR;
+
+	// 정렬 순서의 이전, 다음 노드와 연결한다. (리프의 처음이나 끝이면 이웃 리프에서 찾는다)
+	JNodePtr nextNode = NULL;
+	if(position < currentNode->count) nextNode = currentNode->nodes[position];
+	else if(currentNode->next != NULL) nextNode = currentNode->next->nodes[0];
+	JNodePtr previousNode = (position > 0) ? currentNode->nodes[position - 1] : ((nextNode != NULL) ? nextNode->left : tree->rightmost);
+
+	newNode->left = previousNode;
+	newNode->right = nextNode;
+	if(previousNode != NULL) previousNode->right = newNode;
+	else tree->leftmost = newNode;
+	if(nextNode != NULL) nextNode->left = newNode;
+	else tree->rightmost = newNode;
+
+	_InsertEntry(currentNode, position, value, newNode, NULL);
+	tree->size++;
+	JRBTREE_STAT_ADD(tree, inserts, 1);
+	if(tree->hashIndex != NULL) JRBTreeHashIndexInsert(tree, newNode);
+	return newNode;
+}
+
+/**
+ * @fn void JRBTreeBPlusRemove(JRBTreePtr tree, JNodePtr node)
+ * @brief B+ Tree 엔진에서 지정한 노드를 분리하는 함수 (메모리는 해제하지 않음)
+ * 내려가면서 최소 개수인 자식 노드를 미리 채우므로(빌리거나 병합) 부모 노드로 다시 올라가지 않는다.
+ * 노드 개수와 최소(최대) 노드는 갱신하지 않는다. (JRBTreeRemoveNode 에서 호출)
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param node 분리할 노드, 반드시 tree 에 속한 노드여야 한다.(입력)
+ * @return 반환값 없음
+ */
+void JRBTreeBPlusRemove(JRBTreePtr tree, JNodePtr node)
+{
+	JRBTreeBPlusPtr bplus = tree->bplus;
+	void *key = node->key;
+	int value = _GetValue(bplus->type, key);
+
+	if(node->left != NULL) node->left->right = node->right;
+	if(node->right != NULL) node->right->left = node->left;
+	node->left = NULL;
+	node->right = NULL;
+
+	// 마지막으로 오른쪽 자식 노드로 내려간 위치 (삭제할 키가 리프의 처음이면 이 분리 키가 삭제할 키다)
+	JRBTreeBPlusNodePtr separatorNode = NULL;
+	int separatorIndex = 0;
+
+	JRBTreeBPlusNodePtr currentNode = bplus->root;
+	if(currentNode == NULL) return;
+	while(!currentNode->leaf)
+	{
+		int position = _CountLess(bplus, currentNode, value, key);
+		if(_IsEntry(currentNode, position, value, key)) position++;
+		if(currentNode->children[position]->count <= JRBTREE_BPLUS_MIN) position = JRBTreeBPlusFillChild(bplus, currentNode, position);
+
+		// 루트 노드의 두 자식 노드가 병합되어 분리 키가 없어지면 높이를 줄인다.
+		if(currentNode->count == 0)
+		{
+			bplus->root = currentNode->children[0];
+			_FreeBPlusNode(bplus, currentNode);
+			bplus->height--;
+			currentNode = bplus->root;
+			continue;
+		}
+
+		if(position > 0)
+		{
+			separatorNode = currentNode;
+			separatorIndex = position - 1;
+		}
+		currentNode = currentNode->children[position];
+	}
+
+	int position = _CountLess(bplus, currentNode, value, key);
+	if(!_IsEntry(currentNode, position, value, key)) return;
+	_RemoveEntry(currentNode, position);
+
+	if(currentNode->count == 0)
+	{
+		// 루트가 아닌 리프는 최소 개수보다 많은 상태에서 삭제하므로 빈 리프는 루트뿐이다.
+		_FreeBPlusNode(bplus, currentNode);
+		bplus->root = NULL;
+		bplus->height = 0;
+		return;
+	}
+
+	// 분리 키는 오른쪽 서브 트리의 가장 작은 키이므로, 리프의 처음 키를 삭제했으면 리프의 새로운 처음 키로 바꾼다.
+	if(position == 0 && separatorNode != NULL)
+	{
+		separatorNode->values[separatorIndex] = currentNode->values[0];
+		separatorNode->nodes[separatorIndex] = currentNode->nodes[0];
+	}
+}
+
+/**
+ * @fn JNodePtr JRBTreeBPlusFind(const JRBTreeBPlusPtr bplus, void *key)
+ * @brief B+ Tree 엔진에서 키 주소가 같은 노드를 검색하는 함수
+ * IntType, CharType 은 노드마다 캐시 라인 하나의 키 값 배열에서 작은 값의 개수를 세서 내려가고,
+ * 값이 같은 경우에만 노드의 키 주소를 확인한다. StringType 은 노드 안에서 이진 검색한다.
+ * 매개변수 NULL 체크를 수행하지 않음
+ * @param bplus B+ Tree 엔진 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키의 주소(입력)
+ * @return 성공 시 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JRBTreeBPlusFind(const JRBTreeBPlusPtr bplus, void *key)
+{
+	JRBTreeBPlusNodePtr currentNode = bplus->root;
+	if(currentNode == NULL) return NULL;
+
+	int value = _GetValue(bplus->type, key);
+	while(!currentNode->leaf)
+	{
+		int position = _CountLess(bplus, currentNode, value, key);
+		// 분리 키가 찾는 키 자신이면 오른쪽 서브 트리의 가장 작은 키다.
+		if(_IsEntry(currentNode, position, value, key)) position++;
+		currentNode = currentNode->children[position];
+	}
+
+	int position = _CountLess(bplus, currentNode, value, key);
+	if(_IsEntry(currentNode, position, value, key)) return currentNode->nodes[position];
+	return NULL;
+}
+
+/**
+ * @fn JNodePtr JRBTreeBPlusBound(const JRBTreeBPlusPtr bplus, void *key, int upper)
+ * @brief B+ Tree 엔진에서 지정한 키의 값 이상(upper 이면 초과)인 첫 번째 노드를 검색하는 함수
+ * 키 주소가 아니라 값으로 비교한다. 리프의 모든 키가 작으면 연결된 다음 리프의 처음 키가 결과다.
+ * 매개변수 NULL 체크를 수행하지 않음
+ * @param bplus B+ Tree 엔진 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키의 주소(입력)
+ * @param upper 0 이면 이상, 1 이면 초과(입력)
+ * @return 성공 시 노드의 주소, 없으면 NULL 반환
+ */
+JNodePtr JRBTreeBPlusBound(const JRBTreeBPlusPtr bplus, void *key, int upper)
+{
+	JRBTreeBPlusNodePtr currentNode = bplus->root;
+	if(currentNode == NULL) return NULL;
+
+	while(!currentNode->leaf) currentNode = currentNode->children[_CountByValue(bplus, currentNode, key, upper)];
+
+	int position = _CountByValue(bplus, currentNode, key, upper);
+	if(position < currentNode->count) return currentNode->nodes[position];
+	return (currentNode->next != NULL) ? currentNode->next->nodes[0] : NULL;
+}
+
+/**
+ * @fn size_t JRBTreeBPlusReleaseNodes(JRBTreePtr tree)
+ * @brief B+ Tree 엔진이 키마다 할당한 노드를 연결 리스트 순서로 모두 해제하는 함수
+ * 키 소멸자가 지정되어 있으면 같은 순회에서 키도 해제한다. B+ Tree 노드는 해제하지 않는다.
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @return 해제한 노드 개수 반환
+ */
+size_t JRBTreeBPlusReleaseNodes(JRBTreePtr tree)
+{
+	size_t count = 0;
+	JNodePtr currentNode = tree->leftmost;
+	while(currentNode != NULL)
+	{
+		JNodePtr nextNode = currentNode->right;
+		if(tree->keyDestructor != NULL) tree->keyDestructor(currentNode->key);
+		JRBTreeFreeNode(tree, currentNode);
+		currentNode = nextNode;
+		count++;
+	}
+	return count;
+}
+
+/**
+ * @fn size_t JRBTreeBPlusGetBytes(const JRBTreeBPlusPtr bplus)
+ * @brief B+ Tree 엔진이 할당한 메모리 크기를 반환하는 함수 (키마다 할당한 JNode 제외)
+ * @param bplus B+ Tree 엔진 구조체 객체의 주소(입력, 읽기 전용, NULL 가능)
+ * @return 할당한 메모리 크기 반환 (NULL 이면 0)
+ */
+size_t JRBTreeBPlusGetBytes(const JRBTreeBPlusPtr bplus)
+{
+	if(bplus == NULL) return 0;
+	return sizeof(JRBTreeBPlus) + bplus->allocatedBytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// BPlus Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static JRBTreeBPlusNodePtr JRBTreeBPlusSplitChild(JRBTreeBPlusPtr bplus, JRBTreeBPlusNodePtr parent, int index)
+ * @brief 가득 찬 자식 노드를 둘로 나누고 분리 키를 부모 노드에 추가하는 함수
+ * 리프는 뒤쪽 절반을 옮기고 새로운 리프의 처음 키를 분리 키로 복사한다.
+ * 내부 노드는 가운데 분리 키를 부모 노드로 올리고 그 뒤의 분리 키와 자식 노드들을 옮긴다.
+ * @param bplus B+ Tree 엔진 구조체 객체의 주소(입력, 출력)
+ * @param parent 가득 차지 않은 부모 노드(입력, 출력)
+ * @param index 나눌 자식 노드의 위치(입력)
+ * @return 성공 시 새로 만든 오른쪽 노드의 주소, 실패 시 NULL 반환 (트리는 그대로 유지)
+ */
+static JRBTreeBPlusNodePtr JRBTreeBPlusSplitChild(JRBTreeBPlusPtr bplus, JRBTreeBPlusNodePtr parent, int index)
+{
+	JRBTreeBPlusNodePtr childNode = parent->children[index];
+	JRBTreeBPlusNodePtr siblingNode = _NewBPlusNode(bplus, childNode->leaf);
+	if(siblingNode == NULL) return NULL;
+
+	int keepCount = JRBTREE_BPLUS_ORDER / 2;
+	int separatorValue = 0;
+	JNodePtr separatorEntry = NULL;
+	int moveCount = 0;
+
+	if(childNode->leaf)
+	{
+		moveCount = childNode->count - keepCount;
+		memcpy(siblingNode->values, childNode->values + keepCount, sizeof(int) * (size_t)moveCount);
+		memcpy(siblingNode->nodes, childNode->nodes + keepCount, sizeof(JNodePtr) * (size_t)moveCount);
+		siblingNode->next = childNode->next;
+		childNode->next = siblingNode;
+
+		separatorValue = siblingNode->values[0];
+		separatorEntry = siblingNode->nodes[0];
+	}
+	else
+	{
+		moveCount = childNode->count - keepCount - 1;
+		memcpy(siblingNode->values, childNode->values + keepCount + 1, sizeof(int) * (size_t)moveCount);
+		memcpy(siblingNode->nodes, childNode->nodes + keepCount + 1, sizeof(JNodePtr) * (size_t)moveCount);
+		memcpy(siblingNode->children, childNode->children + keepCount + 1, sizeof(JRBTreeBPlusNodePtr) * (size_t)(moveCount + 1));
+
+		separatorValue = childNode->values[keepCount];
+		separatorEntry = childNode->nodes[keepCount];
+	}
+
+	siblingNode->count = moveCount;
+	childNode->count = keepCount;
+	int padIndex = keepCount;
+	for( ; padIndex < JRBTREE_BPLUS_ORDER; padIndex++) childNode->values[padIndex] = INT_MAX;
+
+	_InsertEntry(parent, index, separatorValue, separatorEntry, siblingNode);
+	return siblingNode;
+}
+
+/**
+ * @fn static int JRBTreeBPlusFillChild(JRBTreeBPlusPtr bplus, JRBTreeBPlusNodePtr parent, int index)
+ * @brief 최소 개수인 자식 노드를 이웃 노드에서 빌리거나 이웃 노드와 병합해서 채우는 함수
+ * 이웃 노드가 최소 개수보다 많으면 하나를 빌리고, 아니면 병합한다.
+ * @param bplus B+ Tree 엔진 구조체 객체의 주소(입력, 출력)
+ * @param parent 부모 노드(입력, 출력)
+ * @param index 채울 자식 노드의 위치(입력)
+ * @return 항상 채운 자식 노드의 새로운 위치 반환 (왼쪽 노드와 병합하면 index - 1)
+ */
+static int JRBTreeBPlusFillChild(JRBTreeBPlusPtr bplus, JRBTreeBPlusNodePtr parent, int index)
+{
+	if(index > 0 && parent->children[index - 1]->count > JRBTREE_BPLUS_MIN)
+	{
+		JRBTreeBPlusBorrowLeft(parent, index);
+		return index;
+	}
+	if(index < parent->count && parent->children[index + 1]->count > JRBTREE_BPLUS_MIN)
+	{
+		JRBTreeBPlusBorrowRight(parent, index);
+		return index;
+	}
+
+	if(index < parent->count)
+	{
+		JRBTreeBPlusMerge(bplus, parent, index);
+		return index;
+	}
+	JRBTreeBPlusMerge(bplus, parent, index - 1);
+	return index - 1;
+}
+
+/**
+ * @fn static void JRBTreeBPlusBorrowLeft(JRBTreeBPlusNodePtr parent, int index)
+ * @brief 왼쪽 이웃 노드의 마지막 키(자식 노드)를 지정한 자식 노드의 처음으로 옮기는 함수
+ * @param parent 부모 노드(입력, 출력)
+ * @param index 채울 자식 노드의 위치, 0 보다 커야 한다.(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeBPlusBorrowLeft(JRBTreeBPlusNodePtr parent, int index)
+{
+	JRBTreeBPlusNodePtr childNode = parent->children[index];
+	JRBTreeBPlusNodePtr leftNode = parent->children[index - 1];
+	int lastIndex = leftNode->count - 1;
+
+	memmove(childNode->values + 1, childNode->values, sizeof(int) * (size_t)childNode->count);
+	memmove(childNode->nodes + 1, childNode->nodes, sizeof(JNodePtr) * (size_t)childNode->count);
+
+	if(childNode->leaf)
+	{
+		// 왼쪽 리프의 마지막 키를 처음에 넣고, 분리 키를 새로운 처음 키로 바꾼다.
+		childNode->values[0] = leftNode->values[lastIndex];
+		childNode->nodes[0] = leftNode->nodes[lastIndex];
+		parent->values[index - 1] = childNode->values[0];
+		parent->nodes[index - 1] = childNode->nodes[0];
+	}
+	else
+	{
+		// 부모 노드의 분리 키를 내리고 왼쪽 노드의 마지막 자식 노드를 옮긴 후, 왼쪽 노드의 마지막 분리 키를 올린다.
+		memmove(childNode->children + 1, childNode->children, sizeof(JRBTreeBPlusNodePtr) * (size_t)(childNode->count + 1));
+		childNode->values[0] = parent->values[index - 1];
+		childNode->nodes[0] = parent->nodes[index - 1];
+		childNode->children[0] = leftNode->children[leftNode->count];
+		parent->values[index - 1] = leftNode->values[lastIndex];
+		parent->nodes[index - 1] = leftNode->nodes[lastIndex];
+	}
+
+	childNode->count++;
+	leftNode->count--;
+	leftNode->values[leftNode->count] = INT_MAX;
+}
+
+/**
+ * @fn static void JRBTreeBPlusBorrowRight(JRBTreeBPlusNodePtr parent, int index)
+ * @brief 오른쪽 이웃 노드의 처음 키(자식 노드)를 지정한 자식 노드의 끝으로 옮기는 함수
+ * @param parent 부모 노드(입력, 출력)
+ * @param index 채울 자식 노드의 위치, parent->count 보다 작아야 한다.(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeBPlusBorrowRight(JRBTreeBPlusNodePtr parent, int index)
+{
+	JRBTreeBPlusNodePtr childNode = parent->children[index];
+	JRBTreeBPlusNodePtr rightNode = parent->children[index + 1];
+
+	if(childNode->leaf)
+	{
+		// 오른쪽 리프의 처음 키를 끝에 넣고, 분리 키를 오른쪽 리프의 새로운 처음 키로 바꾼다.
+		childNode->values[childNode->count] = rightNode->values[0];
+		childNode->nodes[childNode->count] = rightNode->nodes[0];
+		childNode->count++;
+		_RemoveEntry(rightNode, 0);
+		parent->values[index] = rightNode->values[0];
+		parent->nodes[index] = rightNode->nodes[0];
+		return;
+	}
+
+	// 부모 노드의 분리 키를 내리고 오른쪽 노드의 처음 자식 노드를 옮긴 후, 오른쪽 노드의 처음 분리 키를 올린다.
+	childNode->values[childNode->count] = parent->values[index];
+	childNode->nodes[childNode->count] = parent->nodes[index];
+	childNode->children[childNode->count + 1] = rightNode->children[0];
+	childNode->count++;
+	parent->values[index] = rightNode->values[0];
+	parent->nodes[index] = rightNode->nodes[0];
+
+	rightNode->count--;
+	memmove(rightNode->values, rightNode->values + 1, sizeof(int) * (size_t)rightNode->count);
+	memmove(rightNode->nodes, rightNode->nodes + 1, sizeof(JNodePtr) * (size_t)rightNode->count);
+	memmove(rightNode->children, rightNode->children + 1, sizeof(JRBTreeBPlusNodePtr) * (size_t)(rightNode->count + 1));
+	rightNode->values[rightNode->count] = INT_MAX;
+}
+
+/**
+ * @fn static void JRBTreeBPlusMerge(JRBTreeBPlusPtr bplus, JRBTreeBPlusNodePtr parent, int index)
+ * @brief 이웃한 두 자식 노드를 왼쪽 노드로 병합하고 오른쪽 노드를 해제하는 함수
+ * 내부 노드는 부모 노드의 분리 키를 두 노드 사이로 내린다. 두 노드 모두 최소 개수일 때만 호출한다.
+ * @param bplus B+ Tree 엔진 구조체 객체의 주소(입력, 출력)
+ * @param parent 부모 노드(입력, 출력)
+ * @param index 왼쪽 자식 노드의 위치(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeBPlusMerge(JRBTreeBPlusPtr bplus, JRBTreeBPlusNodePtr parent, int index)
+{
+	JRBTreeBPlusNodePtr leftNode = parent->children[index];
+	JRBTreeBPlusNodePtr rightNode = parent->children[index + 1];
+
+	if(leftNode->leaf)
+	{
+		leftNode->next = rightNode->next;
+	}
+	else
+	{
+		leftNode->values[leftNode->count] = parent->values[index];
+		leftNode->nodes[leftNode->count] = parent->nodes[index];
+		leftNode->count++;
+		memcpy(leftNode->children + leftNode->count, rightNode->children, sizeof(JRBTreeBPlusNodePtr) * (size_t)(rightNode->count + 1));
+	}
+
+	memcpy(leftNode->values + leftNode->count, rightNode->values, sizeof(int) * (size_t)rightNode->count);
+	memcpy(leftNode->nodes + leftNode->count, rightNode->nodes, sizeof(JNodePtr) * (size_t)rightNode->count);
+	leftNode->count += rightNode->count;
+
+	_RemoveEntry(parent, index);
+	_FreeBPlusNode(bplus, rightNode);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static JRBTreeBPlusNodePtr _NewBPlusNode(JRBTreeBPlusPtr bplus, int leaf)
+ * @brief 캐시 라인 단위로 정렬된 빈 B+ Tree 노드를 할당하는 함수 (키 값 배열의 남는 칸은 INT_MAX)
+ * @param bplus B+ Tree 엔진 구조체 객체의 주소(입력, 출력)
+ * @param leaf 리프 여부, 리프면 자식 노드 배열을 할당하지 않는다.(입력)
+ * @return 성공 시 노드의 주소, 실패 시 NULL 반환
+ */
+static JRBTreeBPlusNodePtr _NewBPlusNode(JRBTreeBPlusPtr bplus, int leaf)
+{
+	size_t size = _GetNodeSize(leaf);
+	JRBTreeBPlusNodePtr newNode = (JRBTreeBPlusNodePtr)aligned_alloc(JRBTREE_BPLUS_ALIGNMENT, size);
+	if(newNode == NULL) return NULL;
+
+	int index = 0;
+	for( ; index < JRBTREE_BPLUS_ORDER; index++) newNode->values[index] = INT_MAX;
+	newNode->next = NULL;
+	newNode->count = 0;
+	newNode->leaf = leaf;
+
+	bplus->allocatedBytes += size;
+	return newNode;
+}
+
+/**
+ * @fn static void _FreeBPlusNode(JRBTreeBPlusPtr bplus, JRBTreeBPlusNodePtr node)
+ * @brief B+ Tree 노드 한 개를 해제하는 함수 (자식 노드는 해제하지 않음)
+ * @param bplus B+ Tree 엔진 구조체 객체의 주소(입력, 출력)
+ * @param node 해제할 노드(입력)
+ * @return 반환값 없음
+ */
+static void _FreeBPlusNode(JRBTreeBPlusPtr bplus, JRBTreeBPlusNodePtr node)
+{
+	bplus->allocatedBytes -= _GetNodeSize(node->leaf);
+	free(node);
+}
+
+/**
+ * @fn static void _FreeBPlusSubtree(JRBTreeBPlusPtr bplus, JRBTreeBPlusNodePtr node)
+ * @brief 지정한 노드를 루트로 하는 서브 트리의 B+ Tree 노드들을 모두 해제하는 함수 (재귀 깊이는 높이 이하)
+ * @param bplus B+ Tree 엔진 구조체 객체의 주소(입력, 출력)
+ * @param node 서브 트리의 루트 노드(입력, NULL 가능)
+ * @return 반환값 없음
+ */
+static void _FreeBPlusSubtree(JRBTreeBPlusPtr bplus, JRBTreeBPlusNodePtr node)
+{
+	if(node == NULL) return;
+	if(!node->leaf)
+	{
+		int index = 0;
+		for( ; index <= node->count; index++) _FreeBPlusSubtree(bplus, node->children[index]);
+	}
+	_FreeBPlusNode(bplus, node);
+}
+
+/**
+ * @fn static size_t _GetNodeSize(int leaf)
+ * @brief B+ Tree 노드 한 개의 할당 크기를 반환하는 함수 (JRBTREE_BPLUS_ALIGNMENT 의 배수)
+ * @param leaf 리프 여부(입력)
+ * @return 항상 할당 크기 반환
+ */
+static size_t _GetNodeSize(int leaf)
+{
+	size_t size = sizeof(JRBTreeBPlusNode) + (leaf ? 0 : sizeof(JRBTreeBPlusNodePtr) * (JRBTREE_BPLUS_ORDER + 1));
+	return (size + JRBTREE_BPLUS_ALIGNMENT - 1) & ~((size_t)JRBTREE_BPLUS_ALIGNMENT - 1);
+}
+
+/**
+ * @fn static void _InsertEntry(JRBTreeBPlusNodePtr node, int position, int value, JNodePtr entryNode, JRBTreeBPlusNodePtr child)
+ * @brief 가득 차지 않은 노드의 지정한 위치에 키를 추가하는 함수 (내부 노드는 키의 오른쪽 자식 노드도 추가)
+ * @param node B+ Tree 노드(입력, 출력)
+ * @param position 추가할 위치(입력)
+ * @param value 키 값(입력)
+ * @param entryNode 키의 노드 주소(입력)
+ * @param child 키의 오른쪽 자식 노드, 리프면 사용하지 않음(입력)
+ * @return 반환값 없음
+ */
+static void _InsertEntry(JRBTreeBPlusNodePtr node, int position, int value, JNodePtr entryNode, JRBTreeBPlusNodePtr child)
+{
+	size_t moveCount = (size_t)(node->count - position);
+	memmove(node->values + position + 1, node->values + position, sizeof(int) * moveCount);
+	memmove(node->nodes + position + 1, node->nodes + position, sizeof(JNodePtr) * moveCount);
+	node->values[position] = value;
+	node->nodes[position] = entryNode;
+	if(!node->leaf)
+	{
+		memmove(node->children + position + 2, node->children + position + 1, sizeof(JRBTreeBPlusNodePtr) * moveCount);
+		node->children[position + 1] = child;
+	}
+	node->count++;
+}
+
+/**
+ * @fn static void _RemoveEntry(JRBTreeBPlusNodePtr node, int position)
+ * @brief 노드의 지정한 위치의 키를 삭제하는 함수 (내부 노드는 키의 오른쪽 자식 노드도 삭제)
+ * @param node B+ Tree 노드(입력, 출력)
+ * @param position 삭제할 위치(입력)
+ * @return 반환값 없음
+ */
+static void _RemoveEntry(JRBTreeBPlusNodePtr node, int position)
+{
+	size_t moveCount = (size_t)(node->count - position - 1);
+	memmove(node->values + position, node->values + position + 1, sizeof(int) * moveCount);
+	memmove(node->nodes + position, node->nodes + position + 1, sizeof(JNodePtr) * moveCount);
+	if(!node->leaf) memmove(node->children + position + 1, node->children + position + 2, sizeof(JRBTreeBPlusNodePtr) * moveCount);
+	node->count--;
+	node->values[node->count] = INT_MAX;
+}
+
+/**
+ * @fn static int _IsEntry(const JRBTreeBPlusNodePtr node, int position, int value, const void *key)
+ * @brief 노드의 지정한 위치에 키 주소가 같은 키가 있는지 확인하는 함수
+ * 값이 같은 경우에만 노드의 키 주소를 읽는다. (StringType 은 값이 항상 0)
+ * @param node B+ Tree 노드(입력, 읽기 전용)
+ * @param position 확인할 위치(입력)
+ * @param value 키 값(입력)
+ * @param key 키의 주소(입력, 읽기 전용)
+ * @return 있으면 1, 없으면 0 반환
+ */
+static int _IsEntry(const JRBTreeBPlusNodePtr node, int position, int value, const void *key)
+{
+	return (position < node->count) && (node->values[position] == value) && (node->nodes[position]->key == key);
+}
+
+/**
+ * @fn static int _CountLess(const JRBTreeBPlusPtr bplus, const JRBTreeBPlusNodePtr node, int value, const void *key)
+ * @brief 노드에서 (값, 키 주소) 순서로 지정한 키보다 작은 키의 개수를 반환하는 함수
+ * IntType, CharType 은 남는 칸이 INT_MAX 인 키 값 배열 전체를 SSE2 로 4 개씩 비교해서 분기 없이 센다.
+ * @param bplus B+ Tree 엔진 구조체 객체의 주소(입력, 읽기 전용)
+ * @param node B+ Tree 노드(입력, 읽기 전용)
+ * @param value 키 값(입력)
+ * @param key 키의 주소(입력, 읽기 전용)
+ * @return 항상 작은 키의 개수 반환 (0 ~ count)
+ */
+static int _CountLess(const JRBTreeBPlusPtr bplus, const JRBTreeBPlusNodePtr node, int value, const void *key)
+{
+	int position = 0;
+	int index = 0;
+
+	if(bplus->type != StringType)
+	{
+#ifdef __SSE2__
+		__m128i valueVector = _mm_set1_epi32(value);
+		for( ; index < JRBTREE_BPLUS_ORDER; index += 4)
+		{
+			__m128i lessVector = _mm_cmpgt_epi32(valueVector, _mm_load_si128((const __m128i*)(node->values + index)));
+			position += __builtin_popcount((unsigned int)_mm_movemask_ps(_mm_castsi128_ps(lessVector)));
+		}
+#else
+		for( ; index < node->count; index++) position += (node->values[index] < value);
+#endif
+		// 같은 값은 키 주소 순서로 정렬되어 있다.
+		while((position < node->count) && (node->values[position] == value) && ((uintptr_t)node->nodes[position]->key < (uintptr_t)key)) position++;
+		return position;
+	}
+
+	int end = node->count;
+	while(position < end)
+	{
+		int middle = position + (end - position) / 2;
+		const void *middleKey = node->nodes[middle]->key;
+		int result = strcmp((const char*)middleKey, (const char*)key);
+		if(result == 0) result = ((uintptr_t)middleKey > (uintptr_t)key) - ((uintptr_t)middleKey < (uintptr_t)key);
+		if(result < 0) position = middle + 1;
+		else end = middle;
+	}
+	return position;
+}
+
+/**
+ * @fn static int _CountByValue(const JRBTreeBPlusPtr bplus, const JRBTreeBPlusNodePtr node, const void *key, int upper)
+ * @brief 노드에서 키 값이 지정한 키의 값보다 작은(upper 이면 작거나 같은) 키의 개수를 반환하는 함수
+ * @param bplus B+ Tree 엔진 구조체 객체의 주소(입력, 읽기 전용)
+ * @param node B+ Tree 노드(입력, 읽기 전용)
+ * @param key 키의 주소(입력, 읽기 전용)
+ * @param upper 0 이면 작은 키, 1 이면 작거나 같은 키의 개수(입력)
+ * @return 항상 키의 개수 반환 (0 ~ count)
+ */
+static int _CountByValue(const JRBTreeBPlusPtr bplus, const JRBTreeBPlusNodePtr node, const void *key, int upper)
+{
+	int position = 0;
+
+	if(bplus->type != StringType)
+	{
+		int value = _GetValue(bplus->type, key);
+		int index = 0;
+		for( ; index < node->count; index++) position += upper ? (node->values[index] <= value) : (node->values[index] < value);
+		return position;
+	}
+
+	int end = node->count;
+	while(position < end)
+	{
+		int middle = position + (end - position) / 2;
+		if(strcmp((const char*)(node->nodes[middle]->key), (const char*)key) < upper) position = middle + 1;
+		else end = middle;
+	}
+	return position;
+}
+
+/**
+ * @fn static int _GetValue(KeyType type, const void *key)
+ * @brief 정수, 문자 키의 값을 정수로 반환하는 함수
+ * @param type 키 데이터 유형(입력)
+ * @param key 키의 주소(입력, 읽기 전용)
+ * @return 항상 키의 값 반환 (StringType 은 0)
+ */
+static int _GetValue(KeyType type, const void *key)
+{
+	if(type == StringType) return 0;
+	if(type == CharType) return (int)*((const char*)key);
+	return *((const int*)key);
+}
@@ -0,0 +1,471 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../include/jrbtree.h"
+#include "jrbtree_internal.h"
+
+// 출력을 모아서 한 번에 기록하는 크기
+#define DUMP_BUFFER_SIZE (64 * 1024)
+
+// 진단 출력 버퍼 구조체
+typedef struct _jrbtree_dump_writer_t {
+	// 출력할 파일 (NULL 이면 output 버퍼에 출력)
+	FILE *fp;
+	// 출력할 사용자 버퍼
+	char *output;
+	// 사용자 버퍼 크기
+	size_t outputSize;
+	// 지금까지 출력한(출력하려 한) 전체 크기
+	size_t totalSize;
+	// 파일 기록 실패 여부
+	int isFailed;
+	// buffer 에 쌓인 크기
+	size_t length;
+	// 파일 출력용 버퍼
+	char buffer[DUMP_BUFFER_SIZE];
+} JRBTreeDumpWriter, *JRBTreeDumpWriterPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Dump Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static void JRBTreeDumpNodes(const JRBTreePtr tree, JRBTreeDumpWriterPtr writer, const JRBTreeDumpOptionPtr option);
+static void JRBTreeDumpNode(const JRBTreePtr tree, JRBTreeDumpWriterPtr writer, DumpFormat format, const JNodePtr node, int depth, int isFirst);
+static void JRBTreeDumpKey(const JRBTreePtr tree, JRBTreeDumpWriterPtr writer, const JNodePtr node, int isEscaped);
+static void JRBTreeDumpWrite(JRBTreeDumpWriterPtr writer, const char *data, size_t size);
+static void JRBTreeDumpWriteString(JRBTreeDumpWriterPtr writer, const char *data);
+static void JRBTreeDumpWriteAddress(JRBTreeDumpWriterPtr writer, const JNodePtr node);
+static void JRBTreeDumpFlush(JRBTreeDumpWriterPtr writer);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static char _NodeColorToChar(NodeColor color);
+static char _GetNodePosition(const JNodePtr node);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for Dump
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn long long JRBTreeDump(const JRBTreePtr tree, FILE *fp, const JRBTreeDumpOptionPtr option)
+ * @brief RB Tree 의 노드들을 지정한 형식으로 파일에 출력하는 함수
+ * 재귀 없이 부모 노드 주소를 따라 한 번만 순회하고, 64KB 씩 모아서 기록한다.
+ * @param tree 출력할 RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param fp 출력할 파일(입력)
+ * @param option 출력 옵션, NULL 이면 전체 노드를 텍스트 형식으로 출력(입력, 읽기 전용)
+ * @return 성공 시 출력한 크기, 실패 시 -1 반환
+ */
+long long JRBTreeDump(const JRBTreePtr tree, FILE *fp, const JRBTreeDumpOptionPtr option)
+{
+	if(tree == NULL || fp == NULL) return -1;
+
+	JRBTreeDumpWriterPtr writer = (JRBTreeDumpWriterPtr)malloc(sizeof(JRBTreeDumpWriter));
+	if(writer == NULL) return -1;
+
+	writer->fp = fp;
+	writer->output = NULL;
+	writer->outputSize = 0;
+	writer->totalSize = 0;
+	writer->isFailed = 0;
+	writer->length = 0;
+
+	JRBTreeDumpNodes(tree, writer, option);
+	JRBTreeDumpFlush(writer);
+
+	long long result = (writer->isFailed == 0) ? (long long)(writer->totalSize) : -1;
+	free(writer);
+
+	return result;
+}
+
+/**
+ * @fn size_t JRBTreeDumpToBuffer(const JRBTreePtr tree, char *buffer, size_t size, const JRBTreeDumpOptionPtr option)
+ * @brief RB Tree 의 노드들을 지정한 형식으로 사용자 버퍼에 출력하는 함수
+ * snprintf 처럼 버퍼가 부족하면 잘라서 저장하고, 항상 널 문자로 끝낸다.
+ * @param tree 출력할 RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param buffer 출력할 버퍼(출력)
+ * @param size 버퍼 크기(입력)
+ * @param option 출력 옵션, NULL 이면 전체 노드를 텍스트 형식으로 출력(입력, 읽기 전용)
+ * @return 버퍼가 충분했다면 출력했을 전체 크기(널 문자 제외), 실패 시 0 반환
+ */
+size_t JRBTreeDumpToBuffer(const JRBTreePtr tree, char *buffer, size_t size, const JRBTreeDumpOptionPtr option)
+{
+	if(tree == NULL || buffer == NULL || size == 0) return 0;
+
+	// 사용자 버퍼에 바로 쓰므로 내부 버퍼가 필요 없다.
+	JRBTreeDumpWriter writer;
+	writer.fp = NULL;
+	writer.output = buffer;
+	writer.outputSize = size - 1;
+	writer.totalSize = 0;
+	writer.isFailed = 0;
+	writer.length = 0;
+
+	JRBTreeDumpNodes(tree, &writer, option);
+
+	size_t terminatorIndex = (writer.totalSize < writer.outputSize) ? writer.totalSize : writer.outputSize;
+	buffer[terminatorIndex] = '\0';
+
+	return writer.totalSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Dump Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void JRBTreeDumpNodes(const JRBTreePtr tree, JRBTreeDumpWriterPtr writer, const JRBTreeDumpOptionPtr option)
+ * @brief 전위 순회 순서로 노드를 방문하면서 출력하는 함수 (재귀 없음)
+ * 부모 노드 주소를 따라 올라가므로 트리 깊이와 상관없이 스택을 사용하지 않는다.
+ * @param tree 출력할 RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param writer 출력 버퍼 구조체 객체의 주소(출력)
+ * @param option 출력 옵션, NULL 가능(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void JRBTreeDumpNodes(const JRBTreePtr tree, JRBTreeDumpWriterPtr writer, const JRBTreeDumpOptionPtr option)
+{
+	DumpFormat format = (option != NULL) ? option->format : DumpText;
+	int maxDepth = (option != NULL) ? option->maxDepth : 0;
+	int sampleRate = (option != NULL) ? option->sampleRate : 1;
+	if(sampleRate < 1) sampleRate = 1;
+
+	switch(format)
+	{
+		case DumpGraphviz:
+			JRBTreeDumpWriteString(writer, "digraph JRBTree {\n\tnode [style=filled, fontcolor=white];\n");
+			break;
+		case DumpJSON:
+			JRBTreeDumpWriteString(writer, "{\"type\":");
+			JRBTreeDumpWriteString(writer, (tree->type == IntType) ? "\"int\"" : ((tree->type == CharType) ? "\"char\"" : "\"string\""));
+			JRBTreeDumpWriteString(writer, ",\"nodes\":[");
+			break;
+		default:
+			format = DumpText;
+			break;
+	}
+
+	JNodePtr currentNode = tree->root;
+	int depth = 1;
+	long visitCount = 0;
+	int isFirst = 1;
+
+	while(currentNode != NULL)
+	{
+		if((visitCount++ % sampleRate) == 0)
+		{
+			JRBTreeDumpNode(tree, writer, format, currentNode, depth, isFirst);
+			isFirst = 0;
+		}
+
+		// 깊이 제한 안에서 왼쪽, 오른쪽 자식 순서로 내려간다.
+		int canDescend = (maxDepth <= 0) || (depth < maxDepth);
+		if(canDescend && (currentNode->left != NULL))
+		{
+			currentNode = currentNode->left;
+			depth++;
+			continue;
+		}
+		if(canDescend && (currentNode->right != NULL))
+		{
+			currentNode = currentNode->right;
+			depth++;
+			continue;
+		}
+
+		// 더 내려갈 수 없으면, 아직 방문하지 않은 오른쪽 자식이 있는 조상 노드까지 올라간다.
+		JNodePtr nextNode = NULL;
+		while((nextNode == NULL) && (currentNode->parent != NULL))
+		{
+			JNodePtr parentNode = currentNode->parent;
+			depth--;
+			if((currentNode == parentNode->left) && (parentNode->right != NULL))
+			{
+				nextNode = parentNode->right;
+				depth++;
+			}
+			else currentNode = parentNode;
+		}
+		currentNode = nextNode;
+	}
+
+	switch(format)
+	{
+		case DumpGraphviz:
+			JRBTreeDumpWriteString(writer, "}\n");
+			break;
+		case DumpJSON:
+			JRBTreeDumpWriteString(writer, "]}\n");
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+ * @fn static void JRBTreeDumpNode(const JRBTreePtr tree, JRBTreeDumpWriterPtr writer, DumpFormat format, const JNodePtr node, int depth, int isFirst)
+ * @brief 노드 하나를 지정한 형식으로 출력하는 함수
+ * @param tree 노드가 속한 RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param writer 출력 버퍼 구조체 객체의 주소(출력)
+ * @param format 출력 형식(입력)
+ * @param node 출력할 노드(입력, 읽기 전용)
+ * @param depth 노드 깊이, 루트 노드가 1(입력)
+ * @param isFirst 처음 출력하는 노드인지 여부, JSON 구분자에 사용(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeDumpNode(const JRBTreePtr tree, JRBTreeDumpWriterPtr writer, DumpFormat format, const JNodePtr node, int depth, int isFirst)
+{
+	char colorText[2] = { _NodeColorToChar(node->color), '\0' };
+	char positionText[2] = { _GetNodePosition(node), '\0' };
+	char depthText[16];
+
+	switch(format)
+	{
+		// 예) \t\t[L] 10(R)
+		case DumpText:
+		{
+			int tabIndex = 0;
+			for( ; tabIndex < depth; tabIndex++) JRBTreeDumpWrite(writer, "\t", 1);
+			JRBTreeDumpWriteString(writer, "[");
+			JRBTreeDumpWriteString(writer, positionText);
+			JRBTreeDumpWriteString(writer, "] ");
+			JRBTreeDumpKey(tree, writer, node, 0);
+			JRBTreeDumpWriteString(writer, "(");
+			JRBTreeDumpWriteString(writer, colorText);
+			JRBTreeDumpWriteString(writer, ") \n");
+			break;
+		}
+		// 예) n55d0c0a0 [label="10", fillcolor=red]; n55d0c000 -> n55d0c0a0;
+		case DumpGraphviz:
+			JRBTreeDumpWriteString(writer, "\tn");
+			JRBTreeDumpWriteAddress(writer, node);
+			JRBTreeDumpWriteString(writer, " [label=\"");
+			JRBTreeDumpKey(tree, writer, node, 1);
+			JRBTreeDumpWriteString(writer, (node->color == Red) ? "\", fillcolor=red];\n" : "\", fillcolor=black];\n");
+			if(node->parent != NULL)
+			{
+				JRBTreeDumpWriteString(writer, "\tn");
+				JRBTreeDumpWriteAddress(writer, node->parent);
+				JRBTreeDumpWriteString(writer, " -> n");
+				JRBTreeDumpWriteAddress(writer, node);
+				JRBTreeDumpWriteString(writer, ";\n");
+			}
+			break;
+		// 예) {"id":"55d0c0a0","parent":"55d0c000","position":"L","depth":2,"color":"R","key":10}
+		case DumpJSON:
+			if(isFirst == 0) JRBTreeDumpWriteString(writer, ",");
+			JRBTreeDumpWriteString(writer, "{\"id\":\"");
+			JRBTreeDumpWriteAddress(writer, node);
+			JRBTreeDumpWriteString(writer, "\",\"parent\":");
+			if(node->parent != NULL)
+			{
+				JRBTreeDumpWriteString(writer, "\"");
+				JRBTreeDumpWriteAddress(writer, node->parent);
+				JRBTreeDumpWriteString(writer, "\"");
+			}
+			else JRBTreeDumpWriteString(writer, "null");
+			JRBTreeDumpWriteString(writer, ",\"position\":\"");
+			JRBTreeDumpWriteString(writer, positionText);
+			JRBTreeDumpWriteString(writer, "\",\"depth\":");
+			JRBTreeDumpWrite(writer, depthText, JRBTreeFormatInt(depth, depthText));
+			JRBTreeDumpWriteString(writer, ",\"color\":\"");
+			JRBTreeDumpWriteString(writer, colorText);
+			JRBTreeDumpWriteString(writer, "\",\"key\":");
+			if(tree->type != IntType) JRBTreeDumpWriteString(writer, "\"");
+			JRBTreeDumpKey(tree, writer, node, 1);
+			if(tree->type != IntType) JRBTreeDumpWriteString(writer, "\"");
+			JRBTreeDumpWriteString(writer, "}");
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+ * @fn static void JRBTreeDumpKey(const JRBTreePtr tree, JRBTreeDumpWriterPtr writer, const JNodePtr node, int isEscaped)
+ * @brief 노드의 키를 문자열로 출력하는 함수
+ * @param tree 노드가 속한 RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param writer 출력 버퍼 구조체 객체의 주소(출력)
+ * @param node 출력할 노드(입력, 읽기 전용)
+ * @param isEscaped 따옴표 안에 출력하기 위해 ", \, 제어 문자를 escape 할지 여부(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeDumpKey(const JRBTreePtr tree, JRBTreeDumpWriterPtr writer, const JNodePtr node, int isEscaped)
+{
+	const char *text = NULL;
+	size_t textLength = 0;
+	char intText[16];
+
+	switch(tree->type)
+	{
+		case IntType:
+			JRBTreeDumpWrite(writer, intText, JRBTreeFormatInt(*((int*)(node->key)), intText));
+			return;
+		case CharType:
+			text = (const char*)(node->key);
+			textLength = 1;
+			break;
+		case StringType:
+			text = (const char*)(node->key);
+			textLength = strlen(text);
+			break;
+		default:
+			return;
+	}
+
+	if(isEscaped == 0)
+	{
+		JRBTreeDumpWrite(writer, text, textLength);
+		return;
+	}
+
+	// escape 가 필요 없는 구간은 한 번에 출력한다.
+	size_t start = 0;
+	size_t index = 0;
+	for( ; index < textLength; index++)
+	{
+		unsigned char character = (unsigned char)text[index];
+		if((character != '"') && (character != '\\') && (character >= 0x20)) continue;
+
+		JRBTreeDumpWrite(writer, text + start, index - start);
+		if(character < 0x20)
+		{
+			static const char hexDigits[] = "0123456789abcdef";
+			char escaped[6] = { '\\', 'u', '0', '0', hexDigits[character >> 4], hexDigits[character & 0xF] };
+			JRBTreeDumpWrite(writer, escaped, sizeof(escaped));
+		}
+		else
+		{
+			char escaped[2] = { '\\', (char)character };
+			JRBTreeDumpWrite(writer, escaped, sizeof(escaped));
+		}
+		start = index + 1;
+	}
+	JRBTreeDumpWrite(writer, text + start, textLength - start);
+}
+
+/**
+ * @fn static void JRBTreeDumpWrite(JRBTreeDumpWriterPtr writer, const char *data, size_t size)
+ * @brief 데이터를 출력 버퍼에 쌓는 함수
+ * 파일 출력이면 내부 버퍼가 가득 찰 때마다 기록하고, 사용자 버퍼 출력이면 남는 공간까지만 복사한다.
+ * @param writer 출력 버퍼 구조체 객체의 주소(출력)
+ * @param data 출력할 데이터(입력, 읽기 전용)
+ * @param size 출력할 크기(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeDumpWrite(JRBTreeDumpWriterPtr writer, const char *data, size_t size)
+{
+	if(writer->fp == NULL)
+	{
+		if(writer->totalSize < writer->outputSize)
+		{
+			size_t copySize = writer->outputSize - writer->totalSize;
+			if(copySize > size) copySize = size;
+			memcpy(writer->output + writer->totalSize, data, copySize);
+		}
+		writer->totalSize += size;
+		return;
+	}
+
+	while(size > 0)
+	{
+		size_t copySize = DUMP_BUFFER_SIZE - writer->length;
+		if(copySize > size) copySize = size;
+
+		memcpy(writer->buffer + writer->length, data, copySize);
+		writer->length += copySize;
+		writer->totalSize += copySize;
+		data += copySize;
+		size -= copySize;
+
+		if(writer->length == DUMP_BUFFER_SIZE) JRBTreeDumpFlush(writer);
+	}
+}
+
+/**
+ * @fn static void JRBTreeDumpWriteString(JRBTreeDumpWriterPtr writer, const char *data)
+ * @brief 널 문자로 끝나는 문자열을 출력 버퍼에 쌓는 함수
+ * @param writer 출력 버퍼 구조체 객체의 주소(출력)
+ * @param data 출력할 문자열(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void JRBTreeDumpWriteString(JRBTreeDumpWriterPtr writer, const char *data)
+{
+	JRBTreeDumpWrite(writer, data, strlen(data));
+}
+
+/**
+ * @fn static void JRBTreeDumpWriteAddress(JRBTreeDumpWriterPtr writer, const JNodePtr node)
+ * @brief 노드 주소를 16진수 문자열로 출력하는 함수 (Graphviz, JSON 의 노드 식별자)
+ * @param writer 출력 버퍼 구조체 객체의 주소(출력)
+ * @param node 출력할 노드(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void JRBTreeDumpWriteAddress(JRBTreeDumpWriterPtr writer, const JNodePtr node)
+{
+	static const char hexDigits[] = "0123456789abcdef";
+	char text[sizeof(uintptr_t) * 2];
+	uintptr_t address = (uintptr_t)node;
+	size_t index = sizeof(text);
+
+	do
+	{
+		text[--index] = hexDigits[address & 0xF];
+		address >>= 4;
+	} while((address > 0) && (index > 0));
+
+	JRBTreeDumpWrite(writer, text + index, sizeof(text) - index);
+}
+
+/**
+ * @fn static void JRBTreeDumpFlush(JRBTreeDumpWriterPtr writer)
+ * @brief 내부 버퍼에 쌓인 출력을 파일에 기록하는 함수
+ * @param writer 출력 버퍼 구조체 객체의 주소(출력)
+ * @return 반환값 없음
+ */
+static void JRBTreeDumpFlush(JRBTreeDumpWriterPtr writer)
+{
+	if((writer->fp == NULL) || (writer->length == 0)) return;
+
+	if(fwrite(writer->buffer, 1, writer->length, writer->fp) != writer->length) writer->isFailed = 1;
+	writer->length = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static char _NodeColorToChar(NodeColor color)
+ * @brief NodeColor 열거형 값을 특정 색을 가리키는 문자로 변환하는 함수
+ * @param color 문자로 변경할 노드의 색(입력, NodeColor 열거형 참고)
+ * @return 성공 시 변환된 문자, 실패 시 널 문자 반환
+ */
+static char _NodeColorToChar(NodeColor color)
+{
+	switch(color)
+	{
+		case Red:
+			return 'R';
+		case Black:
+			return 'B';
+		default:
+			return '\0';
+	}
+}
+
+/**
+ * @fn static char _GetNodePosition(const JNodePtr node)
+ * @brief 노드가 부모 노드의 어느 쪽 자식인지 나타내는 문자를 반환하는 함수
+ * @param node 위치를 확인할 노드(입력, 읽기 전용)
+ * @return 루트 노드면 'B', 왼쪽 자식이면 'L', 오른쪽 자식이면 'R' 반환
+ */
+static char _GetNodePosition(const JNodePtr node)
+{
+	if(node->parent == NULL) return 'B';
+	if(node->parent->left == node) return 'L';
+	return 'R';
+}
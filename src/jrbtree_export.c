@@ -0,0 +1,293 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "../include/jrbtree.h"
+#include "jrbtree_internal.h"
+
+// JRBTreeExportToFd 에서 한 번에 write 하는 크기
+#define EXPORT_BUFFER_SIZE (1024 * 1024)
+
+// 키 하나를 내보낼 때 사용하는 조각 개수
+#define EXPORT_PART_COUNT 3
+
+// 키 하나를 내보낼 때 사용하는 레코드 구조체
+// 레코드는 앞부분(길이 또는 숫자) + 본문(키) + 뒷부분(구분자) 조각을 순서대로 이어 붙인 것이다.
+typedef struct _jrbtree_export_record_t {
+	// 조각 주소
+	const char *parts[EXPORT_PART_COUNT];
+	// 조각 크기
+	size_t partSizes[EXPORT_PART_COUNT];
+} JRBTreeExportRecord, *JRBTreeExportRecordPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Export Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static void JRBTreeExportMakeRecord(JRBTreeExportCursorPtr cursor, JRBTreeExportRecordPtr record);
+static size_t JRBTreeExportCopyRecord(const JRBTreeExportRecordPtr record, size_t recordOffset, char *buffer, size_t size);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int _CheckExportMode(ExportMode mode);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for Export
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JRBTreeExportCursorPtr NewJRBTreeExportCursor(const JRBTreePtr tree, ExportMode mode)
+ * @brief RB Tree 의 키를 정렬 순서로 내보내기 위한 커서 구조체 객체를 생성하는 함수
+ * 커서는 다음에 내보낼 노드만 기억하므로 트리 크기와 상관없이 메모리 사용량이 일정하다.
+ * 내보내는 동안 RB Tree 를 변경하면 안 된다.
+ * @param tree 내보낼 RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param mode 내보낼 형식(입력, ExportMode 열거형 참고)
+ * @return 성공 시 생성된 커서 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JRBTreeExportCursorPtr NewJRBTreeExportCursor(const JRBTreePtr tree, ExportMode mode)
+{
+	if(tree == NULL || _CheckExportMode(mode) == 0) return NULL;
+
+	JRBTreeExportCursorPtr newCursor = (JRBTreeExportCursorPtr)malloc(sizeof(JRBTreeExportCursor));
+	if(newCursor == NULL)
+	{
+		return NULL;
+	}
+
+	newCursor->type = tree->type;
+	newCursor->mode = mode;
+	newCursor->node = tree->leftmost;
+	newCursor->recordOffset = 0;
+
+	return newCursor;
+}
+
+/**
+ * @fn DeleteResult DeleteJRBTreeExportCursor(JRBTreeExportCursorPtrContainer container)
+ * @brief 커서 구조체 객체를 삭제하는 함수
+ * @param container 커서 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJRBTreeExportCursor(JRBTreeExportCursorPtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+	free(*container);
+	*container = NULL;
+	return DeleteSuccess;
+}
+
+/**
+ * @fn size_t JRBTreeExportToBuffer(JRBTreeExportCursorPtr cursor, char *buffer, size_t size)
+ * @brief 커서 위치부터 키를 정렬 순서로 지정한 버퍼가 가득 찰 때까지 기록하는 함수
+ * 키 하나가 버퍼 경계에 걸리면 나머지는 다음 호출에서 이어서 기록한다.
+ * @param cursor 커서 구조체 객체의 주소(입력, 출력)
+ * @param buffer 기록할 버퍼(출력)
+ * @param size 버퍼 크기(입력)
+ * @return 기록한 크기 반환, 모두 내보냈거나 실패 시 0 반환
+ */
+size_t JRBTreeExportToBuffer(JRBTreeExportCursorPtr cursor, char *buffer, size_t size)
+{
+	if(cursor == NULL || buffer == NULL) return 0;
+
+	size_t writtenSize = 0;
+	JRBTreeExportRecord record;
+
+	while((cursor->node != NULL) && (writtenSize < size))
+	{
+		JRBTreeExportMakeRecord(cursor, &record);
+
+		// recordOffset 은 현재 키에서 이미 기록한 크기이므로 남은 부분부터 복사한다.
+		size_t copiedSize = JRBTreeExportCopyRecord(&record, cursor->recordOffset, buffer + writtenSize, size - writtenSize);
+		writtenSize += copiedSize;
+		cursor->recordOffset += copiedSize;
+
+		// 키 하나를 모두 기록했으면 다음 노드로 이동, 아니면 버퍼가 가득 찬 상태
+		if(cursor->recordOffset == record.partSizes[0] + record.partSizes[1] + record.partSizes[2])
+		{
+			cursor->node = JNodeGetNext(cursor->node);
+			cursor->recordOffset = 0;
+		}
+	}
+
+	return writtenSize;
+}
+
+/**
+ * @fn long long JRBTreeExportToFd(const JRBTreePtr tree, int fd, ExportMode mode)
+ * @brief RB Tree 의 모든 키를 정렬 순서로 파일 디스크립터에 기록하는 함수
+ * 1MB 버퍼를 채울 때마다 한 번씩 write 하므로 트리 크기와 상관없이 메모리 사용량이 일정하다.
+ * @param tree 내보낼 RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param fd 기록할 파일 디스크립터(입력)
+ * @param mode 내보낼 형식(입력, ExportMode 열거형 참고)
+ * @return 성공 시 기록한 전체 크기, 실패 시 -1 반환
+ */
+long long JRBTreeExportToFd(const JRBTreePtr tree, int fd, ExportMode mode)
+{
+	if(fd < 0) return -1;
+
+	JRBTreeExportCursorPtr cursor = NewJRBTreeExportCursor(tree, mode);
+	if(cursor == NULL) return -1;
+
+	char *buffer = (char*)malloc(EXPORT_BUFFER_SIZE);
+	if(buffer == NULL)
+	{
+		DeleteJRBTreeExportCursor(&cursor);
+		return -1;
+	}
+
+	long long totalSize = 0;
+	size_t bufferedSize = 0;
+	while((bufferedSize = JRBTreeExportToBuffer(cursor, buffer, EXPORT_BUFFER_SIZE)) > 0)
+	{
+		const char *source = buffer;
+		while(bufferedSize > 0)
+		{
+			ssize_t writtenSize = write(fd, source, bufferedSize);
+			if(writtenSize < 0)
+			{
+				if(errno == EINTR) continue;
+				totalSize = -1;
+				break;
+			}
+			source += writtenSize;
+			bufferedSize -= (size_t)writtenSize;
+			totalSize += writtenSize;
+		}
+		if(totalSize < 0) break;
+	}
+
+	free(buffer);
+	DeleteJRBTreeExportCursor(&cursor);
+
+	return totalSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Export Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void JRBTreeExportMakeRecord(JRBTreeExportCursorPtr cursor, JRBTreeExportRecordPtr record)
+ * @brief 커서가 가리키는 노드의 키를 내보낼 형식에 맞게 조각으로 나누는 함수
+ * JRBTreeExportToBuffer 함수에서 호출되므로 매개변수 NULL 체크를 수행하지 않음
+ * @param cursor 커서 구조체 객체의 주소(입력, scratch 출력)
+ * @param record 키 조각 구조체 객체의 주소(출력)
+ * @return 반환값 없음
+ */
+static void JRBTreeExportMakeRecord(JRBTreeExportCursorPtr cursor, JRBTreeExportRecordPtr record)
+{
+	static const char newline = '\n';
+	static const char terminator = '\0';
+	const char *key = (const char*)(cursor->node->key);
+
+	// [0] 앞부분, [1] 본문, [2] 뒷부분
+	memset(record, 0, sizeof(JRBTreeExportRecord));
+
+	switch(cursor->type)
+	{
+		case IntType:
+			// 텍스트 형식이면 10진수 문자열, 아니면 정수 값 그대로
+			if(cursor->mode == ExportNewline)
+			{
+				record->parts[1] = cursor->scratch;
+				record->partSizes[1] = JRBTreeFormatInt(*((int*)(cursor->node->key)), cursor->scratch);
+			}
+			else
+			{
+				record->parts[1] = key;
+				record->partSizes[1] = sizeof(int);
+			}
+			break;
+		case CharType:
+			record->parts[1] = key;
+			record->partSizes[1] = sizeof(char);
+			break;
+		case StringType:
+			record->parts[1] = key;
+			record->partSizes[1] = strlen(key);
+			// 이진 형식의 문자열은 널 문자로 구분한다.
+			if(cursor->mode == ExportBinary)
+			{
+				record->parts[2] = &terminator;
+				record->partSizes[2] = 1;
+			}
+			break;
+		default:
+			break;
+	}
+
+	if(cursor->mode == ExportNewline)
+	{
+		record->parts[2] = &newline;
+		record->partSizes[2] = 1;
+	}
+	else if(cursor->mode == ExportLengthPrefixed)
+	{
+		// 길이는 scratch 의 뒤쪽에 저장해서 정수 문자열과 겹치지 않게 한다.
+		uint32_t length = (uint32_t)record->partSizes[1];
+		memcpy(cursor->scratch + sizeof(cursor->scratch) - sizeof(uint32_t), &length, sizeof(uint32_t));
+		record->parts[0] = cursor->scratch + sizeof(cursor->scratch) - sizeof(uint32_t);
+		record->partSizes[0] = sizeof(uint32_t);
+	}
+}
+
+/**
+ * @fn static size_t JRBTreeExportCopyRecord(const JRBTreeExportRecordPtr record, size_t recordOffset, char *buffer, size_t size)
+ * @brief 레코드에서 이미 기록한 부분을 건너뛰고 남은 부분을 버퍼 크기만큼 복사하는 함수
+ * @param record 레코드 구조체 객체의 주소(입력, 읽기 전용)
+ * @param recordOffset 레코드에서 이미 기록한 크기(입력)
+ * @param buffer 복사할 버퍼(출력)
+ * @param size 버퍼의 남은 크기(입력)
+ * @return 복사한 크기 반환
+ */
+static size_t JRBTreeExportCopyRecord(const JRBTreeExportRecordPtr record, size_t recordOffset, char *buffer, size_t size)
+{
+	size_t copiedSize = 0;
+	size_t partStart = 0;
+	int partIndex = 0;
+
+	for( ; (partIndex < EXPORT_PART_COUNT) && (copiedSize < size); partIndex++)
+	{
+		size_t partEnd = partStart + record->partSizes[partIndex];
+		if(recordOffset < partEnd)
+		{
+			size_t copySize = partEnd - recordOffset;
+			if(copySize > size - copiedSize) copySize = size - copiedSize;
+
+			memcpy(buffer + copiedSize, record->parts[partIndex] + (recordOffset - partStart), copySize);
+			copiedSize += copySize;
+			recordOffset += copySize;
+		}
+		partStart = partEnd;
+	}
+
+	return copiedSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int _CheckExportMode(ExportMode mode)
+ * @brief 지정한 내보내기 형식이 정의된 형식인지 검사하는 함수
+ * @param mode 검사할 형식(입력)
+ * @return 정의된 형식이면 1, 아니면 0 반환
+ */
+static int _CheckExportMode(ExportMode mode)
+{
+	switch(mode)
+	{
+		case ExportBinary:
+		case ExportNewline:
+		case ExportLengthPrefixed:
+			return 1;
+		default:
+			return 0;
+	}
+}
@@ -0,0 +1,287 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define JRBTREE_FROZEN_X86
+#endif
+
+#include "../include/jrbtree.h"
+#include "jrbtree_internal.h"
+
+// 블록 하나의 자식 블록 개수
+#define FROZEN_FANOUT (JRBTREE_FROZEN_BLOCK_SIZE + 1)
+// 키 배열 정렬 단위 (캐시 라인 크기)
+#define FROZEN_ALIGNMENT 64
+// 검색 실패 시 반환하는 키 배열 위치
+#define FROZEN_NO_SLOT ((size_t)-1)
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of JRBTreeFrozen Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static void JRBTreeFrozenBuild(JRBTreeFrozenPtr frozen, size_t block, JNodePtrContainer cursor);
+static size_t JRBTreeFrozenSearchScalar(const JRBTreeFrozenPtr frozen, int key);
+#ifdef JRBTREE_FROZEN_X86
+static size_t JRBTreeFrozenSearchSSE2(const JRBTreeFrozenPtr frozen, int key);
+static size_t JRBTreeFrozenSearchAVX2(const JRBTreeFrozenPtr frozen, int key);
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static FrozenSearchType _GetFrozenSearchType();
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JRBTreeFrozen
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JRBTreeFrozenPtr NewJRBTreeFrozen(const JRBTreePtr tree)
+ * @brief 정수 키 RB Tree 를 블록(64 bytes) 단위 정적 검색 트리로 변환하는 함수
+ * 변환 이후 원본 RB Tree 가 변경되면 결과가 맞지 않으므로 다시 생성해야 한다.
+ * 원본 노드의 주소를 같이 저장하므로 원본 RB Tree 보다 먼저 삭제해야 한다.
+ * @param tree 변환할 RB Tree 구조체 객체의 주소(입력, 읽기 전용, IntType 만 가능)
+ * @return 성공 시 생성된 정적 검색 트리 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JRBTreeFrozenPtr NewJRBTreeFrozen(const JRBTreePtr tree)
+{
+	if(tree == NULL || tree->type != IntType) return NULL;
+
+	JRBTreeFrozenPtr newFrozen = (JRBTreeFrozenPtr)malloc(sizeof(JRBTreeFrozen));
+	if(newFrozen == NULL)
+	{
+		return NULL;
+	}
+
+	newFrozen->count = tree->size;
+	newFrozen->blockCount = (tree->size + JRBTREE_FROZEN_BLOCK_SIZE - 1) / JRBTREE_FROZEN_BLOCK_SIZE;
+	newFrozen->searchType = _GetFrozenSearchType();
+
+	size_t slotCount = newFrozen->blockCount * JRBTREE_FROZEN_BLOCK_SIZE;
+	// aligned_alloc 은 크기가 정렬 단위의 배수여야 하며, 빈 트리도 블록 하나는 할당한다.
+	size_t keysSize = (slotCount > 0 ? slotCount : JRBTREE_FROZEN_BLOCK_SIZE) * sizeof(int);
+	newFrozen->keys = (int*)aligned_alloc(FROZEN_ALIGNMENT, keysSize);
+	newFrozen->nodes = (JNodePtr*)malloc((slotCount > 0 ? slotCount : 1) * sizeof(JNodePtr));
+	if(newFrozen->keys == NULL || newFrozen->nodes == NULL)
+	{
+		free(newFrozen->keys);
+		free(newFrozen->nodes);
+		free(newFrozen);
+		return NULL;
+	}
+
+	JNodePtr currentNode = tree->leftmost;
+	JRBTreeFrozenBuild(newFrozen, 0, &currentNode);
+
+	return newFrozen;
+}
+
+/**
+ * @fn DeleteResult DeleteJRBTreeFrozen(JRBTreeFrozenPtrContainer container)
+ * @brief 정적 검색 트리 구조체 객체를 삭제하는 함수 (원본 RB Tree 의 노드는 삭제하지 않음)
+ * @param container 정적 검색 트리 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJRBTreeFrozen(JRBTreeFrozenPtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	free((*container)->keys);
+	free((*container)->nodes);
+	free(*container);
+	*container = NULL;
+
+	return DeleteSuccess;
+}
+
+/**
+ * @fn JNodePtr JRBTreeFrozenFindNodeByKey(const JRBTreeFrozenPtr frozen, void *key)
+ * @brief 정적 검색 트리에서 지정한 키 값과 같은 키를 가진 원본 노드를 검색하는 함수
+ * 블록마다 한 번의 SIMD 비교로 다음 블록을 정하므로 약 log16(n) 번의 캐시 미스로 검색한다.
+ * JRBTreeFindNodeByKey 와 달리 키의 주소가 아닌 키 값으로 비교한다.
+ * @param frozen 정적 검색 트리 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 정수 키의 주소(입력)
+ * @return 성공 시 원본 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JRBTreeFrozenFindNodeByKey(const JRBTreeFrozenPtr frozen, void *key)
+{
+	if(frozen == NULL || key == NULL) return NULL;
+
+	int value = *((int*)key);
+	size_t slot = FROZEN_NO_SLOT;
+
+	switch(frozen->searchType)
+	{
+#ifdef JRBTREE_FROZEN_X86
+		case FrozenAVX2:
+			slot = JRBTreeFrozenSearchAVX2(frozen, value);
+			break;
+		case FrozenSSE2:
+			slot = JRBTreeFrozenSearchSSE2(frozen, value);
+			break;
+#endif
+		default:
+			slot = JRBTreeFrozenSearchScalar(frozen, value);
+			break;
+	}
+
+	// 찾은 위치는 value 이상인 첫 번째 키이므로 값이 같은지 확인한다. (남는 칸은 nodes 가 NULL)
+	if(slot == FROZEN_NO_SLOT || frozen->keys[slot] != value) return NULL;
+	return frozen->nodes[slot];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// JRBTreeFrozen Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void JRBTreeFrozenBuild(JRBTreeFrozenPtr frozen, size_t block, JNodePtrContainer cursor)
+ * @brief 원본 RB Tree 를 중위 순회하면서 정적 검색 트리의 블록을 채우는 함수(재귀, 깊이는 log17(n))
+ * 블록의 i 번째 키보다 작은 키는 모두 i 번째 자식 블록에 들어가도록 자식 블록을 먼저 채운다.
+ * @param frozen 정적 검색 트리 구조체 객체의 주소(출력)
+ * @param block 채울 블록 번호(입력)
+ * @param cursor 다음에 저장할 원본 노드의 주소를 저장한 이중 포인터(입력, 출력)
+ * @return 반환값 없음
+ */
+static void JRBTreeFrozenBuild(JRBTreeFrozenPtr frozen, size_t block, JNodePtrContainer cursor)
+{
+	if(block >= frozen->blockCount) return;
+
+	size_t keyIndex = 0;
+	for( ; keyIndex < JRBTREE_FROZEN_BLOCK_SIZE; keyIndex++)
+	{
+		JRBTreeFrozenBuild(frozen, block * FROZEN_FANOUT + keyIndex + 1, cursor);
+
+		size_t slot = block * JRBTREE_FROZEN_BLOCK_SIZE + keyIndex;
+		if(*cursor != NULL)
+		{
+			frozen->keys[slot] = *((int*)((*cursor)->key));
+			frozen->nodes[slot] = *cursor;
+			*cursor = JNodeGetNext(*cursor);
+		}
+		// 남는 칸은 가장 큰 값으로 채워서 항상 오른쪽 끝에 오도록 한다.
+		else
+		{
+			frozen->keys[slot] = INT_MAX;
+			frozen->nodes[slot] = NULL;
+		}
+	}
+
+	JRBTreeFrozenBuild(frozen, block * FROZEN_FANOUT + JRBTREE_FROZEN_BLOCK_SIZE + 1, cursor);
+}
+
+/**
+ * @fn static size_t JRBTreeFrozenSearchScalar(const JRBTreeFrozenPtr frozen, int key)
+ * @brief 일반 비교로 key 이상인 첫 번째 키의 위치를 검색하는 함수
+ * @param frozen 정적 검색 트리 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키 값(입력)
+ * @return 성공 시 키 배열에서의 위치, 실패 시 FROZEN_NO_SLOT 반환
+ */
+static size_t JRBTreeFrozenSearchScalar(const JRBTreeFrozenPtr frozen, int key)
+{
+	size_t block = 0;
+	size_t slot = FROZEN_NO_SLOT;
+
+	while(block < frozen->blockCount)
+	{
+		const int *keys = frozen->keys + block * JRBTREE_FROZEN_BLOCK_SIZE;
+		size_t rank = 0;
+		size_t keyIndex = 0;
+
+		// 블록 안의 키는 정렬되어 있으므로 key 보다 작은 키의 개수가 곧 자식 블록 번호
+		for( ; keyIndex < JRBTREE_FROZEN_BLOCK_SIZE; keyIndex++) rank += (keys[keyIndex] < key);
+
+		if(rank < JRBTREE_FROZEN_BLOCK_SIZE) slot = block * JRBTREE_FROZEN_BLOCK_SIZE + rank;
+		block = block * FROZEN_FANOUT + rank + 1;
+	}
+
+	return slot;
+}
+
+#ifdef JRBTREE_FROZEN_X86
+/**
+ * @fn static size_t JRBTreeFrozenSearchSSE2(const JRBTreeFrozenPtr frozen, int key)
+ * @brief SSE2 compare + movemask 로 key 이상인 첫 번째 키의 위치를 검색하는 함수
+ * @param frozen 정적 검색 트리 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키 값(입력)
+ * @return 성공 시 키 배열에서의 위치, 실패 시 FROZEN_NO_SLOT 반환
+ */
+__attribute__((target("sse2")))
+static size_t JRBTreeFrozenSearchSSE2(const JRBTreeFrozenPtr frozen, int key)
+{
+	size_t block = 0;
+	size_t slot = FROZEN_NO_SLOT;
+	__m128i keyVector = _mm_set1_epi32(key);
+
+	while(block < frozen->blockCount)
+	{
+		const __m128i *keys = (const __m128i*)(frozen->keys + block * JRBTREE_FROZEN_BLOCK_SIZE);
+
+		// key > keys[i] 인 위치의 비트를 모은다.
+		unsigned int mask = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(keyVector, _mm_load_si128(keys))));
+		mask |= (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(keyVector, _mm_load_si128(keys + 1)))) << 4;
+		mask |= (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(keyVector, _mm_load_si128(keys + 2)))) << 8;
+		mask |= (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(keyVector, _mm_load_si128(keys + 3)))) << 12;
+		size_t rank = (size_t)__builtin_popcount(mask);
+
+		if(rank < JRBTREE_FROZEN_BLOCK_SIZE) slot = block * JRBTREE_FROZEN_BLOCK_SIZE + rank;
+		block = block * FROZEN_FANOUT + rank + 1;
+	}
+
+	return slot;
+}
+
+/**
+ * @fn static size_t JRBTreeFrozenSearchAVX2(const JRBTreeFrozenPtr frozen, int key)
+ * @brief AVX2 compare + movemask 로 key 이상인 첫 번째 키의 위치를 검색하는 함수
+ * AVX2 를 지원하는 CPU 에서만 호출해야 한다. (_GetFrozenSearchType 참고)
+ * @param frozen 정적 검색 트리 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키 값(입력)
+ * @return 성공 시 키 배열에서의 위치, 실패 시 FROZEN_NO_SLOT 반환
+ */
+__attribute__((target("avx2,popcnt")))
+static size_t JRBTreeFrozenSearchAVX2(const JRBTreeFrozenPtr frozen, int key)
+{
+	size_t block = 0;
+	size_t slot = FROZEN_NO_SLOT;
+	__m256i keyVector = _mm256_set1_epi32(key);
+
+	while(block < frozen->blockCount)
+	{
+		const __m256i *keys = (const __m256i*)(frozen->keys + block * JRBTREE_FROZEN_BLOCK_SIZE);
+
+		// key > keys[i] 인 위치의 비트를 모은다.
+		unsigned int mask = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(keyVector, _mm256_load_si256(keys))));
+		mask |= (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(keyVector, _mm256_load_si256(keys + 1)))) << 8;
+		size_t rank = (size_t)__builtin_popcount(mask);
+
+		if(rank < JRBTREE_FROZEN_BLOCK_SIZE) slot = block * JRBTREE_FROZEN_BLOCK_SIZE + rank;
+		block = block * FROZEN_FANOUT + rank + 1;
+	}
+
+	return slot;
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static FrozenSearchType _GetFrozenSearchType()
+ * @brief 실행 중인 CPU 가 지원하는 가장 빠른 블록 검색 방식을 반환하는 함수 (CPUID)
+ * @return 항상 사용할 검색 방식 반환(FrozenSearchType 열거형 참고)
+ */
+static FrozenSearchType _GetFrozenSearchType()
+{
+#ifdef JRBTREE_FROZEN_X86
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) return FrozenAVX2;
+	if(__builtin_cpu_supports("sse2")) return FrozenSSE2;
+#endif
+	return FrozenScalar;
+}
@@ -0,0 +1,302 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/jrbtree.h"
+#include "jrbtree_internal.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static size_t _GetCommonPrefixLength(const unsigned char *string1, size_t length1, const unsigned char *string2, size_t length2);
+static int _CompareBytes(const unsigned char *string1, size_t length1, const unsigned char *string2, size_t length2);
+static size_t _GetVarintSize(size_t value);
+static size_t _PutVarint(unsigned char *buffer, size_t value);
+static size_t _GetVarint(const unsigned char *buffer, size_t *offset);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JRBTreeFrozenString
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JRBTreeFrozenStringPtr NewJRBTreeFrozenString(const JRBTreePtr tree)
+ * @brief 문자열 키 RB Tree 를 앞부분 압축(front coding) 정렬 배열로 변환하는 함수
+ * 정렬된 키는 앞 키와 공통 접두사를 공유하는 경우가 많으므로(URL, 경로 등) 공통 접두사는 길이만 저장한다.
+ * 변환 이후 원본 RB Tree 가 변경되면 결과가 맞지 않으므로 다시 생성해야 한다.
+ * 원본 노드의 주소를 같이 저장하므로 원본 RB Tree 보다 먼저 삭제해야 한다.
+ * @param tree 변환할 RB Tree 구조체 객체의 주소(입력, 읽기 전용, StringType 만 가능)
+ * @return 성공 시 생성된 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JRBTreeFrozenStringPtr NewJRBTreeFrozenString(const JRBTreePtr tree)
+{
+	if(tree == NULL || tree->type != StringType) return NULL;
+
+	JRBTreeFrozenStringPtr newFrozen = (JRBTreeFrozenStringPtr)malloc(sizeof(JRBTreeFrozenString));
+	if(newFrozen == NULL)
+	{
+		return NULL;
+	}
+
+	// 첫 번째 순회에서 압축된 크기를 계산한다.
+	size_t count = 0;
+	size_t dataSize = 0;
+	const unsigned char *previousKey = NULL;
+	size_t previousLength = 0;
+	JNodePtr currentNode = tree->leftmost;
+	for( ; currentNode != NULL; currentNode = JNodeGetNext(currentNode), count++)
+	{
+		const unsigned char *currentKey = (const unsigned char*)currentNode->key;
+		size_t currentLength = strlen((const char*)currentKey);
+		size_t prefixLength = 0;
+		if(count % JRBTREE_FROZEN_STRING_BLOCK_SIZE != 0)
+		{
+			prefixLength = _GetCommonPrefixLength(previousKey, previousLength, currentKey, currentLength);
+			dataSize += _GetVarintSize(prefixLength);
+		}
+		dataSize += _GetVarintSize(currentLength - prefixLength) + (currentLength - prefixLength);
+
+		previousKey = currentKey;
+		previousLength = currentLength;
+	}
+
+	newFrozen->count = count;
+	newFrozen->blockCount = (count + JRBTREE_FROZEN_STRING_BLOCK_SIZE - 1) / JRBTREE_FROZEN_STRING_BLOCK_SIZE;
+	newFrozen->dataSize = dataSize;
+	newFrozen->data = (unsigned char*)malloc(dataSize > 0 ? dataSize : 1);
+	newFrozen->blockOffsets = (size_t*)malloc((newFrozen->blockCount > 0 ? newFrozen->blockCount : 1) * sizeof(size_t));
+	newFrozen->nodes = (JNodePtr*)malloc((count > 0 ? count : 1) * sizeof(JNodePtr));
+	if(newFrozen->data == NULL || newFrozen->blockOffsets == NULL || newFrozen->nodes == NULL)
+	{
+		free(newFrozen->data);
+		free(newFrozen->blockOffsets);
+		free(newFrozen->nodes);
+		free(newFrozen);
+		return NULL;
+	}
+
+	// 두 번째 순회에서 키를 압축해서 저장한다.
+	size_t offset = 0;
+	size_t keyIndex = 0;
+	previousKey = NULL;
+	previousLength = 0;
+	currentNode = tree->leftmost;
+	for( ; currentNode != NULL; currentNode = JNodeGetNext(currentNode), keyIndex++)
+	{
+		const unsigned char *currentKey = (const unsigned char*)currentNode->key;
+		size_t currentLength = strlen((const char*)currentKey);
+		size_t prefixLength = 0;
+		if(keyIndex % JRBTREE_FROZEN_STRING_BLOCK_SIZE == 0)
+		{
+			newFrozen->blockOffsets[keyIndex / JRBTREE_FROZEN_STRING_BLOCK_SIZE] = offset;
+		}
+		else
+		{
+			prefixLength = _GetCommonPrefixLength(previousKey, previousLength, currentKey, currentLength);
+			offset += _PutVarint(newFrozen->data + offset, prefixLength);
+		}
+		offset += _PutVarint(newFrozen->data + offset, currentLength - prefixLength);
+		memcpy(newFrozen->data + offset, currentKey + prefixLength, currentLength - prefixLength);
+		offset += currentLength - prefixLength;
+
+		newFrozen->nodes[keyIndex] = currentNode;
+		previousKey = currentKey;
+		previousLength = currentLength;
+	}
+
+	return newFrozen;
+}
+
+/**
+ * @fn DeleteResult DeleteJRBTreeFrozenString(JRBTreeFrozenStringPtrContainer container)
+ * @brief 앞부분 압축 정렬 배열 구조체 객체를 삭제하는 함수 (원본 RB Tree 의 노드는 삭제하지 않음)
+ * @param container 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJRBTreeFrozenString(JRBTreeFrozenStringPtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	free((*container)->data);
+	free((*container)->blockOffsets);
+	free((*container)->nodes);
+	free(*container);
+	*container = NULL;
+
+	return DeleteSuccess;
+}
+
+/**
+ * @fn JNodePtr JRBTreeFrozenStringFindNodeByKey(const JRBTreeFrozenStringPtr frozen, const char *key)
+ * @brief 앞부분 압축 정렬 배열에서 지정한 문자열과 같은 키를 가진 원본 노드를 검색하는 함수
+ * 블록의 첫 키(압축되지 않음)로 이진 검색한 후, 블록 안에서는 키를 복원하지 않고
+ * 검색할 키와 일치한 길이와 공통 접두사 길이만 비교하면서 순서대로 검사한다. (O(log(n / 16) + 16))
+ * JRBTreeFindNodeByKey 와 달리 키의 주소가 아닌 키 값으로 비교한다.
+ * @param frozen 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 문자열(입력, 읽기 전용)
+ * @return 성공 시 원본 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JRBTreeFrozenStringFindNodeByKey(const JRBTreeFrozenStringPtr frozen, const char *key)
+{
+	if(frozen == NULL || key == NULL || frozen->count == 0) return NULL;
+
+	const unsigned char *searchKey = (const unsigned char*)key;
+	size_t searchLength = strlen(key);
+
+	// 첫 키가 검색할 키보다 큰 첫 번째 블록을 찾는다.
+	size_t low = 0;
+	size_t high = frozen->blockCount;
+	while(low < high)
+	{
+		size_t middle = low + (high - low) / 2;
+		size_t offset = frozen->blockOffsets[middle];
+		size_t headLength = _GetVarint(frozen->data, &offset);
+		if(_CompareBytes(frozen->data + offset, headLength, searchKey, searchLength) <= 0) low = middle + 1;
+		else high = middle;
+	}
+	if(low == 0) return NULL;
+
+	size_t block = low - 1;
+	size_t offset = frozen->blockOffsets[block];
+	size_t headLength = _GetVarint(frozen->data, &offset);
+	size_t matchedLength = _GetCommonPrefixLength(frozen->data + offset, headLength, searchKey, searchLength);
+	offset += headLength;
+
+	size_t keyIndex = block * JRBTREE_FROZEN_STRING_BLOCK_SIZE;
+	if(matchedLength == headLength && matchedLength == searchLength) return frozen->nodes[keyIndex];
+
+	// 이전 키는 항상 검색할 키보다 작고, matchedLength 는 이전 키와 검색할 키의 공통 접두사 길이이다.
+	size_t endIndex = keyIndex + JRBTREE_FROZEN_STRING_BLOCK_SIZE;
+	if(endIndex > frozen->count) endIndex = frozen->count;
+	for(keyIndex++; keyIndex < endIndex; keyIndex++)
+	{
+		size_t prefixLength = _GetVarint(frozen->data, &offset);
+		size_t suffixLength = _GetVarint(frozen->data, &offset);
+		const unsigned char *suffix = frozen->data + offset;
+		offset += suffixLength;
+
+		// 이전 키와 더 길게 같으면 검색할 키와 다른 위치도 같으므로 여전히 작다.
+		if(prefixLength > matchedLength) continue;
+		// 더 짧게 같으면 이 키는 검색할 키가 이전 키와 같았던 위치에서 이미 크다.
+		if(prefixLength < matchedLength) return NULL;
+
+		size_t sameLength = _GetCommonPrefixLength(suffix, suffixLength, searchKey + matchedLength, searchLength - matchedLength);
+		if(sameLength == suffixLength)
+		{
+			if(matchedLength + sameLength == searchLength) return frozen->nodes[keyIndex];
+			// 이 키가 검색할 키의 접두사이면 작다.
+			matchedLength += sameLength;
+			continue;
+		}
+		if(matchedLength + sameLength == searchLength || suffix[sameLength] > searchKey[matchedLength + sameLength]) return NULL;
+		matchedLength += sameLength;
+	}
+
+	return NULL;
+}
+
+/**
+ * @fn size_t JRBTreeFrozenStringGetBytes(const JRBTreeFrozenStringPtr frozen)
+ * @brief 앞부분 압축 정렬 배열이 할당한 전체 메모리 크기를 반환하는 함수 (구조체 + 키 데이터 + 블록 오프셋 + 노드 주소)
+ * @param frozen 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 메모리 크기, 실패 시 0 반환
+ */
+size_t JRBTreeFrozenStringGetBytes(const JRBTreeFrozenStringPtr frozen)
+{
+	if(frozen == NULL) return 0;
+	return sizeof(JRBTreeFrozenString) + frozen->dataSize + frozen->blockCount * sizeof(size_t) + frozen->count * sizeof(JNodePtr);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static size_t _GetCommonPrefixLength(const unsigned char *string1, size_t length1, const unsigned char *string2, size_t length2)
+ * @brief 두 바이트 배열의 공통 접두사 길이를 반환하는 함수
+ * @param string1 첫 번째 바이트 배열(입력, 읽기 전용)
+ * @param length1 첫 번째 바이트 배열 길이(입력)
+ * @param string2 두 번째 바이트 배열(입력, 읽기 전용)
+ * @param length2 두 번째 바이트 배열 길이(입력)
+ * @return 항상 공통 접두사 길이 반환
+ */
+static size_t _GetCommonPrefixLength(const unsigned char *string1, size_t length1, const unsigned char *string2, size_t length2)
+{
+	size_t maxLength = (length1 < length2) ? length1 : length2;
+	size_t index = 0;
+	while((index < maxLength) && (string1[index] == string2[index])) index++;
+	return index;
+}
+
+/**
+ * @fn static int _CompareBytes(const unsigned char *string1, size_t length1, const unsigned char *string2, size_t length2)
+ * @brief 길이가 정해진 두 바이트 배열을 strcmp 와 같은 순서로 비교하는 함수
+ * @param string1 첫 번째 바이트 배열(입력, 읽기 전용)
+ * @param length1 첫 번째 바이트 배열 길이(입력)
+ * @param string2 두 번째 바이트 배열(입력, 읽기 전용)
+ * @param length2 두 번째 바이트 배열 길이(입력)
+ * @return string1 이 작으면 음수, 같으면 0, 크면 양수 반환
+ */
+static int _CompareBytes(const unsigned char *string1, size_t length1, const unsigned char *string2, size_t length2)
+{
+	size_t prefixLength = _GetCommonPrefixLength(string1, length1, string2, length2);
+	if(prefixLength < length1 && prefixLength < length2) return (int)string1[prefixLength] - (int)string2[prefixLength];
+	return (length1 > length2) - (length1 < length2);
+}
+
+/**
+ * @fn static size_t _GetVarintSize(size_t value)
+ * @brief 7 bit 가변 길이 정수로 저장할 때의 크기를 반환하는 함수
+ * @param value 저장할 값(입력)
+ * @return 항상 바이트 수 반환
+ */
+static size_t _GetVarintSize(size_t value)
+{
+	size_t size = 1;
+	while(value >= 0x80)
+	{
+		value >>= 7;
+		size++;
+	}
+	return size;
+}
+
+/**
+ * @fn static size_t _PutVarint(unsigned char *buffer, size_t value)
+ * @brief 값을 7 bit 가변 길이 정수로 저장하는 함수 (하위 7 bit 부터, 최상위 bit 는 다음 바이트 존재 여부)
+ * @param buffer 저장할 버퍼(출력)
+ * @param value 저장할 값(입력)
+ * @return 항상 저장한 바이트 수 반환
+ */
+static size_t _PutVarint(unsigned char *buffer, size_t value)
+{
+	size_t size = 0;
+	while(value >= 0x80)
+	{
+		buffer[size++] = (unsigned char)((value & 0x7F) | 0x80);
+		value >>= 7;
+	}
+	buffer[size++] = (unsigned char)value;
+	return size;
+}
+
+/**
+ * @fn static size_t _GetVarint(const unsigned char *buffer, size_t *offset)
+ * @brief 7 bit 가변 길이 정수를 읽는 함수
+ * @param buffer 읽을 버퍼(입력, 읽기 전용)
+ * @param offset 읽을 위치, 읽은 바이트 수만큼 증가한다.(입력, 출력)
+ * @return 항상 읽은 값 반환
+ */
+static size_t _GetVarint(const unsigned char *buffer, size_t *offset)
+{
+	size_t value = 0;
+	int shift = 0;
+	unsigned char byte = 0;
+	do
+	{
+		byte = buffer[(*offset)++];
+		value |= (size_t)(byte & 0x7F) << shift;
+		shift += 7;
+	} while(byte & 0x80);
+	return value;
+}
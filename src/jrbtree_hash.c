@@ -0,0 +1,297 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/jrbtree.h"
+#include "../include/jrbtree_inline.h"
+#include "jrbtree_internal.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int _ResizeHashIndex(JRBTreeHashIndexPtr index, size_t capacity);
+static size_t _HashKey(KeyType type, const void *key);
+static size_t _GetHome(const JRBTreeHashIndexPtr index, size_t hash);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JRBTree
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JRBTreePtr JRBTreeSetHashIndex(JRBTreePtr tree, int enable)
+ * @brief 키 값으로 노드를 찾는 해시 색인을 켜거나 끄는 함수
+ * 켜면 트리의 모든 노드로 색인을 만들고, 이후 추가/삭제할 때마다 같이 갱신한다.
+ * JRBTreeFindNodeByKey(와 이를 사용하는 JRBTreeDeleteNodeByKey)는 트리를 내려가지 않고 색인에서 찾으며(O(1)),
+ * 범위 검색과 순회 같은 순서가 필요한 연산은 그대로 트리를 사용한다.
+ * 노드마다 칸 하나(16 bytes)를 사용하고 사용률을 JRBTREE_HASH_LOAD_PERCENT % 이하로 유지하므로 노드 한 개당 32~64 bytes 가 더 필요하다.
+ * 검색 결과는 색인이 없을 때와 같다. (NewJRBTreeOwned 트리는 값이 같은 노드, 나머지는 키 주소가 같은 노드)
+ * 노드를 추가할 때 색인을 늘리지 못하면 색인을 해제하고 트리 검색으로 돌아간다.
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param enable 0 이면 색인을 해제, 아니면 색인을 생성(입력, 이미 있으면 그대로 사용)
+ * @return 성공 시 RB Tree 구조체의 주소, 실패 시 NULL 반환 (실패하면 색인은 꺼진 상태)
+ */
+JRBTreePtr JRBTreeSetHashIndex(JRBTreePtr tree, int enable)
+{
+	if(tree == NULL) return NULL;
+	if(enable == 0)
+	{
+		DeleteJRBTreeHashIndex(&(tree->hashIndex));
+		return tree;
+	}
+	if(tree->hashIndex != NULL) return tree;
+
+	tree->hashIndex = NewJRBTreeHashIndex(tree->type, (tree->keyArena != NULL) ? 1 : 0, tree->size);
+	if(tree->hashIndex == NULL) return NULL;
+
+	JNodePtr currentNode = tree->leftmost;
+	for( ; currentNode != NULL; currentNode = JNodeGetNext(currentNode)) JRBTreeHashIndexInsert(tree, currentNode);
+	return (tree->hashIndex != NULL) ? tree : NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JRBTreeHashIndex
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JRBTreeHashIndexPtr NewJRBTreeHashIndex(KeyType type, int byValue, size_t nodeCount)
+ * @brief 비어 있는 새로운 해시 색인 구조체 객체를 생성하는 함수
+ * @param type 키 데이터 유형(입력)
+ * @param byValue 키 값이 같으면 찾는지 여부(입력, 0 이면 키 주소가 같아야 찾는다)
+ * @param nodeCount 저장할 노드 개수(입력, 이 개수를 저장해도 늘리지 않도록 칸 개수를 정한다)
+ * @return 성공 시 생성된 해시 색인 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JRBTreeHashIndexPtr NewJRBTreeHashIndex(KeyType type, int byValue, size_t nodeCount)
+{
+	JRBTreeHashIndexPtr newIndex = (JRBTreeHashIndexPtr)calloc(1, sizeof(JRBTreeHashIndex));
+	if(newIndex == NULL)
+	{
+		return NULL;
+	}
+
+	newIndex->type = type;
+	newIndex->byValue = byValue;
+
+	size_t capacity = JRBTREE_HASH_MIN_CAPACITY;
+	while(capacity * JRBTREE_HASH_LOAD_PERCENT / 100 < nodeCount) capacity <<= 1;
+	if(_ResizeHashIndex(newIndex, capacity) != 0)
+	{
+		free(newIndex);
+		return NULL;
+	}
+	return newIndex;
+}
+
+/**
+ * @fn DeleteResult DeleteJRBTreeHashIndex(JRBTreeHashIndexPtrContainer container)
+ * @brief 해시 색인 구조체 객체를 삭제하는 함수 (노드는 해제하지 않음)
+ * @param container 해시 색인 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJRBTreeHashIndex(JRBTreeHashIndexPtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	free((*container)->entries);
+	free(*container);
+	*container = NULL;
+	return DeleteSuccess;
+}
+
+/**
+ * @fn void JRBTreeHashIndexInsert(JRBTreePtr tree, JNodePtr node)
+ * @brief 트리에 추가된 노드를 해시 색인에 추가하는 함수
+ * 사용률이 JRBTREE_HASH_LOAD_PERCENT % 를 넘으면 두 배로 늘리고, 메모리가 부족하면 색인을 해제한다.
+ * 매개변수 NULL 체크를 수행하지 않음 (tree->hashIndex 가 NULL 이 아니어야 한다)
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param node 트리에 추가된 노드(입력)
+ * @return 반환값 없음
+ */
+void JRBTreeHashIndexInsert(JRBTreePtr tree, JNodePtr node)
+{
+	JRBTreeHashIndexPtr index = tree->hashIndex;
+	if((index->count + 1) * 100 > index->capacity * JRBTREE_HASH_LOAD_PERCENT)
+	{
+		if(_ResizeHashIndex(index, index->capacity * 2) != 0)
+		{
+			DeleteJRBTreeHashIndex(&(tree->hashIndex));
+			return;
+		}
+	}
+
+	size_t hash = _HashKey(index->type, node->key);
+	size_t mask = index->capacity - 1;
+	size_t position = _GetHome(index, hash);
+	while(index->entries[position].node != NULL) position = (position + 1) & mask;
+
+	index->entries[position].hash = hash;
+	index->entries[position].node = node;
+	index->count++;
+}
+
+/**
+ * @fn void JRBTreeHashIndexRemove(JRBTreeHashIndexPtr index, const JNodePtr node)
+ * @brief 트리에서 분리되는 노드를 해시 색인에서 삭제하는 함수
+ * 노드의 키 값으로 칸을 찾으므로 키를 해제하기 전에 호출해야 한다.
+ * 삭제한 칸 뒤의 칸들 중 원래 위치가 삭제한 칸 이전인 칸을 당겨서 빈 칸 표시 없이 검색 경로를 유지한다.
+ * 매개변수 NULL 체크를 수행하지 않음
+ * @param index 해시 색인 구조체 객체의 주소(출력)
+ * @param node 분리되는 노드(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void JRBTreeHashIndexRemove(JRBTreeHashIndexPtr index, const JNodePtr node)
+{
+	size_t mask = index->capacity - 1;
+	size_t position = _GetHome(index, _HashKey(index->type, node->key));
+	while(index->entries[position].node != node)
+	{
+		if(index->entries[position].node == NULL) return;
+		position = (position + 1) & mask;
+	}
+
+	size_t nextPosition = position;
+	while(1)
+	{
+		nextPosition = (nextPosition + 1) & mask;
+		JRBTreeHashEntryPtr nextEntry = &(index->entries[nextPosition]);
+		if(nextEntry->node == NULL) break;
+
+		// 원래 위치가 (position, nextPosition] 구간(순환)에 있으면 당길 수 없다.
+		size_t home = _GetHome(index, nextEntry->hash);
+		if(((nextPosition - home) & mask) < ((nextPosition - position) & mask)) continue;
+
+		index->entries[position] = *nextEntry;
+		position = nextPosition;
+	}
+
+	index->entries[position].hash = 0;
+	index->entries[position].node = NULL;
+	index->count--;
+}
+
+/**
+ * @fn JNodePtr JRBTreeHashIndexFind(const JRBTreeHashIndexPtr index, void *key)
+ * @brief 해시 색인에서 지정한 키를 가진 노드를 검색하는 함수
+ * 해시가 같은 칸만 키를 비교하므로 대부분 노드를 하나만 읽는다.
+ * 매개변수 NULL 체크를 수행하지 않음
+ * @param index 해시 색인 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키의 주소(입력)
+ * @return 성공 시 노드의 주소, 실패 시 NULL 반환
+ */
+JNodePtr JRBTreeHashIndexFind(const JRBTreeHashIndexPtr index, void *key)
+{
+	size_t hash = _HashKey(index->type, key);
+	size_t mask = index->capacity - 1;
+	size_t position = _GetHome(index, hash);
+
+	JRBTreeHashEntryPtr entry = &(index->entries[position]);
+	for( ; entry->node != NULL; position = (position + 1) & mask, entry = &(index->entries[position]))
+	{
+		if(entry->hash != hash) continue;
+		if(entry->node->key == key) return entry->node;
+		if(index->byValue == 1 && JNodeCompareKeyInline(entry->node->key, key, index->type) == 0) return entry->node;
+	}
+	return NULL;
+}
+
+/**
+ * @fn size_t JRBTreeHashIndexGetBytes(const JRBTreeHashIndexPtr index)
+ * @brief 해시 색인이 할당한 메모리 크기를 반환하는 함수
+ * @param index 해시 색인 구조체 객체의 주소(입력, 읽기 전용, NULL 가능)
+ * @return 할당한 메모리 크기 반환 (NULL 이면 0)
+ */
+size_t JRBTreeHashIndexGetBytes(const JRBTreeHashIndexPtr index)
+{
+	if(index == NULL) return 0;
+	return sizeof(JRBTreeHashIndex) + index->capacity * sizeof(JRBTreeHashEntry);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int _ResizeHashIndex(JRBTreeHashIndexPtr index, size_t capacity)
+ * @brief 해시 색인의 칸 배열을 지정한 개수로 다시 할당하고 저장된 노드들을 옮기는 함수
+ * 저장된 해시로 새 위치를 구하므로 키를 다시 읽지 않는다.
+ * @param index 해시 색인 구조체 객체의 주소(입력, 출력)
+ * @param capacity 새로운 칸 개수(입력, 2 의 거듭제곱)
+ * @return 성공 시 0, 실패 시 -1 반환 (실패하면 기존 칸 배열은 그대로 유지)
+ */
+static int _ResizeHashIndex(JRBTreeHashIndexPtr index, size_t capacity)
+{
+	JRBTreeHashEntryPtr newEntries = (JRBTreeHashEntryPtr)calloc(capacity, sizeof(JRBTreeHashEntry));
+	if(newEntries == NULL) return -1;
+
+	JRBTreeHashEntryPtr oldEntries = index->entries;
+	size_t oldCapacity = index->capacity;
+
+	unsigned int shift = 64;
+	size_t remainCapacity = capacity;
+	for( ; remainCapacity > 1; remainCapacity >>= 1) shift--;
+	index->entries = newEntries;
+	index->capacity = capacity;
+	index->shift = shift;
+
+	size_t mask = capacity - 1;
+	size_t oldPosition = 0;
+	for( ; oldPosition < oldCapacity; oldPosition++)
+	{
+		if(oldEntries[oldPosition].node == NULL) continue;
+
+		size_t position = _GetHome(index, oldEntries[oldPosition].hash);
+		while(newEntries[position].node != NULL) position = (position + 1) & mask;
+		newEntries[position] = oldEntries[oldPosition];
+	}
+
+	free(oldEntries);
+	return 0;
+}
+
+/**
+ * @fn static size_t _HashKey(KeyType type, const void *key)
+ * @brief 키 값의 해시를 구하는 함수 (문자열은 FNV-1a)
+ * @param type 키 데이터 유형(입력)
+ * @param key 키의 주소(입력, 읽기 전용)
+ * @return 항상 키 값의 해시 반환
+ */
+static size_t _HashKey(KeyType type, const void *key)
+{
+	unsigned long long hash = 0;
+	switch(type)
+	{
+		case IntType:
+			hash = (unsigned long long)(unsigned int)*((const int*)key);
+			break;
+		case CharType:
+			hash = (unsigned long long)(unsigned char)*((const char*)key);
+			break;
+		case StringType:
+			{
+				const unsigned char *current = (const unsigned char*)key;
+				hash = 14695981039346656037ULL;
+				for( ; *current != '\0'; current++)
+				{
+					hash ^= *current;
+					hash *= 1099511628211ULL;
+				}
+			}
+			break;
+		default:
+			break;
+	}
+	return (size_t)hash;
+}
+
+/**
+ * @fn static size_t _GetHome(const JRBTreeHashIndexPtr index, size_t hash)
+ * @brief 해시로 노드가 원래 들어갈 칸 위치를 구하는 함수 (Fibonacci hashing, 곱셈 결과의 상위 bit 를 사용)
+ * 연속된 정수 키도 칸 배열 전체에 흩어진다.
+ * @param index 해시 색인 구조체 객체의 주소(입력, 읽기 전용)
+ * @param hash 키 값의 해시(입력)
+ * @return 항상 칸 위치 반환
+ */
+static size_t _GetHome(const JRBTreeHashIndexPtr index, size_t hash)
+{
+	return (size_t)(((unsigned long long)hash * 0x9E3779B97F4A7C15ULL) >> index->shift);
+}
@@ -0,0 +1,123 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/jrbtree.h"
+#include "jrbtree_internal.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JRBTree
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JRBTreePtr JRBTreeSetHotCache(JRBTreePtr tree, size_t slotCount)
+ * @brief 자주 검색하는 키의 노드를 기억하는 검색 캐시를 켜거나 끄는 함수
+ * JRBTreeFindNodeByKey 는 먼저 키 주소로 구한 캐시 칸 하나를 확인하고, 없으면 트리에서 찾은 후 그 칸의 키가 자주 검색되지 않으면 바꿔서 기억한다.
+ * 검색이 소수의 키에 몰리는 경우(Zipf 분포 등) 대부분의 검색이 트리를 내려가지 않고 캐시 라인 하나만 읽는다.
+ * 노드가 삭제되면 그 노드를 기억한 칸을 비우므로 삭제된 노드를 반환하지 않는다.
+ * 키를 값으로 검색하는 NewJRBTreeOwned 트리는 키 주소로 기억할 수 없으므로 사용할 수 없다.
+ * JNodeSetKey 로 트리 안의 노드의 키를 바꾸면 이전 키 주소로 검색될 수 있으므로 캐시를 다시 지정해서 비워야 한다.
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param slotCount 캐시 칸 개수(입력, 2 의 거듭제곱으로 올림, 0 이면 캐시를 끈다, 칸 하나는 24 bytes)
+ * @return 성공 시 RB Tree 구조체의 주소, 실패 시 NULL 반환 (실패하면 캐시는 꺼진 상태)
+ */
+JRBTreePtr JRBTreeSetHotCache(JRBTreePtr tree, size_t slotCount)
+{
+	if(tree == NULL || tree->keyArena != NULL) return NULL;
+
+	DeleteJRBTreeHotCache(&(tree->hotCache));
+	if(slotCount == 0) return tree;
+
+	tree->hotCache = NewJRBTreeHotCache(slotCount);
+	if(tree->hotCache == NULL) return NULL;
+	return tree;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JRBTreeHotCache
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JRBTreeHotCachePtr NewJRBTreeHotCache(size_t slotCount)
+ * @brief 비어 있는 새로운 검색 캐시 구조체 객체를 생성하는 함수
+ * @param slotCount 칸 개수(입력, 2 이상의 2 의 거듭제곱으로 올림)
+ * @return 성공 시 생성된 검색 캐시 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JRBTreeHotCachePtr NewJRBTreeHotCache(size_t slotCount)
+{
+	unsigned int shift = 63;
+	size_t roundedCount = 2;
+	while(roundedCount < slotCount && shift > 1)
+	{
+		roundedCount <<= 1;
+		shift--;
+	}
+
+	JRBTreeHotCachePtr newCache = (JRBTreeHotCachePtr)calloc(1, sizeof(JRBTreeHotCache) + roundedCount * sizeof(JRBTreeHotSlot));
+	if(newCache == NULL)
+	{
+		return NULL;
+	}
+
+	newCache->shift = shift;
+	newCache->slotCount = roundedCount;
+	return newCache;
+}
+
+/**
+ * @fn DeleteResult DeleteJRBTreeHotCache(JRBTreeHotCachePtrContainer container)
+ * @brief 검색 캐시 구조체 객체를 삭제하는 함수 (노드는 해제하지 않음)
+ * @param container 검색 캐시 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJRBTreeHotCache(JRBTreeHotCachePtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	free(*container);
+	*container = NULL;
+	return DeleteSuccess;
+}
+
+/**
+ * @fn void JRBTreeHotCacheRemove(JRBTreeHotCachePtr cache, const JNodePtr node)
+ * @brief 트리에서 분리되는 노드를 기억한 칸을 비우는 함수
+ * 키 주소마다 칸이 하나뿐이므로 그 칸만 확인하면 된다.
+ * 매개변수 NULL 체크를 수행하지 않음
+ * @param cache 검색 캐시 구조체 객체의 주소(출력)
+ * @param node 분리되는 노드(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void JRBTreeHotCacheRemove(JRBTreeHotCachePtr cache, const JNodePtr node)
+{
+	JRBTreeHotSlotPtr slot = JRBTREE_HOT_SLOT(cache, node->key);
+	if(slot->node != node) return;
+
+	slot->key = NULL;
+	slot->node = NULL;
+	slot->hits = 0;
+}
+
+/**
+ * @fn void JRBTreeHotCacheClear(JRBTreeHotCachePtr cache)
+ * @brief 검색 캐시의 모든 칸을 비우는 함수
+ * @param cache 검색 캐시 구조체 객체의 주소(출력, NULL 가능)
+ * @return 반환값 없음
+ */
+void JRBTreeHotCacheClear(JRBTreeHotCachePtr cache)
+{
+	if(cache == NULL) return;
+	memset(cache->slots, 0, cache->slotCount * sizeof(JRBTreeHotSlot));
+}
+
+/**
+ * @fn size_t JRBTreeHotCacheGetBytes(const JRBTreeHotCachePtr cache)
+ * @brief 검색 캐시가 할당한 메모리 크기를 반환하는 함수
+ * @param cache 검색 캐시 구조체 객체의 주소(입력, 읽기 전용, NULL 가능)
+ * @return 할당한 메모리 크기 반환 (NULL 이면 0)
+ */
+size_t JRBTreeHotCacheGetBytes(const JRBTreeHotCachePtr cache)
+{
+	if(cache == NULL) return 0;
+	return sizeof(JRBTreeHotCache) + cache->slotCount * sizeof(JRBTreeHotSlot);
+}
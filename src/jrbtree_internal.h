@@ -0,0 +1,354 @@
+#ifndef __JRBTREE_INTERNAL_H__
+#define __JRBTREE_INTERNAL_H__
+
+#include <stdint.h>
+#include <pthread.h>
+
+#include "../include/jrbtree.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// Macros
+///////////////////////////////////////////////////////////////////////////////
+
+// JRBTREE_STATS 로 빌드한 경우에만 누적 카운터를 증가시킨다. (make STATS=1)
+// 빌드하지 않은 경우 value 만 평가하고 아무 것도 하지 않으므로 성능에 영향이 없다.
+#ifdef JRBTREE_STATS
+#define JRBTREE_STAT_ADD(tree, counter, value) ((tree)->counters.counter += (unsigned long long)(value))
+#else
+#define JRBTREE_STAT_ADD(tree, counter, value) ((void)(value))
+#endif
+
+// arena 청크 한 개의 기본 크기 (64 KB)
+#define JRBTREE_ARENA_CHUNK_SIZE (64 * 1024)
+
+// B+ Tree 엔진 노드 한 개의 최대 키 개수 (16 * sizeof(int) = 64 bytes, 키 값 배열이 캐시 라인 한 개)
+#define JRBTREE_BPLUS_ORDER 16
+// B+ Tree 엔진에서 루트가 아닌 노드의 최소 키 개수 (가득 찬 내부 노드를 나누면 오른쪽이 7 개)
+#define JRBTREE_BPLUS_MIN 7
+// B+ Tree 엔진 노드의 정렬 용도 (캐시 라인 크기)
+#define JRBTREE_BPLUS_ALIGNMENT 64
+// B+ Tree 엔진이 키마다 할당하는 노드의 색
+// 트리 모양이 아니라 정렬 순서의 이중 연결 리스트(left: 이전 노드, right: 다음 노드)로 연결되므로 RB Tree 노드와 구분한다.
+#define JRBTREE_LIST_COLOR ((NodeColor)0)
+// radix 표의 칸마다 두는 헤더 노드의 색 (칸의 서브 트리 루트 노드의 부모 노드, 키는 없고 key 에 서브 트리 루트 노드를 저장)
+#define JRBTREE_SLOT_COLOR ((NodeColor)3)
+// radix 표의 최대 칸 개수 bit 수 (2^20 칸 * sizeof(JNode))
+#define JRBTREE_RADIX_MAX_BITS 20
+
+// 검색 캐시의 칸마다 기억하는 최대 검색 횟수 (다른 키로 바뀌기 전에 견디는 검색 횟수)
+#define JRBTREE_HOT_MAX_HITS 8
+// 키 주소로 검색 캐시의 칸을 구하는 매크로 (Fibonacci hashing, 곱셈 결과의 상위 bit 를 사용)
+#define JRBTREE_HOT_SLOT(cache, key) (&((cache)->slots[((unsigned long long)(uintptr_t)(key) * 0x9E3779B97F4A7C15ULL) >> (cache)->shift]))
+
+// 집계 값을 저장하는 트리에서 노드 바로 뒤에 있는 집계 값의 주소를 구하는 매크로 (JRBTreeAllocNode 참고)
+#define JRBTREE_NODE_AGGREGATE(node) ((void*)((JNodePtr)(node) + 1))
+// 범위 집계에서 경계 경로를 저장하는 최대 깊이 (RB Tree 높이는 2 * log2(n + 1) 이하)
+#define JRBTREE_AGGREGATE_MAX_DEPTH 128
+// 범위 집계에서 함수 안에 두는 임시 집계 값 버퍼 크기 (크면 할당한다)
+#define JRBTREE_AGGREGATE_LOCAL_SIZE 64
+
+// 해시 색인의 최대 사용률 (%, 빈 칸이 많을수록 찾지 못하는 검색이 빨리 끝난다)
+#define JRBTREE_HASH_LOAD_PERCENT 50
+// 해시 색인의 최소 칸 개수
+#define JRBTREE_HASH_MIN_CAPACITY 16
+// 병렬 순회에서 thread 한 개당 나눌 조각 개수 (먼저 끝난 thread 가 다른 thread 의 조각을 가져갈 수 있도록 여러 개로 나눈다)
+#define JRBTREE_PARALLEL_CHUNKS_PER_THREAD 8
+// 병렬 순회에서 사용할 최대 thread 개수
+#define JRBTREE_PARALLEL_MAX_THREADS 256
+// 병렬 순회의 worker 구조체와 조각별 누적 값의 정렬 단위 (캐시 라인 크기, 서로 다른 thread 가 같은 캐시 라인에 쓰지 않게 한다)
+#define JRBTREE_PARALLEL_ALIGNMENT 64
+
+///////////////////////////////////////////////////////////////////////////////
+/// Internal Definitions
+///////////////////////////////////////////////////////////////////////////////
+
+// arena 청크 구조체 (데이터 영역이 구조체 바로 뒤에 이어진다)
+typedef struct _jrbtree_arena_chunk_t {
+	// 다음 청크 주소
+	struct _jrbtree_arena_chunk_t *next;
+	// 데이터 영역 크기
+	size_t size;
+	// 사용한 크기
+	size_t used;
+	// 데이터 영역
+	char data[];
+} JRBTreeArenaChunk, *JRBTreeArenaChunkPtr;
+
+// 문자열 중복 제거 해시 테이블의 칸 구조체
+typedef struct _jrbtree_intern_slot_t {
+	// arena 에 저장된 문자열 (비어 있으면 NULL)
+	char *string;
+	// 문자열의 해시 값
+	size_t hash;
+} JRBTreeInternSlot, *JRBTreeInternSlotPtr;
+
+// 청크 단위로 할당하고 한 번에 해제하는 arena 구조체 (키 복사본, 노드 slab, 문자열 풀에 사용)
+// 공개 헤더에서는 JRBTreeStringPool 이라는 이름으로 사용한다.
+typedef struct _jrbtree_arena_t {
+	// 현재 할당 중인 청크 (청크들은 연결 리스트로 연결된다)
+	JRBTreeArenaChunkPtr head;
+	// 청크 한 개의 크기
+	size_t chunkSize;
+	// 할당한 청크들의 전체 크기
+	size_t allocatedBytes;
+	// 문자열 중복 제거 해시 테이블 (JRBTreeArenaIntern 을 처음 호출할 때 할당, 아니면 NULL)
+	JRBTreeInternSlotPtr internSlots;
+	// 해시 테이블 칸 개수 (2 의 거듭제곱)
+	size_t internCapacity;
+	// 저장된 서로 다른 문자열 개수
+	size_t internCount;
+} JRBTreeArena, *JRBTreeArenaPtr, **JRBTreeArenaPtrContainer;
+
+// B+ Tree 엔진의 노드 구조체 (리프는 children 없이 할당한다)
+// 검색할 때 가장 먼저 읽는 키 값 배열이 캐시 라인 하나에 들어가도록 맨 앞에 두고 JRBTREE_BPLUS_ALIGNMENT 로 정렬한다.
+typedef struct _jrbtree_bplus_node_t {
+	// 키 값 배열 (IntType, CharType 만 사용, 남는 칸은 INT_MAX)
+	int values[JRBTREE_BPLUS_ORDER];
+	// 리프: 키 순서의 노드 주소 배열, 내부: 분리 키 노드 주소 배열 (nodes[i] 는 children[i + 1] 서브 트리의 가장 작은 노드)
+	JNodePtr nodes[JRBTREE_BPLUS_ORDER];
+	// 다음 리프 (리프만 사용, 마지막 리프면 NULL)
+	struct _jrbtree_bplus_node_t *next;
+	// 키 개수 (내부 노드의 자식 개수는 count + 1)
+	int count;
+	// 리프 여부
+	int leaf;
+	// 자식 노드 배열 (내부 노드만 할당)
+	struct _jrbtree_bplus_node_t *children[];
+} JRBTreeBPlusNode, *JRBTreeBPlusNodePtr;
+
+// RB Tree 구조체 대신 키 순서를 관리하는 B+ Tree 엔진 구조체 (NewJRBTreeWithEngine 참고)
+// 같은 값의 키는 키 주소 순서로 정렬하므로 모든 키가 (값, 주소) 순서로 한 위치에만 있다.
+typedef struct _jrbtree_bplus_t {
+	// 키 데이터 유형
+	KeyType type;
+	// 높이 (비어 있으면 0, 루트 노드가 리프면 1)
+	int height;
+	// 루트 노드 (비어 있으면 NULL)
+	JRBTreeBPlusNodePtr root;
+	// 할당한 B+ Tree 노드들의 전체 크기
+	size_t allocatedBytes;
+} JRBTreeBPlus, *JRBTreeBPlusPtr, **JRBTreeBPlusPtrContainer;
+
+// 검색 캐시의 칸 구조체
+typedef struct _jrbtree_hot_slot_t {
+	// 검색한 키의 주소 (비어 있으면 NULL)
+	void *key;
+	// 키의 노드 주소
+	JNodePtr node;
+	// 이 칸의 키가 검색된 횟수 (JRBTREE_HOT_MAX_HITS 까지, 다른 키가 검색되지 않을 때마다 1 씩 줄어든다)
+	size_t hits;
+} JRBTreeHotSlot, *JRBTreeHotSlotPtr;
+
+// 키 주소로 노드를 찾는 direct-mapped 검색 캐시 구조체 (slots 는 구조체 바로 뒤에 이어진다)
+// 자주 검색하는 키가 한 번 검색된 키에 밀려나지 않도록 검색된 횟수가 0 인 칸만 새 키로 덮어쓰고,
+// 노드가 삭제되면 그 칸을 비운다.
+typedef struct _jrbtree_hot_cache_t {
+	// 칸 번호를 구할 때 사용할 shift 크기 (64 - log2(칸 개수))
+	unsigned int shift;
+	// 칸 개수 (2 의 거듭제곱)
+	size_t slotCount;
+	// 칸 배열
+	JRBTreeHotSlot slots[];
+} JRBTreeHotCache, *JRBTreeHotCachePtr, **JRBTreeHotCachePtrContainer;
+
+// 정수 키의 상위 bit 로 고른 칸마다 RB Tree 서브 트리를 두는 radix 표 구조체 (headers 는 구조체 바로 뒤에 이어진다)
+// 칸 i 는 (키 - base) >> shift 가 i 인 키들을 저장하고, 범위 밖의 키는 처음이나 마지막 칸에 저장한다.
+// 헤더 노드는 color 가 JRBTREE_SLOT_COLOR 이고, key 에 서브 트리 루트 노드, left/right 에 이전/다음 칸의 헤더 노드를 저장한다.
+// 서브 트리 루트 노드의 부모 노드는 헤더 노드이므로 JNodeGetNext/JNodeGetPrevious 가 칸을 넘어서 순회할 수 있다.
+typedef struct _jrbtree_radix_t {
+	// 첫 번째 칸의 최소 키 값
+	long long base;
+	// 칸 하나가 담당하는 키 범위의 bit 수
+	unsigned int shift;
+	// 칸 개수 (2 의 거듭제곱)
+	size_t slotCount;
+	// 칸마다 하나씩 있는 헤더 노드 배열
+	JNode headers[];
+} JRBTreeRadix, *JRBTreeRadixPtr, **JRBTreeRadixPtrContainer;
+
+// 해시 색인의 칸 구조체
+typedef struct _jrbtree_hash_entry_t {
+	// 키 값의 해시 (칸 위치를 다시 계산하고, 키를 읽기 전에 비교하는 데 사용)
+	size_t hash;
+	// 노드 주소 (비어 있으면 NULL)
+	JNodePtr node;
+} JRBTreeHashEntry, *JRBTreeHashEntryPtr;
+
+// 키 값으로 노드를 찾는 open addressing(linear probing) 해시 색인 구조체
+// 노드마다 칸 하나를 사용하므로 같은 값의 키가 여러 개이면 인접한 칸들에 저장된다.
+// 삭제할 때는 뒤의 칸들을 당겨서(backward shift) 빈 칸 표시 없이 검색 경로를 유지한다.
+typedef struct _jrbtree_hash_index_t {
+	// 키 데이터 유형
+	KeyType type;
+	// 키 값이 같으면 찾는지 여부 (NewJRBTreeOwned, 아니면 키 주소가 같아야 찾는다)
+	int byValue;
+	// 칸 위치를 구할 때 사용할 shift 크기 (64 - log2(칸 개수))
+	unsigned int shift;
+	// 칸 개수 (2 의 거듭제곱)
+	size_t capacity;
+	// 저장된 노드 개수 (칸 개수의 JRBTREE_HASH_LOAD_PERCENT % 를 넘으면 두 배로 늘린다)
+	size_t count;
+	// 칸 배열
+	JRBTreeHashEntryPtr entries;
+} JRBTreeHashIndex, *JRBTreeHashIndexPtr, **JRBTreeHashIndexPtrContainer;
+
+// 병렬 순회 worker 구조체 (다른 worker 의 range 와 같은 캐시 라인을 쓰지 않도록 JRBTREE_PARALLEL_ALIGNMENT 단위로 정렬한다)
+typedef struct __attribute__((aligned(JRBTREE_PARALLEL_ALIGNMENT))) _jrbtree_parallel_worker_t {
+	// 남은 조각 번호 범위 (상위 32 bit 가 시작, 하위 32 bit 가 끝, [시작, 끝))
+	// 주인 worker 는 앞에서, 다른 worker 는 뒤에서 CAS 로 하나씩 가져간다.
+	unsigned long long range;
+	// 작업 구조체
+	struct _jrbtree_parallel_job_t *job;
+	// thread (0 번 worker 는 호출한 thread 에서 실행하므로 사용하지 않음)
+	pthread_t thread;
+	// worker 번호
+	int index;
+	// thread 생성 여부 (생성에 실패한 worker 의 조각은 다른 worker 들이 가져간다)
+	int started;
+} JRBTreeParallelWorker, *JRBTreeParallelWorkerPtr;
+
+// 병렬 순회 작업 구조체 (JRBTreeParallelForEach, JRBTreeParallelReduce 참고)
+// 조각 i 는 boundaries[i] 부터 boundaries[i + 1] 앞까지(마지막 조각은 끝까지) 키 순서로 이어진 노드들이다.
+typedef struct _jrbtree_parallel_job_t {
+	// 조각의 시작 노드 배열 (키 순서)
+	JNodePtr *boundaries;
+	// 조각 개수
+	size_t chunkCount;
+	// worker 배열
+	JRBTreeParallelWorkerPtr workers;
+	// worker 개수
+	int workerCount;
+	// 키마다 호출할 함수 (JRBTreeParallelForEach, 아니면 NULL)
+	JRBTreeVisitFunc visit;
+	// 조각의 누적 값에 키를 더하는 함수 (JRBTreeParallelReduce, 아니면 NULL)
+	JRBTreeReduceFunc reduce;
+	// 누적 값 크기
+	size_t accumulatorSize;
+	// 조각별 누적 값의 간격 (accumulatorSize 를 JRBTREE_PARALLEL_ALIGNMENT 배수로 올린 크기)
+	size_t accumulatorStride;
+	// 조각별 누적 값 배열 (identity 로 초기화)
+	unsigned char *accumulators;
+	// 누적 값의 초기 값
+	const void *identity;
+	// 함수에 전달할 사용자 데이터
+	void *ctx;
+	// 방문한 키 개수 (조각을 끝낼 때마다 원자적으로 더한다)
+	size_t visitedCount;
+} JRBTreeParallelJob, *JRBTreeParallelJobPtr;
+
+// 병렬 작업 묶음 구조체 (thread 들이 공유 카운터로 작업 번호를 하나씩 가져가서 function 을 호출한다)
+typedef struct _jrbtree_parallel_tasks_t {
+	// 작업 함수 (argument, 작업 번호)
+	void (*function)(void *argument, size_t task);
+	// 작업 함수에 전달할 데이터
+	void *argument;
+	// 작업 개수
+	size_t taskCount;
+	// 다음에 가져갈 작업 번호
+	size_t nextTask;
+} JRBTreeParallelTasks, *JRBTreeParallelTasksPtr;
+
+// 병렬 생성에서 한 thread 가 만드는 서브 트리 구조체 (정렬된 키 배열의 [low, high) 구간)
+typedef struct _jrbtree_parallel_subtree_t {
+	// 구간 시작 위치
+	size_t low;
+	// 구간 끝 위치 (포함하지 않음)
+	size_t high;
+	// 서브 트리 루트 노드의 부모 노드
+	JNodePtr parent;
+} JRBTreeParallelSubtree, *JRBTreeParallelSubtreePtr;
+
+// 병렬 생성 작업 구조체 (JRBTreeBuildParallel 참고)
+typedef struct _jrbtree_parallel_build_t {
+	// 키 데이터 유형
+	KeyType type;
+	// 입력 키 배열 (읽기 전용)
+	void **input;
+	// 입력 키 개수
+	size_t count;
+	// 정렬할 때 번갈아 사용하는 두 키 배열 (source 의 정렬된 구간들을 target 으로 병합)
+	void **source;
+	void **target;
+	// 정렬된 구간들의 시작 위치 배열 (runCount + 1 개, 마지막은 count)
+	size_t *runStarts;
+	// 정렬된 구간 개수
+	size_t runCount;
+	// 구간 한 쌍의 병합을 나누는 조각 개수
+	size_t partsPerPair;
+	// 중복 제거 블록마다 남길 키 개수 (개수를 센 후 시작 위치로 바꾼다)
+	size_t *blockCounts;
+	// 중복 제거 블록 크기
+	size_t blockLength;
+	// NULL 키 발견 여부
+	int hasNullKey;
+	// 노드 영역 (정렬된 i 번째 키의 노드는 nodes[i])
+	JNodePtr nodes;
+	// Red 로 칠할 깊이 (완전 이진 트리가 아니면 가장 깊은 단계, 아니면 -1)
+	int redDepth;
+	// 병렬로 만들 서브 트리들의 깊이
+	int subtreeDepth;
+	// 병렬로 만들 서브 트리 배열
+	JRBTreeParallelSubtreePtr subtrees;
+	// 서브 트리 개수
+	size_t subtreeCount;
+} JRBTreeParallelBuild, *JRBTreeParallelBuildPtr;
+
+///////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+/// 라이브러리 내부의 여러 소스 파일에서 공유하는 함수들(외부 공개용 아님)
+///////////////////////////////////////////////////////////////////////////////
+
+JNodePtr JNodeGetLeftmost(const JNodePtr node);
+JNodePtr JNodeGetRightmost(const JNodePtr node);
+void JRBTreeRemoveNode(JRBTreePtr tree, JNodePtr node);
+void JRBTreeUnlinkNode(JRBTreePtr tree, JNodePtr node);
+int JRBTreeInsertFixup(JRBTreePtr tree, JNodePtr node);
+size_t JRBTreeFormatInt(int value, char *buffer);
+JNodePtr JRBTreeAllocNode(JRBTreePtr tree);
+void JRBTreeFreeNode(JRBTreePtr tree, JNodePtr node);
+size_t JRBTreeReleaseNodes(JRBTreePtr tree, JNodePtr root);
+
+JRBTreeArenaPtr NewJRBTreeArena(size_t chunkSize);
+DeleteResult DeleteJRBTreeArena(JRBTreeArenaPtrContainer container);
+void* JRBTreeArenaAlloc(JRBTreeArenaPtr arena, size_t size, size_t align);
+void* JRBTreeArenaCopy(JRBTreeArenaPtr arena, const void *source, size_t size, size_t align);
+char* JRBTreeArenaIntern(JRBTreeArenaPtr arena, const char *string);
+size_t JRBTreeArenaGetBytes(const JRBTreeArenaPtr arena);
+
+JRBTreeBPlusPtr NewJRBTreeBPlus(KeyType type);
+DeleteResult DeleteJRBTreeBPlus(JRBTreeBPlusPtrContainer container);
+JNodePtr JRBTreeBPlusInsert(JRBTreePtr tree, void *key);
+void JRBTreeBPlusRemove(JRBTreePtr tree, JNodePtr node);
+JNodePtr JRBTreeBPlusFind(const JRBTreeBPlusPtr bplus, void *key);
+JNodePtr JRBTreeBPlusBound(const JRBTreeBPlusPtr bplus, void *key, int upper);
+size_t JRBTreeBPlusReleaseNodes(JRBTreePtr tree);
+size_t JRBTreeBPlusGetBytes(const JRBTreeBPlusPtr bplus);
+
+JRBTreeHotCachePtr NewJRBTreeHotCache(size_t slotCount);
+DeleteResult DeleteJRBTreeHotCache(JRBTreeHotCachePtrContainer container);
+void JRBTreeHotCacheRemove(JRBTreeHotCachePtr cache, const JNodePtr node);
+void JRBTreeHotCacheClear(JRBTreeHotCachePtr cache);
+size_t JRBTreeHotCacheGetBytes(const JRBTreeHotCachePtr cache);
+
+JRBTreeRadixPtr NewJRBTreeRadixTable(int minKey, int maxKey, unsigned int bits);
+DeleteResult DeleteJRBTreeRadixTable(JRBTreeRadixPtrContainer container);
+JNodePtr JRBTreeRadixGetHeader(const JRBTreeRadixPtr radix, const void *key);
+void JRBTreeRadixDetach(JRBTreePtr tree, JNodePtr header);
+void JRBTreeRadixAttach(JRBTreePtr tree, JNodePtr header);
+JNodePtr JRBTreeRadixGetNext(const JNodePtr header);
+JNodePtr JRBTreeRadixGetPrevious(const JNodePtr header);
+JNodePtr JRBTreeRadixBound(const JRBTreePtr tree, void *key, int upper);
+size_t JRBTreeRadixReleaseNodes(JRBTreePtr tree);
+size_t JRBTreeRadixGetBytes(const JRBTreeRadixPtr radix);
+
+JRBTreeHashIndexPtr NewJRBTreeHashIndex(KeyType type, int byValue, size_t nodeCount);
+DeleteResult DeleteJRBTreeHashIndex(JRBTreeHashIndexPtrContainer container);
+void JRBTreeHashIndexInsert(JRBTreePtr tree, JNodePtr node);
+void JRBTreeHashIndexRemove(JRBTreeHashIndexPtr index, const JNodePtr node);
+JNodePtr JRBTreeHashIndexFind(const JRBTreeHashIndexPtr index, void *key);
+size_t JRBTreeHashIndexGetBytes(const JRBTreeHashIndexPtr index);
+
+void JRBTreeAugmentUpdate(const JRBTreePtr tree, JNodePtr node);
+void JRBTreeAugmentUpdatePath(const JRBTreePtr tree, JNodePtr node);
+
+#endif
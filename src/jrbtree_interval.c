@@ -0,0 +1,152 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/jrbtree.h"
+#include "jrbtree_internal.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Interval Static Functions
+///////////////////////////////////////////////////////////////////////////////
+
+static void JRBTreeIntervalCombine(void *aggregate, const void *key, const void *leftAggregate, const void *rightAggregate);
+
+///////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+///////////////////////////////////////////////////////////////////////////////
+
+static int _CanOverlap(const JNodePtr node, int low);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JRBTree
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JRBTreePtr NewJRBTreeInterval()
+ * @brief 닫힌 구간 [low, high] 를 키로 저장하고 겹치는 구간을 검색할 수 있는 구간 트리 구조체 객체를 생성하는 함수
+ * 키는 JRBTreeInterval 구조체의 주소이며 low 순서로 정렬된다. (IntType, 같은 키 주소는 다시 추가할 수 없음)
+ * 서브 트리의 최대 끝점을 집계 값으로 저장하는 NewJRBTreeAugmented 트리이므로 추가/삭제 경로와 회전할 때마다 갱신된다.
+ * 트리에 있는 동안 구간의 low, high 를 바꾸면 안 되며, 바꾸려면 삭제하고 다시 추가해야 한다.
+ * JRBTreeDeleteRange, JRBTreeTruncateBelow 는 low 로 범위를 정하고 노드를 하나씩 삭제한다.
+ * @return 성공 시 생성된 RB Tree 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JRBTreePtr NewJRBTreeInterval()
+{
+	JRBTreePtr newTree = NewJRBTreeAugmented(IntType, sizeof(int), JRBTreeIntervalCombine);
+	if(newTree == NULL) return NULL;
+
+	newTree->interval = 1;
+	return newTree;
+}
+
+/**
+ * @fn size_t JRBTreeIntervalFindOverlaps(const JRBTreePtr tree, int low, int high, JNodePtr *nodes, size_t capacity)
+ * @brief 구간 트리에서 닫힌 구간 [low, high] 와 겹치는 구간의 노드들을 low 순서로 검색하는 함수
+ * 최대 끝점이 low 보다 작은 서브 트리는 내려가지 않고, 시작점이 high 보다 큰 노드를 만나면 멈춘다.
+ * 겹치는 구간이 없으면 O(log n) 이고, 있으면 찾은 구간마다 경로 하나 이하만 더 방문한다.
+ * @param tree NewJRBTreeInterval 로 생성한 RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param low 검색할 구간의 시작점(입력)
+ * @param high 검색할 구간의 끝점(입력, low 이상)
+ * @param nodes 찾은 노드를 저장할 배열(출력, capacity 가 0 이면 NULL 가능)
+ * @param capacity nodes 배열 크기(입력, 넘는 노드는 저장하지 않고 개수만 센다)
+ * @return 겹치는 구간의 전체 개수 반환 (capacity 보다 크면 앞의 capacity 개만 저장), 실패 시 0 반환
+ */
+size_t JRBTreeIntervalFindOverlaps(const JRBTreePtr tree, int low, int high, JNodePtr *nodes, size_t capacity)
+{
+	if(tree == NULL || tree->interval == 0 || low > high) return 0;
+	if(nodes == NULL && capacity > 0) return 0;
+
+	size_t count = 0;
+	int isLeftDone = 0;
+	JNodePtr currentNode = tree->root;
+	if(_CanOverlap(currentNode, low) == 0) return 0;
+
+	// 부모 노드 주소를 따라 중위 순회하면서 겹칠 수 없는 서브 트리는 건너뛴다.
+	while(currentNode != NULL)
+	{
+		if(isLeftDone == 0 && _CanOverlap(currentNode->left, low) == 1)
+		{
+			currentNode = currentNode->left;
+			continue;
+		}
+
+		// 이후 노드들의 시작점은 모두 이 노드 이상이므로 더 이상 겹치지 않는다.
+		JRBTreeIntervalPtr interval = (JRBTreeIntervalPtr)currentNode->key;
+		if(interval->low > high) break;
+		if(interval->high >= low)
+		{
+			if(count < capacity) nodes[count] = currentNode;
+			count++;
+		}
+
+		if(_CanOverlap(currentNode->right, low) == 1)
+		{
+			currentNode = currentNode->right;
+			isLeftDone = 0;
+			continue;
+		}
+
+		// 오른쪽 서브 트리를 건너뛰면 왼쪽 자식으로 올라오는 부모 노드까지 올라간다.
+		JNodePtr childNode = currentNode;
+		currentNode = currentNode->parent;
+		while((currentNode != NULL) && (currentNode->right == childNode))
+		{
+			childNode = currentNode;
+			currentNode = currentNode->parent;
+		}
+		isLeftDone = 1;
+	}
+
+	return count;
+}
+
+/**
+ * @fn size_t JRBTreeIntervalStab(const JRBTreePtr tree, int point, JNodePtr *nodes, size_t capacity)
+ * @brief 구간 트리에서 지정한 점을 포함하는 구간의 노드들을 low 순서로 검색하는 함수 (JRBTreeIntervalFindOverlaps 참고)
+ * @param tree NewJRBTreeInterval 로 생성한 RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param point 검색할 점(입력)
+ * @param nodes 찾은 노드를 저장할 배열(출력, capacity 가 0 이면 NULL 가능)
+ * @param capacity nodes 배열 크기(입력)
+ * @return 점을 포함하는 구간의 전체 개수 반환, 실패 시 0 반환
+ */
+size_t JRBTreeIntervalStab(const JRBTreePtr tree, int point, JNodePtr *nodes, size_t capacity)
+{
+	return JRBTreeIntervalFindOverlaps(tree, point, point, nodes, capacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// Interval Static Functions
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void JRBTreeIntervalCombine(void *aggregate, const void *key, const void *leftAggregate, const void *rightAggregate)
+ * @brief 구간 트리 노드의 집계 값(서브 트리의 최대 끝점)을 계산하는 함수 (JRBTreeAggregateCombine)
+ * @param aggregate 최대 끝점을 저장할 주소(출력)
+ * @param key 노드의 구간(입력, 읽기 전용)
+ * @param leftAggregate 왼쪽 서브 트리의 최대 끝점(입력, 읽기 전용, NULL 가능)
+ * @param rightAggregate 오른쪽 서브 트리의 최대 끝점(입력, 읽기 전용, NULL 가능)
+ * @return 반환값 없음
+ */
+static void JRBTreeIntervalCombine(void *aggregate, const void *key, const void *leftAggregate, const void *rightAggregate)
+{
+	int maxHigh = ((const JRBTreeInterval*)key)->high;
+	if(leftAggregate != NULL && *((const int*)leftAggregate) > maxHigh) maxHigh = *((const int*)leftAggregate);
+	if(rightAggregate != NULL && *((const int*)rightAggregate) > maxHigh) maxHigh = *((const int*)rightAggregate);
+	*((int*)aggregate) = maxHigh;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int _CanOverlap(const JNodePtr node, int low)
+ * @brief 서브 트리에 끝점이 지정한 값 이상인 구간이 있는지 검사하는 함수
+ * @param node 서브 트리의 루트 노드(입력, 읽기 전용, NULL 가능)
+ * @param low 검색할 구간의 시작점(입력)
+ * @return 있으면 1, 없거나 NULL 이면 0 반환
+ */
+static int _CanOverlap(const JNodePtr node, int low)
+{
+	return (node != NULL) && (*((const int*)JRBTREE_NODE_AGGREGATE(node)) >= low);
+}
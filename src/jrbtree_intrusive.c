@@ -0,0 +1,392 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/jrbtree.h"
+#include "../include/jrbtree_intrusive.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of JRBTreeIntrusive Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static void JRBTreeIntrusiveRotate(JRBTreeIntrusivePtr tree, JRBTreeLinkPtr link, int direction);
+static void JRBTreeIntrusiveInsertFixup(JRBTreeIntrusivePtr tree, JRBTreeLinkPtr link);
+static void JRBTreeIntrusiveTransplant(JRBTreeIntrusivePtr tree, const JRBTreeLinkPtr oldLink, JRBTreeLinkPtr newLink);
+static void JRBTreeIntrusiveRemoveFixup(JRBTreeIntrusivePtr tree, JRBTreeLinkPtr link, JRBTreeLinkPtr parentLink);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int _IsBlack(const JRBTreeLinkPtr link);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JRBTreeIntrusive
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JRBTreeIntrusivePtr JRBTreeIntrusiveInit(JRBTreeIntrusivePtr tree, JRBTreeLinkCompare compare)
+ * @brief Intrusive RB Tree 구조체를 빈 트리로 초기화하는 함수 (메모리를 할당하지 않음)
+ * 트리가 링크를 소유하지 않으므로 삭제 함수는 없다. 링크를 포함한 객체는 호출하는 쪽이 관리한다.
+ * @param tree 초기화할 Intrusive RB Tree 구조체 객체의 주소(출력)
+ * @param compare 링크 비교 함수(입력)
+ * @return 성공 시 Intrusive RB Tree 구조체의 주소, 실패 시 NULL 반환
+ */
+JRBTreeIntrusivePtr JRBTreeIntrusiveInit(JRBTreeIntrusivePtr tree, JRBTreeLinkCompare compare)
+{
+	if(tree == NULL || compare == NULL) return NULL;
+
+	tree->root = NULL;
+	tree->compare = compare;
+	tree->size = 0;
+	return tree;
+}
+
+/**
+ * @fn JRBTreeLinkPtr JRBTreeIntrusiveInsert(JRBTreeIntrusivePtr tree, JRBTreeLinkPtr link)
+ * @brief Intrusive RB Tree 에 링크를 추가하는 함수 (메모리를 할당하지 않음)
+ * 비교 함수 결과가 0 인 링크가 이미 있으면 추가하지 않는다.
+ * @param tree Intrusive RB Tree 구조체 객체의 주소(출력)
+ * @param link 추가할 링크, 다른 트리에 속하지 않아야 한다.(입력)
+ * @return 성공 시 추가된 링크의 주소, 같은 링크가 있거나 실패 시 NULL 반환
+ */
+JRBTreeLinkPtr JRBTreeIntrusiveInsert(JRBTreeIntrusivePtr tree, JRBTreeLinkPtr link)
+{
+	if(tree == NULL || link == NULL) return NULL;
+
+	JRBTreeLinkPtr parentLink = NULL;
+	JRBTreeLinkPtr currentLink = tree->root;
+	int direction = 0;
+	while(currentLink != NULL)
+	{
+		int result = tree->compare(link, currentLink);
+		if(result == 0) return NULL;
+
+		parentLink = currentLink;
+		direction = (result > 0);
+		currentLink = currentLink->child[direction];
+	}
+
+	link->color = Red;
+	link->parent = parentLink;
+	link->left = NULL;
+	link->right = NULL;
+	if(parentLink == NULL) tree->root = link;
+	else parentLink->child[direction] = link;
+
+	JRBTreeIntrusiveInsertFixup(tree, link);
+	tree->size++;
+	return link;
+}
+
+/**
+ * @fn DeleteResult JRBTreeIntrusiveRemove(JRBTreeIntrusivePtr tree, JRBTreeLinkPtr link)
+ * @brief Intrusive RB Tree 에서 링크를 분리하는 함수 (검색 없이 O(log n), 메모리를 해제하지 않음)
+ * @param tree Intrusive RB Tree 구조체 객체의 주소(출력)
+ * @param link 분리할 링크, 반드시 tree 에 속한 링크여야 한다.(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult JRBTreeIntrusiveRemove(JRBTreeIntrusivePtr tree, JRBTreeLinkPtr link)
+{
+	if(tree == NULL || link == NULL || tree->size == 0) return DeleteFail;
+
+	JRBTreeLinkPtr childLink = NULL;
+	JRBTreeLinkPtr childParentLink = NULL;
+	NodeColor removedColor = link->color;
+
+	if(link->left == NULL || link->right == NULL)
+	{
+		childLink = (link->left != NULL) ? link->left : link->right;
+		childParentLink = link->parent;
+		JRBTreeIntrusiveTransplant(tree, link, childLink);
+	}
+	else
+	{
+		// 자식이 둘이면 다음 링크(오른쪽 서브 트리의 가장 왼쪽)를 그 자리로 옮긴다.
+		JRBTreeLinkPtr successorLink = link->right;
+		while(successorLink->left != NULL) successorLink = successorLink->left;
+
+		removedColor = successorLink->color;
+		childLink = successorLink->right;
+		if(successorLink->parent == link) childParentLink = successorLink;
+		else
+		{
+			childParentLink = successorLink->parent;
+			JRBTreeIntrusiveTransplant(tree, successorLink, successorLink->right);
+			successorLink->right = link->right;
+			successorLink->right->parent = successorLink;
+		}
+		JRBTreeIntrusiveTransplant(tree, link, successorLink);
+		successorLink->left = link->left;
+		successorLink->left->parent = successorLink;
+		successorLink->color = link->color;
+	}
+
+	if(removedColor == Black) JRBTreeIntrusiveRemoveFixup(tree, childLink, childParentLink);
+
+	link->parent = NULL;
+	link->left = NULL;
+	link->right = NULL;
+	tree->size--;
+	return DeleteSuccess;
+}
+
+/**
+ * @fn JRBTreeLinkPtr JRBTreeIntrusiveFind(const JRBTreeIntrusivePtr tree, const void *key, JRBTreeLinkKeyCompare keyCompare)
+ * @brief Intrusive RB Tree 에서 지정한 키와 같은 링크를 검색하는 함수
+ * 링크를 포함한 객체 안에 키가 있으므로 레벨마다 한 번만 메모리에 접근한다. (JNode 는 노드와 키 두 번)
+ * @param tree Intrusive RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키의 주소(입력, 읽기 전용)
+ * @param keyCompare 키와 링크 비교 함수, 트리의 링크 비교 함수와 순서가 같아야 한다.(입력)
+ * @return 성공 시 링크의 주소, 실패 시 NULL 반환
+ */
+JRBTreeLinkPtr JRBTreeIntrusiveFind(const JRBTreeIntrusivePtr tree, const void *key, JRBTreeLinkKeyCompare keyCompare)
+{
+	if(tree == NULL || keyCompare == NULL) return NULL;
+
+	JRBTreeLinkPtr currentLink = tree->root;
+	while(currentLink != NULL)
+	{
+		int result = keyCompare(key, currentLink);
+		if(result == 0) return currentLink;
+		currentLink = currentLink->child[result > 0];
+	}
+	return NULL;
+}
+
+/**
+ * @fn JRBTreeLinkPtr JRBTreeIntrusiveFirst(const JRBTreeIntrusivePtr tree)
+ * @brief Intrusive RB Tree 에서 가장 작은 링크를 반환하는 함수
+ * @param tree Intrusive RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 링크의 주소, 비어 있거나 실패 시 NULL 반환
+ */
+JRBTreeLinkPtr JRBTreeIntrusiveFirst(const JRBTreeIntrusivePtr tree)
+{
+	if(tree == NULL || tree->root == NULL) return NULL;
+
+	JRBTreeLinkPtr currentLink = tree->root;
+	while(currentLink->left != NULL) currentLink = currentLink->left;
+	return currentLink;
+}
+
+/**
+ * @fn JRBTreeLinkPtr JRBTreeIntrusiveLast(const JRBTreeIntrusivePtr tree)
+ * @brief Intrusive RB Tree 에서 가장 큰 링크를 반환하는 함수
+ * @param tree Intrusive RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 링크의 주소, 비어 있거나 실패 시 NULL 반환
+ */
+JRBTreeLinkPtr JRBTreeIntrusiveLast(const JRBTreeIntrusivePtr tree)
+{
+	if(tree == NULL || tree->root == NULL) return NULL;
+
+	JRBTreeLinkPtr currentLink = tree->root;
+	while(currentLink->right != NULL) currentLink = currentLink->right;
+	return currentLink;
+}
+
+/**
+ * @fn JRBTreeLinkPtr JRBTreeLinkGetNext(const JRBTreeLinkPtr link)
+ * @brief 중위 순회 기준으로 지정한 링크의 다음 링크를 반환하는 함수
+ * @param link 기준 링크(입력, 읽기 전용)
+ * @return 성공 시 다음 링크의 주소, 다음 링크가 없으면 NULL 반환
+ */
+JRBTreeLinkPtr JRBTreeLinkGetNext(const JRBTreeLinkPtr link)
+{
+	if(link == NULL) return NULL;
+
+	JRBTreeLinkPtr currentLink = link;
+	if(currentLink->right != NULL)
+	{
+		currentLink = currentLink->right;
+		while(currentLink->left != NULL) currentLink = currentLink->left;
+		return currentLink;
+	}
+
+	while((currentLink->parent != NULL) && (currentLink->parent->right == currentLink)) currentLink = currentLink->parent;
+	return currentLink->parent;
+}
+
+/**
+ * @fn JRBTreeLinkPtr JRBTreeLinkGetPrevious(const JRBTreeLinkPtr link)
+ * @brief 중위 순회 기준으로 지정한 링크의 이전 링크를 반환하는 함수
+ * @param link 기준 링크(입력, 읽기 전용)
+ * @return 성공 시 이전 링크의 주소, 이전 링크가 없으면 NULL 반환
+ */
+JRBTreeLinkPtr JRBTreeLinkGetPrevious(const JRBTreeLinkPtr link)
+{
+	if(link == NULL) return NULL;
+
+	JRBTreeLinkPtr currentLink = link;
+	if(currentLink->left != NULL)
+	{
+		currentLink = currentLink->left;
+		while(currentLink->right != NULL) currentLink = currentLink->right;
+		return currentLink;
+	}
+
+	while((currentLink->parent != NULL) && (currentLink->parent->left == currentLink)) currentLink = currentLink->parent;
+	return currentLink->parent;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// JRBTreeIntrusive Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void JRBTreeIntrusiveRotate(JRBTreeIntrusivePtr tree, JRBTreeLinkPtr link, int direction)
+ * @brief 지정한 링크를 기준으로 회전하는 함수
+ * direction 이 0 이면 왼쪽으로(오른쪽 자식이 올라옴), 1 이면 오른쪽으로(왼쪽 자식이 올라옴) 회전한다.
+ * @param tree Intrusive RB Tree 구조체 객체의 주소(출력)
+ * @param link 회전하기 위한 기준 링크(입력)
+ * @param direction 회전 방향(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeIntrusiveRotate(JRBTreeIntrusivePtr tree, JRBTreeLinkPtr link, int direction)
+{
+	JRBTreeLinkPtr childLink = link->child[!direction];
+
+	link->child[!direction] = childLink->child[direction];
+	if(childLink->child[direction] != NULL) childLink->child[direction]->parent = link;
+
+	childLink->parent = link->parent;
+	if(link->parent == NULL) tree->root = childLink;
+	else link->parent->child[link->parent->right == link] = childLink;
+
+	childLink->child[direction] = link;
+	link->parent = childLink;
+}
+
+/**
+ * @fn static void JRBTreeIntrusiveInsertFixup(JRBTreeIntrusivePtr tree, JRBTreeLinkPtr link)
+ * @brief 새로 추가된 Red 링크 때문에 깨진 RB Tree 조건을 복구하는 함수 (src/jrbtree.c 의 JRBTreeInsertFixup 과 같음)
+ * @param tree Intrusive RB Tree 구조체 객체의 주소(출력)
+ * @param link 새로 추가된 링크(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeIntrusiveInsertFixup(JRBTreeIntrusivePtr tree, JRBTreeLinkPtr link)
+{
+	JRBTreeLinkPtr currentLink = link;
+	while((currentLink->parent != NULL) && (currentLink->parent->color == Red))
+	{
+		JRBTreeLinkPtr parentLink = currentLink->parent;
+		JRBTreeLinkPtr grandParentLink = parentLink->parent;
+		// 부모 링크가 조부모 링크의 어느 쪽 자식인지 (0: 왼쪽, 1: 오른쪽)
+		int side = (grandParentLink->right == parentLink);
+		JRBTreeLinkPtr uncleLink = grandParentLink->child[!side];
+
+		// case 1) 삼촌 링크가 R 이면 색만 바꾸고 조부모 링크에서 다시 검사한다.
+		if(!_IsBlack(uncleLink))
+		{
+			parentLink->color = Black;
+			uncleLink->color = Black;
+			grandParentLink->color = Red;
+			currentLink = grandParentLink;
+			continue;
+		}
+
+		// case 2-1) 추가한 링크가 부모 링크의 안쪽 자식이면 부모 링크를 기준으로 회전해서 바깥쪽으로 만든다.
+		if(currentLink == parentLink->child[!side])
+		{
+			currentLink = parentLink;
+			JRBTreeIntrusiveRotate(tree, currentLink, side);
+			parentLink = currentLink->parent;
+		}
+
+		// case 2-2) 부모 링크를 B 로, 조부모 링크를 R 로 바꾸고 조부모 링크를 기준으로 회전한다.
+		parentLink->color = Black;
+		grandParentLink->color = Red;
+		JRBTreeIntrusiveRotate(tree, grandParentLink, !side);
+	}
+
+	tree->root->color = Black;
+}
+
+/**
+ * @fn static void JRBTreeIntrusiveTransplant(JRBTreeIntrusivePtr tree, const JRBTreeLinkPtr oldLink, JRBTreeLinkPtr newLink)
+ * @brief 지정한 링크가 있던 자리에 다른 링크(서브 트리)를 연결하는 함수
+ * @param tree Intrusive RB Tree 구조체 객체의 주소(출력)
+ * @param oldLink 자리를 내어줄 링크(입력, 읽기 전용)
+ * @param newLink 새로 연결할 링크, NULL 가능(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeIntrusiveTransplant(JRBTreeIntrusivePtr tree, const JRBTreeLinkPtr oldLink, JRBTreeLinkPtr newLink)
+{
+	JRBTreeLinkPtr parentLink = oldLink->parent;
+
+	if(parentLink == NULL) tree->root = newLink;
+	else parentLink->child[parentLink->right == oldLink] = newLink;
+
+	if(newLink != NULL) newLink->parent = parentLink;
+}
+
+/**
+ * @fn static void JRBTreeIntrusiveRemoveFixup(JRBTreeIntrusivePtr tree, JRBTreeLinkPtr link, JRBTreeLinkPtr parentLink)
+ * @brief Black 링크가 분리되어 깨진 RB Tree 조건(Black height)을 복구하는 함수 (src/jrbtree.c 의 JRBTreeDeleteFixup 과 같음)
+ * @param tree Intrusive RB Tree 구조체 객체의 주소(출력)
+ * @param link 분리된 링크 자리로 올라온 링크, NULL 가능(입력)
+ * @param parentLink link 의 부모 링크(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeIntrusiveRemoveFixup(JRBTreeIntrusivePtr tree, JRBTreeLinkPtr link, JRBTreeLinkPtr parentLink)
+{
+	JRBTreeLinkPtr currentLink = link;
+	JRBTreeLinkPtr currentParentLink = parentLink;
+
+	while((currentLink != tree->root) && _IsBlack(currentLink))
+	{
+		// 현재 링크가 부모 링크의 어느 쪽 자식인지 (0: 왼쪽, 1: 오른쪽)
+		int side = (currentParentLink->right == currentLink);
+		JRBTreeLinkPtr siblingLink = currentParentLink->child[!side];
+
+		// case 1) 형제 링크가 R 이면 부모 링크를 기준으로 회전해서 형제 링크를 B 로 만든다.
+		if(siblingLink->color == Red)
+		{
+			siblingLink->color = Black;
+			currentParentLink->color = Red;
+			JRBTreeIntrusiveRotate(tree, currentParentLink, side);
+			siblingLink = currentParentLink->child[!side];
+		}
+
+		// case 2) 형제 링크의 자식 링크가 모두 B 이면 형제 링크를 R 로 바꾸고 부모 링크에서 다시 검사한다.
+		if(_IsBlack(siblingLink->left) && _IsBlack(siblingLink->right))
+		{
+			siblingLink->color = Red;
+			currentLink = currentParentLink;
+			currentParentLink = currentLink->parent;
+			continue;
+		}
+
+		// case 3) 형제 링크의 바깥쪽 자식이 B 이면 형제 링크를 기준으로 회전해서 바깥쪽 자식을 R 로 만든다.
+		if(_IsBlack(siblingLink->child[!side]))
+		{
+			siblingLink->child[side]->color = Black;
+			siblingLink->color = Red;
+			JRBTreeIntrusiveRotate(tree, siblingLink, !side);
+			siblingLink = currentParentLink->child[!side];
+		}
+
+		// case 4) 형제 링크의 바깥쪽 자식이 R 이면 부모 링크를 기준으로 회전하고 끝낸다.
+		siblingLink->color = currentParentLink->color;
+		currentParentLink->color = Black;
+		siblingLink->child[!side]->color = Black;
+		JRBTreeIntrusiveRotate(tree, currentParentLink, side);
+		currentLink = tree->root;
+	}
+
+	if(currentLink != NULL) currentLink->color = Black;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int _IsBlack(const JRBTreeLinkPtr link)
+ * @brief 지정한 링크가 Black 인지 검사하는 함수 (외부 링크(NULL)는 Black 으로 취급)
+ * @param link 검사할 링크(입력, 읽기 전용)
+ * @return Black 이면 1, Red 이면 0 반환
+ */
+static int _IsBlack(const JRBTreeLinkPtr link)
+{
+	return (link == NULL) || (link->color == Black);
+}
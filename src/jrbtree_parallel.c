@@ -0,0 +1,915 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "../include/jrbtree.h"
+#include "../include/jrbtree_inline.h"
+#include "jrbtree_internal.h"
+
+// 병렬 정렬에서 삽입 정렬로 먼저 정렬하는 블록 크기
+#define BUILD_INSERTION_SORT_SIZE 16
+// 병렬 생성에서 thread 하나가 맡을 최소 키 개수 (이보다 적으면 thread 를 덜 사용한다)
+#define BUILD_MIN_KEYS_PER_THREAD 4096
+
+///////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Parallel Static Functions
+///////////////////////////////////////////////////////////////////////////////
+
+static int JRBTreeParallelRun(const JRBTreePtr tree, JRBTreeParallelJobPtr job, int threadCount);
+static int JRBTreeParallelSplit(const JRBTreePtr tree, JRBTreeParallelJobPtr job, size_t targetCount);
+static void* JRBTreeParallelWorkerMain(void *argument);
+static void JRBTreeParallelVisitChunk(JRBTreeParallelJobPtr job, size_t chunk);
+static void JRBTreeParallelRunTasks(void (*function)(void *argument, size_t task), void *argument, size_t taskCount, int threadCount);
+static void* JRBTreeParallelTaskMain(void *argument);
+static int JRBTreeBuildSortKeys(JRBTreeParallelBuildPtr build, int threadCount);
+static size_t JRBTreeBuildRemoveDuplicates(JRBTreeParallelBuildPtr build, int threadCount);
+static void JRBTreeBuildSortRun(void *argument, size_t task);
+static void JRBTreeBuildMergeRuns(void *argument, size_t task);
+static void JRBTreeBuildCountUnique(void *argument, size_t block);
+static void JRBTreeBuildCompactUnique(void *argument, size_t block);
+static void JRBTreeBuildSubtree(void *argument, size_t task);
+
+///////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+///////////////////////////////////////////////////////////////////////////////
+
+static int _GetThreadCount(int threadCount);
+static void _AppendBoundary(JRBTreeParallelJobPtr job, JNodePtr node);
+static void _CollectBoundaries(JRBTreeParallelJobPtr job, JNodePtr node, int depth);
+static void _CollectBPlusBoundaries(JRBTreeParallelJobPtr job, const JRBTreeBPlusNodePtr node, int depth);
+static int _TakeOwnChunk(JRBTreeParallelWorkerPtr worker, size_t *chunk);
+static int _StealChunk(JRBTreeParallelWorkerPtr worker, size_t *chunk);
+static void _SortKeys(void **keys, void **buffer, size_t count, KeyType type);
+static void _MergeKeys(void **left, size_t leftCount, void **right, size_t rightCount, void **output, KeyType type);
+static size_t _SplitMerge(void **left, size_t leftCount, void **right, size_t rightCount, size_t diagonal, KeyType type);
+static JNodePtr _BuildNodes(JRBTreeParallelBuildPtr build, size_t low, size_t high, int depth, JNodePtr parent, int isTop);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JRBTree
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn size_t JRBTreeParallelForEach(const JRBTreePtr tree, JRBTreeVisitFunc fn, void *ctx, int threadCount)
+ * @brief 여러 thread 로 RB Tree 의 모든 키를 방문하는 함수
+ * 트리를 위쪽 노드들을 경계로 키 순서의 조각(thread 당 JRBTREE_PARALLEL_CHUNKS_PER_THREAD 개)으로 나눠서 worker 들에게 나눠주고,
+ * 자기 조각을 다 끝낸 worker 는 다른 worker 의 남은 조각을 가져가서(work stealing) 처리한다.
+ * 조각 번호(chunk)는 키 순서이므로 조각별로 결과를 모은 후 번호 순서로 이어 붙이면 키 순서의 결과가 된다.
+ * B+ Tree 엔진과 radix 표 트리도 같은 방식으로 나눈다.
+ * 방문하는 동안 트리를 변경하면 안 되며, fn 은 여러 thread 에서 동시에 호출된다.
+ * (hot cache 를 갱신하는 JRBTreeFindNodeByKey 등 트리에 쓰는 함수도 fn 에서 호출하면 안 된다)
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param fn 키마다 호출할 함수(입력, JRBTreeVisitFunc 참고)
+ * @param ctx fn 에 전달할 사용자 데이터(입력, NULL 가능)
+ * @param threadCount 사용할 thread 개수(입력, 0 이하면 온라인 CPU 개수, 호출한 thread 포함)
+ * @return 성공 시 방문한 키 개수, 실패 시 0 반환
+ */
+size_t JRBTreeParallelForEach(const JRBTreePtr tree, JRBTreeVisitFunc fn, void *ctx, int threadCount)
+{
+	if(tree == NULL || fn == NULL) return 0;
+
+	JRBTreeParallelJob job;
+	memset(&job, 0, sizeof(job));
+	job.visit = fn;
+	job.ctx = ctx;
+
+	if(JRBTreeParallelRun(tree, &job, threadCount) == 0) return 0;
+	return job.visitedCount;
+}
+
+/**
+ * @fn int JRBTreeParallelReduce(const JRBTreePtr tree, JRBTreeReduceFunc reduce, JRBTreeMergeFunc merge, void *ctx, int threadCount, size_t resultSize, void *result)
+ * @brief 여러 thread 로 RB Tree 의 모든 키를 하나의 값으로 누적하는 함수
+ * JRBTreeParallelForEach 와 같은 조각마다 result 의 초기 값을 복사한 누적 값에 reduce 로 키를 더한 후,
+ * 모든 조각이 끝나면 호출한 thread 에서 result 에 조각의 누적 값들을 조각 번호(키) 순서로 merge 한다.
+ * 그러므로 result 의 초기 값은 merge 의 항등원이어야 하며, merge 가 결합 법칙만 만족하면 (교환 법칙은 필요 없음)
+ * 키 순서로 하나씩 누적한 결과와 같다. (예: 키 순서로 이어 붙인 출력)
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param reduce 조각의 누적 값에 키를 더하는 함수(입력, 여러 thread 에서 동시에 호출, 서로 다른 누적 값)
+ * @param merge 누적 값을 합치는 함수(입력, 호출한 thread 에서만 호출)
+ * @param ctx reduce, merge 에 전달할 사용자 데이터(입력, NULL 가능)
+ * @param threadCount 사용할 thread 개수(입력, 0 이하면 온라인 CPU 개수, 호출한 thread 포함)
+ * @param resultSize 누적 값 크기(입력, 0 보다 커야 한다)
+ * @param result 누적 값의 초기 값(항등원, 입력)이자 결과를 저장할 주소(출력)
+ * @return 성공 시 1, 실패 시 0 반환 (비어 있는 트리는 result 를 바꾸지 않고 1 반환)
+ */
+int JRBTreeParallelReduce(const JRBTreePtr tree, JRBTreeReduceFunc reduce, JRBTreeMergeFunc merge, void *ctx, int threadCount, size_t resultSize, void *result)
+{
+	if(tree == NULL || reduce == NULL || merge == NULL || resultSize == 0 || result == NULL) return 0;
+
+	JRBTreeParallelJob job;
+	memset(&job, 0, sizeof(job));
+	job.reduce = reduce;
+	job.accumulatorSize = resultSize;
+	job.identity = result;
+	job.ctx = ctx;
+
+	if(JRBTreeParallelRun(tree, &job, threadCount) == 0) return 0;
+
+	size_t chunk = 0;
+	for( ; chunk < job.chunkCount; chunk++) merge(result, job.accumulators + chunk * job.accumulatorStride, ctx);
+	free(job.accumulators);
+	return 1;
+}
+
+/**
+ * @fn JRBTreePtr JRBTreeBuildParallel(KeyType type, void **keys, size_t count, int threadCount)
+ * @brief 정렬되지 않은 키 배열로 여러 thread 를 사용해서 RB Tree 구조체 객체를 생성하는 함수
+ * 1) 키 배열을 thread 마다 나눠서 안정 병합 정렬한 후, 정렬된 구간 쌍들을 다시 여러 조각으로 나눠서(merge path) 병렬로 병합한다.
+ * 2) 블록마다 남길 키 개수를 센 후 시작 위치를 정해서 병렬로 같은 값의 키를 제거한다. (입력에서 처음 나온 키 하나만 남김)
+ * 3) 노드 arena 에 키 개수만큼의 노드 영역을 한 번에 할당하고, 정렬된 i 번째 키의 노드를 i 번째 칸에 둔다.
+ *    위쪽 몇 단계를 먼저 연결한 후 그 아래 서브 트리들을 병렬로 만든다. (노드 위치가 정해져 있으므로 바로 연결된다)
+ * 가운데 키를 루트로 나누므로 모든 외부 노드의 깊이 차이가 1 이하이고, 완전 이진 트리가 아니면 가장 깊은 단계만 Red 로 칠한다.
+ * 생성된 트리는 NewJRBTree 로 생성한 트리와 같이 동작한다. (키 주소를 저장, 이후 추가/삭제 가능)
+ * 노드는 arena 에서 할당하므로 삭제된 노드는 재사용되고, DeleteJRBTree 에서 한 번에 해제된다.
+ * @param type 저장할 키 데이터 유형(입력)
+ * @param keys 키 주소 배열(입력, 바뀌지 않음, 키는 NULL 이면 안 된다)
+ * @param count 키 개수(입력, 0 이면 빈 트리)
+ * @param threadCount 사용할 thread 개수(입력, 0 이하면 온라인 CPU 개수, 호출한 thread 포함)
+ * @return 성공 시 생성된 RB Tree 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JRBTreePtr JRBTreeBuildParallel(KeyType type, void **keys, size_t count, int threadCount)
+{
+	if(keys == NULL && count > 0) return NULL;
+
+	JRBTreePtr newTree = NewJRBTree(type);
+	if(newTree == NULL) return NULL;
+	if(count == 0) return newTree;
+
+	newTree->nodeArena = NewJRBTreeArena(0);
+	if(newTree->nodeArena == NULL)
+	{
+		DeleteJRBTree(&newTree);
+		return NULL;
+	}
+
+	threadCount = _GetThreadCount(threadCount);
+	if((size_t)threadCount > (count + BUILD_MIN_KEYS_PER_THREAD - 1) / BUILD_MIN_KEYS_PER_THREAD) threadCount = (int)((count + BUILD_MIN_KEYS_PER_THREAD - 1) / BUILD_MIN_KEYS_PER_THREAD);
+
+	JRBTreeParallelBuild build;
+	memset(&build, 0, sizeof(build));
+	build.type = type;
+	build.input = keys;
+	build.count = count;
+
+	// 1) 정렬, 2) 중복 제거 후 정렬된 키는 build.target 에 있다.
+	if(JRBTreeBuildSortKeys(&build, threadCount) == 0)
+	{
+		DeleteJRBTree(&newTree);
+		return NULL;
+	}
+	size_t uniqueCount = JRBTreeBuildRemoveDuplicates(&build, threadCount);
+	if(uniqueCount == 0)
+	{
+		free(build.source);
+		free(build.target);
+		DeleteJRBTree(&newTree);
+		return NULL;
+	}
+
+	// 3) 노드 영역과 서브 트리 배열 할당
+	build.nodes = (JNodePtr)JRBTreeArenaAlloc(newTree->nodeArena, sizeof(JNode) * uniqueCount, sizeof(void*));
+	for(build.subtreeDepth = 0; ((size_t)1 << build.subtreeDepth) < (size_t)threadCount * JRBTREE_PARALLEL_CHUNKS_PER_THREAD; build.subtreeDepth++);
+	build.subtrees = (JRBTreeParallelSubtreePtr)malloc(sizeof(JRBTreeParallelSubtree) * ((size_t)1 << build.subtreeDepth));
+	if(build.nodes == NULL || build.subtrees == NULL)
+	{
+		free(build.subtrees);
+		free(build.source);
+		free(build.target);
+		DeleteJRBTree(&newTree);
+		return NULL;
+	}
+
+	// 높이가 h 이면 외부 노드의 깊이는 h - 1 또는 h 이므로, 완전 이진 트리가 아니면 깊이 h - 1 의 노드만 Red 로 칠한다.
+	int height = 0;
+	for( ; ((size_t)1 << height) <= uniqueCount; height++);
+	build.redDepth = ((uniqueCount & (uniqueCount + 1)) == 0) ? -1 : height - 1;
+
+	newTree->root = _BuildNodes(&build, 0, uniqueCount, 0, NULL, 1);
+	JRBTreeParallelRunTasks(JRBTreeBuildSubtree, &build, build.subtreeCount, threadCount);
+
+	newTree->root->color = Black;
+	newTree->leftmost = &(build.nodes[0]);
+	newTree->rightmost = &(build.nodes[uniqueCount - 1]);
+	newTree->size = uniqueCount;
+	JRBTREE_STAT_ADD(newTree, inserts, uniqueCount);
+
+	free(build.subtrees);
+	free(build.source);
+	free(build.target);
+	return newTree;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// Parallel Static Functions
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int JRBTreeParallelRun(const JRBTreePtr tree, JRBTreeParallelJobPtr job, int threadCount)
+ * @brief 트리를 조각으로 나누고 worker thread 들로 모든 조각을 처리하는 함수
+ * 0 번 worker 는 호출한 thread 에서 실행하고, 생성하지 못한 thread 의 조각은 다른 worker 들이 가져가서 처리한다.
+ * reduce 작업이면 조각별 누적 값 배열(job->accumulators)을 할당하며, 성공한 경우 호출한 쪽에서 해제해야 한다.
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param job 작업 구조체, visit 또는 reduce 가 지정되어 있어야 한다.(입력, 출력)
+ * @param threadCount 사용할 thread 개수(입력, 0 이하면 온라인 CPU 개수)
+ * @return 성공 시 1, 실패 시 0 반환
+ */
+static int JRBTreeParallelRun(const JRBTreePtr tree, JRBTreeParallelJobPtr job, int threadCount)
+{
+	int workerCount = _GetThreadCount(threadCount);
+	if(JRBTreeParallelSplit(tree, job, (size_t)workerCount * JRBTREE_PARALLEL_CHUNKS_PER_THREAD) == 0) return 0;
+	if(job->chunkCount == 0) return 1;
+	if((size_t)workerCount > job->chunkCount) workerCount = (int)job->chunkCount;
+
+	if(job->reduce != NULL)
+	{
+		// 조각별 누적 값이 서로 다른 캐시 라인에 있도록 간격을 정렬 단위로 올린다.
+		job->accumulatorStride = (job->accumulatorSize + JRBTREE_PARALLEL_ALIGNMENT - 1) / JRBTREE_PARALLEL_ALIGNMENT * JRBTREE_PARALLEL_ALIGNMENT;
+		job->accumulators = (unsigned char*)aligned_alloc(JRBTREE_PARALLEL_ALIGNMENT, job->accumulatorStride * job->chunkCount);
+		if(job->accumulators == NULL)
+		{
+			free(job->boundaries);
+			return 0;
+		}
+
+		size_t chunk = 0;
+		for( ; chunk < job->chunkCount; chunk++) memcpy(job->accumulators + chunk * job->accumulatorStride, job->identity, job->accumulatorSize);
+	}
+
+	job->workers = (JRBTreeParallelWorkerPtr)aligned_alloc(JRBTREE_PARALLEL_ALIGNMENT, sizeof(JRBTreeParallelWorker) * (size_t)workerCount);
+	if(job->workers == NULL)
+	{
+		free(job->accumulators);
+		job->accumulators = NULL;
+		free(job->boundaries);
+		return 0;
+	}
+	job->workerCount = workerCount;
+
+	// worker 마다 연속된 조각 번호 범위를 나눠준다.
+	int workerIndex = 0;
+	for( ; workerIndex < workerCount; workerIndex++)
+	{
+		JRBTreeParallelWorkerPtr worker = &(job->workers[workerIndex]);
+		unsigned long long begin = (unsigned long long)(job->chunkCount * (size_t)workerIndex / (size_t)workerCount);
+		unsigned long long end = (unsigned long long)(job->chunkCount * (size_t)(workerIndex + 1) / (size_t)workerCount);
+		worker->range = (begin << 32) | end;
+		worker->job = job;
+		worker->index = workerIndex;
+		worker->started = 0;
+	}
+
+	for(workerIndex = 1; workerIndex < workerCount; workerIndex++)
+	{
+		JRBTreeParallelWorkerPtr worker = &(job->workers[workerIndex]);
+		if(pthread_create(&(worker->thread), NULL, JRBTreeParallelWorkerMain, worker) == 0) worker->started = 1;
+	}
+
+	JRBTreeParallelWorkerMain(&(job->workers[0]));
+
+	for(workerIndex = 1; workerIndex < workerCount; workerIndex++)
+	{
+		if(job->workers[workerIndex].started == 1) pthread_join(job->workers[workerIndex].thread, NULL);
+	}
+
+	free(job->workers);
+	job->workers = NULL;
+	free(job->boundaries);
+	job->boundaries = NULL;
+	return 1;
+}
+
+/**
+ * @fn static int JRBTreeParallelSplit(const JRBTreePtr tree, JRBTreeParallelJobPtr job, size_t targetCount)
+ * @brief 트리를 키 순서의 조각들로 나누고 조각의 시작 노드들을 job->boundaries 에 저장하는 함수
+ * 첫 번째 조각은 가장 작은 노드에서 시작하고, 나머지 경계는 위쪽 노드들을 중위 순서로 모은다.
+ * (RB Tree 는 log2(targetCount) 깊이까지의 노드, B+ Tree 는 위쪽 내부 노드의 분리 키 노드,
+ * radix 표는 칸마다 가장 작은 노드와 칸의 서브 트리 위쪽 노드)
+ * 모은 경계가 targetCount 보다 많으면 일정한 간격으로 골라서 줄인다.
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param job 작업 구조체(출력, boundaries 와 chunkCount, 비어 있는 트리면 NULL 과 0)
+ * @param targetCount 나눌 조각 개수(입력)
+ * @return 성공 시 1, 실패 시 0 반환
+ */
+static int JRBTreeParallelSplit(const JRBTreePtr tree, JRBTreeParallelJobPtr job, size_t targetCount)
+{
+	job->boundaries = NULL;
+	job->chunkCount = 0;
+	if(tree->size == 0) return 1;
+
+	// 모을 경계 개수의 상한으로 한 번만 할당한다.
+	int depth = 0;
+	size_t capacity = 1;
+	size_t nonEmptyCount = 0;
+	if(tree->bplus != NULL)
+	{
+		// 내부 노드의 자식은 최대 JRBTREE_BPLUS_ORDER + 1 개이다.
+		size_t span = 1;
+		for(depth = 0; depth < tree->bplus->height - 1 && span < targetCount; depth++) span *= JRBTREE_BPLUS_ORDER + 1;
+		capacity += span;
+	}
+	else if(tree->radix != NULL)
+	{
+		size_t slot = 0;
+		for( ; slot < tree->radix->slotCount; slot++)
+		{
+			if(tree->radix->headers[slot].key != NULL) nonEmptyCount++;
+		}
+		for(depth = 0; (nonEmptyCount << depth) < targetCount; depth++);
+		capacity += nonEmptyCount << depth;
+	}
+	else
+	{
+		for(depth = 0; ((size_t)1 << depth) < targetCount; depth++);
+		capacity += (size_t)1 << depth;
+	}
+
+	job->boundaries = (JNodePtr*)malloc(sizeof(JNodePtr) * capacity);
+	if(job->boundaries == NULL) return 0;
+
+	_AppendBoundary(job, tree->leftmost);
+	if(tree->bplus != NULL) _CollectBPlusBoundaries(job, tree->bplus->root, depth);
+	else if(tree->radix != NULL)
+	{
+		size_t slot = 0;
+		for( ; slot < tree->radix->slotCount; slot++)
+		{
+			JNodePtr subtreeRoot = (JNodePtr)tree->radix->headers[slot].key;
+			if(subtreeRoot == NULL) continue;
+			_AppendBoundary(job, JNodeGetLeftmost(subtreeRoot));
+			_CollectBoundaries(job, subtreeRoot, depth);
+		}
+	}
+	else _CollectBoundaries(job, tree->root, depth);
+
+	// 경계가 너무 많으면 (radix 표의 칸이 많은 경우 등) 일정한 간격으로 골라서 줄인다.
+	if(job->chunkCount > targetCount)
+	{
+		size_t step = (job->chunkCount + targetCount - 1) / targetCount;
+		size_t keptCount = 0;
+		size_t index = 0;
+		for( ; index < job->chunkCount; index += step) job->boundaries[keptCount++] = job->boundaries[index];
+		job->chunkCount = keptCount;
+	}
+	return 1;
+}
+
+/**
+ * @fn static void* JRBTreeParallelWorkerMain(void *argument)
+ * @brief 자기 조각들을 앞에서부터 처리하고, 다 끝나면 다른 worker 의 조각을 뒤에서부터 가져가서 처리하는 worker 함수
+ * 조각은 새로 생기지 않으므로 모든 worker 의 범위가 비면 끝난다.
+ * @param argument worker 구조체의 주소(입력, JRBTreeParallelWorkerPtr)
+ * @return 항상 NULL 반환
+ */
+static void* JRBTreeParallelWorkerMain(void *argument)
+{
+	JRBTreeParallelWorkerPtr worker = (JRBTreeParallelWorkerPtr)argument;
+	size_t chunk = 0;
+
+	while(_TakeOwnChunk(worker, &chunk) == 1 || _StealChunk(worker, &chunk) == 1)
+	{
+		JRBTreeParallelVisitChunk(worker->job, chunk);
+	}
+	return NULL;
+}
+
+/**
+ * @fn static void JRBTreeParallelVisitChunk(JRBTreeParallelJobPtr job, size_t chunk)
+ * @brief 조각의 노드들을 키 순서로 방문하는 함수 (다음 조각의 시작 노드 앞까지)
+ * @param job 작업 구조체(입력, 출력)
+ * @param chunk 조각 번호(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeParallelVisitChunk(JRBTreeParallelJobPtr job, size_t chunk)
+{
+	JNodePtr currentNode = job->boundaries[chunk];
+	JNodePtr endNode = (chunk + 1 < job->chunkCount) ? job->boundaries[chunk + 1] : NULL;
+	size_t count = 0;
+
+	if(job->visit != NULL)
+	{
+		for( ; currentNode != endNode; currentNode = JNodeGetNext(currentNode), count++) job->visit(currentNode->key, chunk, job->ctx);
+	}
+	else
+	{
+		void *accumulator = job->accumulators + chunk * job->accumulatorStride;
+		for( ; currentNode != endNode; currentNode = JNodeGetNext(currentNode), count++) job->reduce(accumulator, currentNode->key, job->ctx);
+	}
+
+	__atomic_fetch_add(&(job->visitedCount), count, __ATOMIC_RELAXED);
+}
+
+/**
+ * @fn static void JRBTreeParallelRunTasks(void (*function)(void *argument, size_t task), void *argument, size_t taskCount, int threadCount)
+ * @brief 작업 번호 0 부터 taskCount - 1 까지 여러 thread 로 function 을 호출하는 함수
+ * thread 들이 공유 카운터로 다음 작업 번호를 하나씩 가져가므로 작업 크기가 달라도 먼저 끝난 thread 가 더 많이 처리한다.
+ * 호출한 thread 도 작업을 처리하고, 생성하지 못한 thread 의 몫은 다른 thread 들이 처리한다.
+ * @param function 작업 함수(입력)
+ * @param argument 작업 함수에 전달할 데이터(입력)
+ * @param taskCount 작업 개수(입력)
+ * @param threadCount 사용할 thread 개수(입력, 1 이상)
+ * @return 반환값 없음
+ */
+static void JRBTreeParallelRunTasks(void (*function)(void *argument, size_t task), void *argument, size_t taskCount, int threadCount)
+{
+	JRBTreeParallelTasks tasks;
+	tasks.function = function;
+	tasks.argument = argument;
+	tasks.taskCount = taskCount;
+	tasks.nextTask = 0;
+
+	if((size_t)threadCount > taskCount) threadCount = (int)taskCount;
+	pthread_t threads[JRBTREE_PARALLEL_MAX_THREADS];
+	int startedCount = 0;
+	for( ; startedCount < threadCount - 1; startedCount++)
+	{
+		if(pthread_create(&threads[startedCount], NULL, JRBTreeParallelTaskMain, &tasks) != 0) break;
+	}
+
+	JRBTreeParallelTaskMain(&tasks);
+
+	int threadIndex = 0;
+	for( ; threadIndex < startedCount; threadIndex++) pthread_join(threads[threadIndex], NULL);
+}
+
+/**
+ * @fn static void* JRBTreeParallelTaskMain(void *argument)
+ * @brief 남은 작업이 없을 때까지 작업 번호를 가져와서 처리하는 thread 함수
+ * @param argument 작업 묶음 구조체의 주소(입력, JRBTreeParallelTasksPtr)
+ * @return 항상 NULL 반환
+ */
+static void* JRBTreeParallelTaskMain(void *argument)
+{
+	JRBTreeParallelTasksPtr tasks = (JRBTreeParallelTasksPtr)argument;
+	while(1)
+	{
+		size_t task = __atomic_fetch_add(&(tasks->nextTask), 1, __ATOMIC_RELAXED);
+		if(task >= tasks->taskCount) break;
+		tasks->function(tasks->argument, task);
+	}
+	return NULL;
+}
+
+/**
+ * @fn static int JRBTreeBuildSortKeys(JRBTreeParallelBuildPtr build, int threadCount)
+ * @brief 입력 키 배열을 여러 thread 로 안정 정렬하는 함수
+ * thread 마다 한 구간씩 정렬한 후, 정렬된 구간 쌍들을 병합하는 단계를 구간이 하나 남을 때까지 반복한다.
+ * 병합 단계마다 구간 쌍 하나를 여러 조각으로 나눠서 모든 thread 가 계속 병합에 참여한다.
+ * @param build 병렬 생성 작업 구조체(입력, 출력, 성공 시 정렬된 키는 source 에 있고 source, target 은 호출한 쪽에서 해제)
+ * @param threadCount 사용할 thread 개수(입력)
+ * @return 성공 시 1, 실패(메모리 부족, NULL 키) 시 0 반환
+ */
+static int JRBTreeBuildSortKeys(JRBTreeParallelBuildPtr build, int threadCount)
+{
+	build->source = (void**)malloc(sizeof(void*) * build->count);
+	build->target = (void**)malloc(sizeof(void*) * build->count);
+	build->runCount = (size_t)threadCount;
+	build->runStarts = (size_t*)malloc(sizeof(size_t) * (build->runCount + 1));
+	if(build->source == NULL || build->target == NULL || build->runStarts == NULL)
+	{
+		free(build->runStarts);
+		free(build->target);
+		free(build->source);
+		return 0;
+	}
+
+	size_t runIndex = 0;
+	for( ; runIndex <= build->runCount; runIndex++) build->runStarts[runIndex] = build->count * runIndex / build->runCount;
+	JRBTreeParallelRunTasks(JRBTreeBuildSortRun, build, build->runCount, threadCount);
+
+	while(build->runCount > 1 && build->hasNullKey == 0)
+	{
+		// 구간 쌍이 thread 개수보다 적으면 쌍마다 여러 조각으로 나눈다. (마지막 홀수 구간은 빈 구간과 병합해서 복사)
+		size_t pairCount = (build->runCount + 1) / 2;
+		build->partsPerPair = ((size_t)threadCount + pairCount - 1) / pairCount;
+		JRBTreeParallelRunTasks(JRBTreeBuildMergeRuns, build, pairCount * build->partsPerPair, threadCount);
+
+		for(runIndex = 0; runIndex < pairCount; runIndex++) build->runStarts[runIndex] = build->runStarts[runIndex * 2];
+		build->runStarts[pairCount] = build->count;
+		build->runCount = pairCount;
+
+		void **sortedKeys = build->target;
+		build->target = build->source;
+		build->source = sortedKeys;
+	}
+
+	free(build->runStarts);
+	build->runStarts = NULL;
+	if(build->hasNullKey == 1)
+	{
+		free(build->target);
+		free(build->source);
+		return 0;
+	}
+	return 1;
+}
+
+/**
+ * @fn static size_t JRBTreeBuildRemoveDuplicates(JRBTreeParallelBuildPtr build, int threadCount)
+ * @brief 정렬된 source 에서 같은 값의 키를 제거해서 target 에 저장하는 함수 (각 값의 첫 번째 키만 남김)
+ * 블록마다 남길 키 개수를 병렬로 센 후, 앞 블록들의 개수 합을 시작 위치로 해서 병렬로 복사한다.
+ * @param build 병렬 생성 작업 구조체(입력, 출력)
+ * @param threadCount 사용할 thread 개수(입력)
+ * @return 성공 시 남은 키 개수, 실패 시 0 반환
+ */
+static size_t JRBTreeBuildRemoveDuplicates(JRBTreeParallelBuildPtr build, int threadCount)
+{
+	size_t blockCount = (size_t)threadCount * JRBTREE_PARALLEL_CHUNKS_PER_THREAD;
+	build->blockLength = (build->count + blockCount - 1) / blockCount;
+	blockCount = (build->count + build->blockLength - 1) / build->blockLength;
+	build->blockCounts = (size_t*)malloc(sizeof(size_t) * blockCount);
+	if(build->blockCounts == NULL) return 0;
+
+	JRBTreeParallelRunTasks(JRBTreeBuildCountUnique, build, blockCount, threadCount);
+
+	size_t uniqueCount = 0;
+	size_t block = 0;
+	for( ; block < blockCount; block++)
+	{
+		size_t blockUniqueCount = build->blockCounts[block];
+		build->blockCounts[block] = uniqueCount;
+		uniqueCount += blockUniqueCount;
+	}
+
+	JRBTreeParallelRunTasks(JRBTreeBuildCompactUnique, build, blockCount, threadCount);
+
+	free(build->blockCounts);
+	build->blockCounts = NULL;
+	return uniqueCount;
+}
+
+/**
+ * @fn static void JRBTreeBuildSortRun(void *argument, size_t task)
+ * @brief 입력 키 배열의 한 구간을 source 로 복사하고 정렬하는 작업 함수 (NULL 키가 있으면 hasNullKey 설정)
+ * @param argument 병렬 생성 작업 구조체의 주소(입력, 출력)
+ * @param task 구간 번호(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeBuildSortRun(void *argument, size_t task)
+{
+	JRBTreeParallelBuildPtr build = (JRBTreeParallelBuildPtr)argument;
+	size_t low = build->runStarts[task];
+	size_t high = build->runStarts[task + 1];
+
+	size_t index = low;
+	for( ; index < high; index++)
+	{
+		if(build->input[index] == NULL)
+		{
+			__atomic_store_n(&(build->hasNullKey), 1, __ATOMIC_RELAXED);
+			return;
+		}
+		build->source[index] = build->input[index];
+	}
+
+	_SortKeys(build->source + low, build->target + low, high - low, build->type);
+}
+
+/**
+ * @fn static void JRBTreeBuildMergeRuns(void *argument, size_t task)
+ * @brief source 의 정렬된 구간 쌍 하나의 병합 결과 중 한 조각을 target 에 저장하는 작업 함수
+ * 결과의 조각 경계마다 두 구간에서 몇 개씩 가져와야 하는지 이진 검색으로 찾아서(merge path) 조각끼리 독립적으로 병합한다.
+ * @param argument 병렬 생성 작업 구조체의 주소(입력, 출력)
+ * @param task 작업 번호 (구간 쌍 번호 * partsPerPair + 조각 번호)(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeBuildMergeRuns(void *argument, size_t task)
+{
+	JRBTreeParallelBuildPtr build = (JRBTreeParallelBuildPtr)argument;
+	size_t pair = task / build->partsPerPair;
+	size_t part = task % build->partsPerPair;
+
+	size_t low = build->runStarts[pair * 2];
+	size_t middle = build->runStarts[pair * 2 + 1];
+	size_t high = (pair * 2 + 2 <= build->runCount) ? build->runStarts[pair * 2 + 2] : middle;
+	void **left = build->source + low;
+	void **right = build->source + middle;
+	size_t leftCount = middle - low;
+	size_t rightCount = high - middle;
+
+	size_t beginDiagonal = (leftCount + rightCount) * part / build->partsPerPair;
+	size_t endDiagonal = (leftCount + rightCount) * (part + 1) / build->partsPerPair;
+	size_t beginLeft = _SplitMerge(left, leftCount, right, rightCount, beginDiagonal, build->type);
+	size_t endLeft = _SplitMerge(left, leftCount, right, rightCount, endDiagonal, build->type);
+
+	_MergeKeys(left + beginLeft, endLeft - beginLeft, right + (beginDiagonal - beginLeft), (endDiagonal - endLeft) - (beginDiagonal - beginLeft),
+		build->target + low + beginDiagonal, build->type);
+}
+
+/**
+ * @fn static void JRBTreeBuildCountUnique(void *argument, size_t block)
+ * @brief 정렬된 source 의 한 블록에서 남길 키(앞 키와 값이 다른 키) 개수를 세는 작업 함수
+ * @param argument 병렬 생성 작업 구조체의 주소(입력, 출력)
+ * @param block 블록 번호(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeBuildCountUnique(void *argument, size_t block)
+{
+	JRBTreeParallelBuildPtr build = (JRBTreeParallelBuildPtr)argument;
+	size_t low = block * build->blockLength;
+	size_t high = (low + build->blockLength < build->count) ? low + build->blockLength : build->count;
+
+	size_t uniqueCount = 0;
+	size_t index = low;
+	for( ; index < high; index++)
+	{
+		if(index == 0 || JNodeCompareKeyInline(build->source[index - 1], build->source[index], build->type) != 0) uniqueCount++;
+	}
+	build->blockCounts[block] = uniqueCount;
+}
+
+/**
+ * @fn static void JRBTreeBuildCompactUnique(void *argument, size_t block)
+ * @brief 정렬된 source 의 한 블록에서 남길 키들을 target 의 블록 시작 위치부터 복사하는 작업 함수
+ * @param argument 병렬 생성 작업 구조체의 주소(입력, 출력)
+ * @param block 블록 번호(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeBuildCompactUnique(void *argument, size_t block)
+{
+	JRBTreeParallelBuildPtr build = (JRBTreeParallelBuildPtr)argument;
+	size_t low = block * build->blockLength;
+	size_t high = (low + build->blockLength < build->count) ? low + build->blockLength : build->count;
+
+	size_t position = build->blockCounts[block];
+	size_t index = low;
+	for( ; index < high; index++)
+	{
+		if(index == 0 || JNodeCompareKeyInline(build->source[index - 1], build->source[index], build->type) != 0) build->target[position++] = build->source[index];
+	}
+}
+
+/**
+ * @fn static void JRBTreeBuildSubtree(void *argument, size_t task)
+ * @brief 위쪽 단계에서 남겨둔 서브 트리 하나를 만드는 작업 함수
+ * @param argument 병렬 생성 작업 구조체의 주소(입력, 출력)
+ * @param task 서브 트리 번호(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeBuildSubtree(void *argument, size_t task)
+{
+	JRBTreeParallelBuildPtr build = (JRBTreeParallelBuildPtr)argument;
+	JRBTreeParallelSubtreePtr subtree = &(build->subtrees[task]);
+	_BuildNodes(build, subtree->low, subtree->high, build->subtreeDepth, subtree->parent, 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int _GetThreadCount(int threadCount)
+ * @brief 사용할 thread 개수를 반환하는 함수
+ * @param threadCount 요청한 thread 개수(입력, 0 이하면 온라인 CPU 개수)
+ * @return 1 이상 JRBTREE_PARALLEL_MAX_THREADS 이하의 thread 개수 반환
+ */
+static int _GetThreadCount(int threadCount)
+{
+	if(threadCount <= 0)
+	{
+		long onlineCount = sysconf(_SC_NPROCESSORS_ONLN);
+		if(onlineCount > JRBTREE_PARALLEL_MAX_THREADS) onlineCount = JRBTREE_PARALLEL_MAX_THREADS;
+		threadCount = (onlineCount > 0) ? (int)onlineCount : 1;
+	}
+	if(threadCount > JRBTREE_PARALLEL_MAX_THREADS) threadCount = JRBTREE_PARALLEL_MAX_THREADS;
+	return threadCount;
+}
+
+/**
+ * @fn static void _AppendBoundary(JRBTreeParallelJobPtr job, JNodePtr node)
+ * @brief 조각의 시작 노드를 추가하는 함수 (마지막 경계와 같은 노드면 추가하지 않음)
+ * @param job 작업 구조체, boundaries 는 충분히 할당되어 있어야 한다.(입력, 출력)
+ * @param node 추가할 노드, 키 순서로 추가해야 한다.(입력)
+ * @return 반환값 없음
+ */
+static void _AppendBoundary(JRBTreeParallelJobPtr job, JNodePtr node)
+{
+	if(job->chunkCount > 0 && job->boundaries[job->chunkCount - 1] == node) return;
+	job->boundaries[job->chunkCount++] = node;
+}
+
+/**
+ * @fn static void _CollectBoundaries(JRBTreeParallelJobPtr job, JNodePtr node, int depth)
+ * @brief RB Tree 서브 트리에서 지정한 깊이까지의 노드들을 중위 순서로 조각의 시작 노드로 추가하는 함수
+ * @param job 작업 구조체(입력, 출력)
+ * @param node 서브 트리의 루트 노드(입력, NULL 가능)
+ * @param depth 남은 깊이(입력, 최대 2^depth - 1 개 추가)
+ * @return 반환값 없음
+ */
+static void _CollectBoundaries(JRBTreeParallelJobPtr job, JNodePtr node, int depth)
+{
+	if(node == NULL || depth == 0) return;
+
+	_CollectBoundaries(job, node->left, depth - 1);
+	_AppendBoundary(job, node);
+	_CollectBoundaries(job, node->right, depth - 1);
+}
+
+/**
+ * @fn static void _CollectBPlusBoundaries(JRBTreeParallelJobPtr job, const JRBTreeBPlusNodePtr node, int depth)
+ * @brief B+ Tree 에서 지정한 깊이까지의 내부 노드의 분리 키 노드들을 키 순서로 조각의 시작 노드로 추가하는 함수
+ * 내부 노드의 nodes[i] 는 children[i + 1] 서브 트리의 가장 작은 노드이므로 그대로 조각의 시작 노드가 된다.
+ * @param job 작업 구조체(입력, 출력)
+ * @param node B+ Tree 노드(입력, 읽기 전용, NULL 가능)
+ * @param depth 남은 깊이(입력)
+ * @return 반환값 없음
+ */
+static void _CollectBPlusBoundaries(JRBTreeParallelJobPtr job, const JRBTreeBPlusNodePtr node, int depth)
+{
+	if(node == NULL || node->leaf == 1 || depth == 0) return;
+
+	int index = 0;
+	for( ; index <= node->count; index++)
+	{
+		_CollectBPlusBoundaries(job, node->children[index], depth - 1);
+		if(index < node->count) _AppendBoundary(job, node->nodes[index]);
+	}
+}
+
+/**
+ * @fn static int _TakeOwnChunk(JRBTreeParallelWorkerPtr worker, size_t *chunk)
+ * @brief worker 자기 범위의 앞에서 조각 하나를 가져오는 함수
+ * @param worker worker 구조체(입력, 출력)
+ * @param chunk 가져온 조각 번호(출력)
+ * @return 가져왔으면 1, 범위가 비었으면 0 반환
+ */
+static int _TakeOwnChunk(JRBTreeParallelWorkerPtr worker, size_t *chunk)
+{
+	unsigned long long range = __atomic_load_n(&(worker->range), __ATOMIC_ACQUIRE);
+	while(1)
+	{
+		unsigned long long begin = range >> 32;
+		unsigned long long end = range & 0xFFFFFFFFULL;
+		if(begin >= end) return 0;
+
+		if(__atomic_compare_exchange_n(&(worker->range), &range, ((begin + 1) << 32) | end, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+		{
+			*chunk = (size_t)begin;
+			return 1;
+		}
+	}
+}
+
+/**
+ * @fn static int _StealChunk(JRBTreeParallelWorkerPtr worker, size_t *chunk)
+ * @brief 다른 worker 범위의 뒤에서 조각 하나를 가져오는 함수 (다음 번호의 worker 부터 차례로 확인)
+ * @param worker 가져가는 worker 구조체(입력, 읽기 전용)
+ * @param chunk 가져온 조각 번호(출력)
+ * @return 가져왔으면 1, 모든 worker 의 범위가 비었으면 0 반환
+ */
+static int _StealChunk(JRBTreeParallelWorkerPtr worker, size_t *chunk)
+{
+	JRBTreeParallelJobPtr job = worker->job;
+	int offset = 1;
+	for( ; offset < job->workerCount; offset++)
+	{
+		JRBTreeParallelWorkerPtr victim = &(job->workers[(worker->index + offset) % job->workerCount]);
+		unsigned long long range = __atomic_load_n(&(victim->range), __ATOMIC_ACQUIRE);
+		while(1)
+		{
+			unsigned long long begin = range >> 32;
+			unsigned long long end = range & 0xFFFFFFFFULL;
+			if(begin >= end) break;
+
+			if(__atomic_compare_exchange_n(&(victim->range), &range, (begin << 32) | (end - 1), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			{
+				*chunk = (size_t)(end - 1);
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
+
+/**
+ * @fn static void _SortKeys(void **keys, void **buffer, size_t count, KeyType type)
+ * @brief 키 주소 배열을 키 값 순서로 안정 정렬하는 함수 (삽입 정렬한 블록들을 두 배열을 번갈아 사용하며 병합)
+ * @param keys 정렬할 키 주소 배열(입력, 출력)
+ * @param buffer 같은 크기의 임시 배열(출력)
+ * @param count 키 개수(입력)
+ * @param type 키 데이터 유형(입력)
+ * @return 반환값 없음
+ */
+static void _SortKeys(void **keys, void **buffer, size_t count, KeyType type)
+{
+	size_t blockLow = 0;
+	for( ; blockLow < count; blockLow += BUILD_INSERTION_SORT_SIZE)
+	{
+		size_t blockHigh = (blockLow + BUILD_INSERTION_SORT_SIZE < count) ? blockLow + BUILD_INSERTION_SORT_SIZE : count;
+		size_t index = blockLow + 1;
+		for( ; index < blockHigh; index++)
+		{
+			void *key = keys[index];
+			size_t position = index;
+			for( ; position > blockLow && JNodeCompareKeyInline(keys[position - 1], key, type) > 0; position--) keys[position] = keys[position - 1];
+			keys[position] = key;
+		}
+	}
+
+	void **source = keys;
+	void **target = buffer;
+	size_t width = BUILD_INSERTION_SORT_SIZE;
+	for( ; width < count; width *= 2)
+	{
+		size_t low = 0;
+		for( ; low < count; low += width * 2)
+		{
+			size_t middle = (low + width < count) ? low + width : count;
+			size_t high = (low + width * 2 < count) ? low + width * 2 : count;
+			_MergeKeys(source + low, middle - low, source + middle, high - middle, target + low, type);
+		}
+
+		void **sortedKeys = target;
+		target = source;
+		source = sortedKeys;
+	}
+
+	if(source != keys) memcpy(keys, source, sizeof(void*) * count);
+}
+
+/**
+ * @fn static void _MergeKeys(void **left, size_t leftCount, void **right, size_t rightCount, void **output, KeyType type)
+ * @brief 정렬된 두 키 주소 배열을 병합하는 함수 (값이 같으면 left 의 키가 먼저)
+ * @param left 앞 구간(입력)
+ * @param leftCount 앞 구간 키 개수(입력)
+ * @param right 뒤 구간(입력)
+ * @param rightCount 뒤 구간 키 개수(입력)
+ * @param output 병합 결과를 저장할 배열, 입력과 겹치면 안 된다.(출력)
+ * @param type 키 데이터 유형(입력)
+ * @return 반환값 없음
+ */
+static void _MergeKeys(void **left, size_t leftCount, void **right, size_t rightCount, void **output, KeyType type)
+{
+	size_t leftIndex = 0;
+	size_t rightIndex = 0;
+	while(leftIndex < leftCount && rightIndex < rightCount)
+	{
+		if(JNodeCompareKeyInline(left[leftIndex], right[rightIndex], type) <= 0) *output++ = left[leftIndex++];
+		else *output++ = right[rightIndex++];
+	}
+	if(leftIndex < leftCount) memcpy(output, left + leftIndex, sizeof(void*) * (leftCount - leftIndex));
+	if(rightIndex < rightCount) memcpy(output, right + rightIndex, sizeof(void*) * (rightCount - rightIndex));
+}
+
+/**
+ * @fn static size_t _SplitMerge(void **left, size_t leftCount, void **right, size_t rightCount, size_t diagonal, KeyType type)
+ * @brief 두 구간을 병합한 결과의 앞 diagonal 개 중 left 에서 온 키 개수를 이진 검색으로 찾는 함수 (_MergeKeys 와 같은 순서)
+ * @param left 앞 구간(입력)
+ * @param leftCount 앞 구간 키 개수(입력)
+ * @param right 뒤 구간(입력)
+ * @param rightCount 뒤 구간 키 개수(입력)
+ * @param diagonal 병합 결과의 위치(입력, leftCount + rightCount 이하)
+ * @param type 키 데이터 유형(입력)
+ * @return left 에서 온 키 개수 반환
+ */
+static size_t _SplitMerge(void **left, size_t leftCount, void **right, size_t rightCount, size_t diagonal, KeyType type)
+{
+	size_t low = (diagonal > rightCount) ? diagonal - rightCount : 0;
+	size_t high = (diagonal < leftCount) ? diagonal : leftCount;
+
+	// left[i] 가 right[diagonal - i - 1] 이하이면 left[i] 도 앞 diagonal 개에 포함된다.
+	while(low < high)
+	{
+		size_t middle = low + (high - low) / 2;
+		if(JNodeCompareKeyInline(left[middle], right[diagonal - middle - 1], type) <= 0) low = middle + 1;
+		else high = middle;
+	}
+	return low;
+}
+
+/**
+ * @fn static JNodePtr _BuildNodes(JRBTreeParallelBuildPtr build, size_t low, size_t high, int depth, JNodePtr parent, int isTop)
+ * @brief 정렬된 키 구간 [low, high) 의 가운데 키를 루트로 하는 서브 트리를 노드 영역에 만드는 함수
+ * 키 i 의 노드는 항상 nodes[i] 이므로 자식 서브 트리를 만들기 전에도 자식 노드의 주소를 알 수 있다.
+ * isTop 이면 subtreeDepth 깊이의 서브 트리는 만들지 않고 subtrees 에 추가해서 병렬로 만들게 한다.
+ * @param build 병렬 생성 작업 구조체(입력, 출력)
+ * @param low 구간 시작 위치(입력)
+ * @param high 구간 끝 위치, 포함하지 않음(입력)
+ * @param depth 서브 트리 루트 노드의 깊이(입력)
+ * @param parent 서브 트리 루트 노드의 부모 노드(입력, 루트면 NULL)
+ * @param isTop 위쪽 단계만 만드는지 여부(입력)
+ * @return 서브 트리 루트 노드의 주소 반환, 빈 구간이면 NULL 반환
+ */
+static JNodePtr _BuildNodes(JRBTreeParallelBuildPtr build, size_t low, size_t high, int depth, JNodePtr parent, int isTop)
+{
+	if(low >= high) return NULL;
+
+	size_t middle = low + (high - low) / 2;
+	JNodePtr node = &(build->nodes[middle]);
+	if(isTop == 1 && depth == build->subtreeDepth)
+	{
+		JRBTreeParallelSubtreePtr subtree = &(build->subtrees[build->subtreeCount++]);
+		subtree->low = low;
+		subtree->high = high;
+		subtree->parent = parent;
+		return node;
+	}
+
+	node->key = build->target[middle];
+	node->color = (depth == build->redDepth) ? Red : Black;
+	node->parent = parent;
+	node->left = _BuildNodes(build, low, middle, depth + 1, node, isTop);
+	node->right = _BuildNodes(build, middle + 1, high, depth + 1, node, isTop);
+	return node;
+}
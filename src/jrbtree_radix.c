@@ -0,0 +1,243 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/jrbtree.h"
+#include "jrbtree_internal.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JRBTree
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JRBTreePtr NewJRBTreeRadix(int minKey, int maxKey, unsigned int bits)
+ * @brief 정수 키의 상위 bit 로 고른 2^bits 개의 칸마다 RB Tree 서브 트리를 두는 RB Tree 구조체 객체를 생성하는 함수 (IntType)
+ * [minKey, maxKey] 범위를 2^bits 개의 같은 크기 구간으로 나누고, 검색할 때 키 값으로 칸을 바로 계산해서
+ * 그 칸의 서브 트리만 내려가므로 트리 위쪽의 약 bits 단계(캐시 미스)를 건너뛴다.
+ * 키가 범위 안에 고르게(조밀하게) 분포할 때 효과가 크며, 범위 밖의 키도 처음이나 마지막 칸에 저장되므로 결과는 같다.
+ * JNodeGetNext, JNodeGetPrevious 와 범위 검색은 칸을 넘어서 키 순서로 동작한다. (빈 칸은 건너뛰므로 칸 개수가 키 개수보다 많으면 느려진다)
+ * 같은 키 주소는 다시 추가할 수 없으며(NewJRBTree 와 같음), JRBTreeDump, JRBTreePrintAll 은 아무 노드도 출력하지 않는다.
+ * @param minKey 저장할 키의 최소 값(입력)
+ * @param maxKey 저장할 키의 최대 값(입력, minKey 이상)
+ * @param bits 칸 개수의 bit 수(입력, 1 ~ JRBTREE_RADIX_MAX_BITS, 칸 하나에 sizeof(JNode) bytes 사용)
+ * @return 성공 시 생성된 RB Tree 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JRBTreePtr NewJRBTreeRadix(int minKey, int maxKey, unsigned int bits)
+{
+	if(minKey > maxKey || bits < 1 || bits > JRBTREE_RADIX_MAX_BITS) return NULL;
+
+	JRBTreePtr newTree = NewJRBTree(IntType);
+	if(newTree == NULL) return NULL;
+
+	newTree->radix = NewJRBTreeRadixTable(minKey, maxKey, bits);
+	if(newTree->radix == NULL)
+	{
+		DeleteJRBTree(&newTree);
+		return NULL;
+	}
+	return newTree;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JRBTreeRadix
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JRBTreeRadixPtr NewJRBTreeRadixTable(int minKey, int maxKey, unsigned int bits)
+ * @brief 모든 칸이 비어 있는 새로운 radix 표 구조체 객체를 생성하는 함수
+ * 칸 하나가 담당하는 구간은 (maxKey - minKey) >> shift 가 2^bits 미만이 되는 가장 작은 2^shift 이다.
+ * @param minKey 첫 번째 칸의 최소 키 값(입력)
+ * @param maxKey 마지막 칸에 들어가는 키 값(입력, minKey 이상)
+ * @param bits 칸 개수의 bit 수(입력)
+ * @return 성공 시 생성된 radix 표 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JRBTreeRadixPtr NewJRBTreeRadixTable(int minKey, int maxKey, unsigned int bits)
+{
+	size_t slotCount = (size_t)1 << bits;
+	JRBTreeRadixPtr newRadix = (JRBTreeRadixPtr)calloc(1, sizeof(JRBTreeRadix) + slotCount * sizeof(JNode));
+	if(newRadix == NULL)
+	{
+		return NULL;
+	}
+
+	long long range = (long long)maxKey - (long long)minKey;
+	unsigned int shift = 0;
+	while((range >> shift) >= (long long)slotCount) shift++;
+
+	newRadix->base = minKey;
+	newRadix->shift = shift;
+	newRadix->slotCount = slotCount;
+
+	size_t slotIndex = 0;
+	for( ; slotIndex < slotCount; slotIndex++)
+	{
+		JNodePtr header = &(newRadix->headers[slotIndex]);
+		header->color = JRBTREE_SLOT_COLOR;
+		header->left = (slotIndex > 0) ? header - 1 : NULL;
+		header->right = (slotIndex + 1 < slotCount) ? header + 1 : NULL;
+	}
+	return newRadix;
+}
+
+/**
+ * @fn DeleteResult DeleteJRBTreeRadixTable(JRBTreeRadixPtrContainer container)
+ * @brief radix 표 구조체 객체를 삭제하는 함수 (칸의 노드는 해제하지 않음, JRBTreeRadixReleaseNodes 참고)
+ * @param container radix 표 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJRBTreeRadixTable(JRBTreeRadixPtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	free(*container);
+	*container = NULL;
+	return DeleteSuccess;
+}
+
+/**
+ * @fn JNodePtr JRBTreeRadixGetHeader(const JRBTreeRadixPtr radix, const void *key)
+ * @brief 키 값이 들어갈 칸의 헤더 노드를 반환하는 함수 (범위 밖이면 처음이나 마지막 칸)
+ * 칸 번호는 키 값에 대해 단조 증가하므로 칸 순서가 키 순서와 같다.
+ * 매개변수 NULL 체크를 수행하지 않음
+ * @param radix radix 표 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 키의 주소(입력, 읽기 전용)
+ * @return 항상 헤더 노드의 주소 반환
+ */
+JNodePtr JRBTreeRadixGetHeader(const JRBTreeRadixPtr radix, const void *key)
+{
+	long long offset = (long long)*((const int*)key) - radix->base;
+	if(offset < 0) return &(radix->headers[0]);
+
+	unsigned long long slotIndex = (unsigned long long)offset >> radix->shift;
+	if(slotIndex >= radix->slotCount) return &(radix->headers[radix->slotCount - 1]);
+	return &(radix->headers[slotIndex]);
+}
+
+/**
+ * @fn void JRBTreeRadixDetach(JRBTreePtr tree, JNodePtr header)
+ * @brief 칸의 서브 트리를 tree->root 로 옮겨서 일반 RB Tree 추가/삭제 함수를 그대로 사용할 수 있게 하는 함수
+ * 서브 트리 루트 노드의 부모 노드를 NULL 로 바꾸므로, JRBTreeRadixAttach 를 호출하기 전까지 이 칸은 칸을 넘어서 순회할 수 없다.
+ * @param tree RB Tree 구조체 객체의 주소(출력, root 는 NULL 이어야 한다)
+ * @param header 칸의 헤더 노드(입력)
+ * @return 반환값 없음
+ */
+void JRBTreeRadixDetach(JRBTreePtr tree, JNodePtr header)
+{
+	tree->root = (JNodePtr)header->key;
+	if(tree->root != NULL) tree->root->parent = NULL;
+}
+
+/**
+ * @fn void JRBTreeRadixAttach(JRBTreePtr tree, JNodePtr header)
+ * @brief JRBTreeRadixDetach 로 옮긴 서브 트리(추가/삭제로 루트 노드가 바뀌었을 수 있음)를 다시 칸에 연결하는 함수
+ * @param tree RB Tree 구조체 객체의 주소(출력, root 는 NULL 로 돌아간다)
+ * @param header 칸의 헤더 노드(출력)
+ * @return 반환값 없음
+ */
+void JRBTreeRadixAttach(JRBTreePtr tree, JNodePtr header)
+{
+	header->key = tree->root;
+	if(tree->root != NULL) tree->root->parent = header;
+	tree->root = NULL;
+}
+
+/**
+ * @fn JNodePtr JRBTreeRadixGetNext(const JNodePtr header)
+ * @brief 지정한 칸 다음의 비어 있지 않은 칸에서 가장 작은 노드를 반환하는 함수 (JNodeGetNext 에서 호출)
+ * @param header 칸의 헤더 노드(입력, 읽기 전용)
+ * @return 성공 시 노드의 주소, 다음 칸들이 모두 비어 있으면 NULL 반환
+ */
+JNodePtr JRBTreeRadixGetNext(const JNodePtr header)
+{
+	JNodePtr currentHeader = header->right;
+	for( ; currentHeader != NULL; currentHeader = currentHeader->right)
+	{
+		if(currentHeader->key != NULL) return JNodeGetLeftmost((JNodePtr)currentHeader->key);
+	}
+	return NULL;
+}
+
+/**
+ * @fn JNodePtr JRBTreeRadixGetPrevious(const JNodePtr header)
+ * @brief 지정한 칸 이전의 비어 있지 않은 칸에서 가장 큰 노드를 반환하는 함수 (JNodeGetPrevious 에서 호출)
+ * @param header 칸의 헤더 노드(입력, 읽기 전용)
+ * @return 성공 시 노드의 주소, 이전 칸들이 모두 비어 있으면 NULL 반환
+ */
+JNodePtr JRBTreeRadixGetPrevious(const JNodePtr header)
+{
+	JNodePtr currentHeader = header->left;
+	for( ; currentHeader != NULL; currentHeader = currentHeader->left)
+	{
+		if(currentHeader->key != NULL) return JNodeGetRightmost((JNodePtr)currentHeader->key);
+	}
+	return NULL;
+}
+
+/**
+ * @fn JNodePtr JRBTreeRadixBound(const JRBTreePtr tree, void *key, int upper)
+ * @brief radix 표에서 지정한 키의 값 이상(upper 이면 초과)인 첫 번째 노드를 검색하는 함수
+ * 키가 들어갈 칸의 서브 트리에 없으면 다음 칸들의 가장 작은 노드가 결과이다.
+ * 매개변수 NULL 체크를 수행하지 않음 (tree->radix 가 NULL 이 아니어야 한다)
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키의 주소(입력)
+ * @param upper 0 이면 lower bound, 아니면 upper bound(입력)
+ * @return 성공 시 노드의 주소, 없으면 NULL 반환
+ */
+JNodePtr JRBTreeRadixBound(const JRBTreePtr tree, void *key, int upper)
+{
+	JNodePtr header = JRBTreeRadixGetHeader(tree->radix, key);
+	int value = *((int*)key);
+
+	JNodePtr resultNode = NULL;
+	JNodePtr currentNode = (JNodePtr)header->key;
+	int moveCount = 0;
+	while(currentNode != NULL)
+	{
+		int currentValue = *((int*)currentNode->key);
+		if(currentValue > value || (upper == 0 && currentValue == value))
+		{
+			resultNode = currentNode;
+			currentNode = currentNode->left;
+		}
+		else currentNode = currentNode->right;
+		moveCount++;
+	}
+
+	JRBTREE_STAT_ADD(tree, comparisons, moveCount);
+	if(resultNode != NULL) return resultNode;
+	return JRBTreeRadixGetNext(header);
+}
+
+/**
+ * @fn size_t JRBTreeRadixReleaseNodes(JRBTreePtr tree)
+ * @brief radix 표의 모든 칸의 노드를 해제하고 칸을 비우는 함수
+ * 키 소멸자가 지정되어 있으면 같은 순회에서 키도 해제한다.
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @return 해제한 노드 개수 반환
+ */
+size_t JRBTreeRadixReleaseNodes(JRBTreePtr tree)
+{
+	size_t count = 0;
+	size_t slotIndex = 0;
+	for( ; slotIndex < tree->radix->slotCount; slotIndex++)
+	{
+		JNodePtr header = &(tree->radix->headers[slotIndex]);
+		if(header->key == NULL) continue;
+
+		count += JRBTreeReleaseNodes(tree, (JNodePtr)header->key);
+		header->key = NULL;
+	}
+	return count;
+}
+
+/**
+ * @fn size_t JRBTreeRadixGetBytes(const JRBTreeRadixPtr radix)
+ * @brief radix 표가 할당한 메모리 크기를 반환하는 함수 (노드 제외)
+ * @param radix radix 표 구조체 객체의 주소(입력, 읽기 전용, NULL 가능)
+ * @return 할당한 메모리 크기 반환 (NULL 이면 0)
+ */
+size_t JRBTreeRadixGetBytes(const JRBTreeRadixPtr radix)
+{
+	if(radix == NULL) return 0;
+	return sizeof(JRBTreeRadix) + radix->slotCount * sizeof(JNode);
+}
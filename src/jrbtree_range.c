@@ -0,0 +1,335 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/jrbtree.h"
+#include "../include/jrbtree_inline.h"
+#include "jrbtree_internal.h"
+
+// 분할/병합 중인 서브 트리 구조체
+// 루트 노드는 항상 Black 이고 부모 노드가 없다.
+typedef struct _jrbtree_part_t {
+	// 루트 노드 (비어 있으면 NULL)
+	JNodePtr root;
+	// 루트 노드에서 외부 노드까지의 Black 노드 개수 (비어 있으면 0)
+	int blackHeight;
+} JRBTreePart, *JRBTreePartPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Range Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static void JRBTreeSplit(JRBTreePtr tree, JRBTreePartPtr part, void *key, JRBTreePartPtr left, JRBTreePartPtr right);
+static void JRBTreeJoin(JRBTreePtr tree, JRBTreePartPtr left, JNodePtr middleNode, JRBTreePartPtr right, JRBTreePartPtr result);
+static void JRBTreeJoin2(JRBTreePtr tree, JRBTreePartPtr left, JRBTreePartPtr right, JRBTreePartPtr result);
+static void JRBTreeSetPart(JRBTreePtr tree, JRBTreePartPtr part, size_t removedCount);
+static size_t JRBTreeDeleteEach(JRBTreePtr tree, JNodePtr fromNode, const JNodePtr toNode);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static void _MakePart(JRBTreePartPtr part, JNodePtr root, int blackHeight);
+static int _GetBlackHeight(const JNodePtr root);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for Range
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn size_t JRBTreeDeleteRange(JRBTreePtr tree, void *lo, void *hi)
+ * @brief RB Tree 에서 키의 값이 lo 이상 hi 미만인 노드들을 모두 삭제하는 함수
+ * 트리를 [~, lo), [lo, hi), [hi, ~) 세 개로 분할한 후 양쪽을 다시 병합하고, 가운데 서브 트리는 한 번에 해제한다.
+ * 노드마다 검색과 복구를 반복하지 않으므로 k 개를 삭제할 때 O(log n + k) 이다.
+ * 키 주소가 아니라 값으로 비교하며, 키 소멸자가 지정되어 있으면 삭제된 노드의 키도 해제한다.
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param lo 삭제할 범위의 시작 키 주소, 포함(입력)
+ * @param hi 삭제할 범위의 끝 키 주소, 포함하지 않음(입력)
+ * @return 삭제한 노드 개수 반환, 실패 시 0 반환
+ */
+size_t JRBTreeDeleteRange(JRBTreePtr tree, void *lo, void *hi)
+{
+	if(tree == NULL || lo == NULL || hi == NULL) return 0;
+	if(JNodeCompareKeyInline(lo, hi, tree->type) >= 0) return 0;
+	if(tree->bplus != NULL || tree->radix != NULL || tree->aggregateCombine != NULL) return JRBTreeDeleteEach(tree, JRBTreeLowerBound(tree, lo), JRBTreeLowerBound(tree, hi));
+	if(tree->root == NULL) return 0;
+
+	JRBTreePart whole;
+	JRBTreePart lowerPart;
+	JRBTreePart upperPart;
+	JRBTreePart middlePart;
+	JRBTreePart result;
+
+	_MakePart(&whole, tree->root, _GetBlackHeight(tree->root));
+	JRBTreeSplit(tree, &whole, lo, &lowerPart, &upperPart);
+	JRBTreeSplit(tree, &upperPart, hi, &middlePart, &upperPart);
+	JRBTreeJoin2(tree, &lowerPart, &upperPart, &result);
+
+	size_t removedCount = JRBTreeReleaseNodes(tree, middlePart.root);
+	JRBTreeSetPart(tree, &result, removedCount);
+	return removedCount;
+}
+
+/**
+ * @fn size_t JRBTreeTruncateBelow(JRBTreePtr tree, void *key)
+ * @brief RB Tree 에서 키의 값이 지정한 키보다 작은 노드들을 모두 삭제하는 함수 (예: 기준 시간 이전 데이터 삭제)
+ * 트리를 한 번 분할하고 작은 쪽을 한 번에 해제하므로 k 개를 삭제할 때 O(log n + k) 이다.
+ * 키 주소가 아니라 값으로 비교하며, 키 소멸자가 지정되어 있으면 삭제된 노드의 키도 해제한다.
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param key 기준 키 주소, 이 키의 값 이상인 노드는 남는다.(입력)
+ * @return 삭제한 노드 개수 반환, 실패 시 0 반환
+ */
+size_t JRBTreeTruncateBelow(JRBTreePtr tree, void *key)
+{
+	if(tree == NULL || key == NULL) return 0;
+	if(tree->bplus != NULL || tree->radix != NULL || tree->aggregateCombine != NULL) return JRBTreeDeleteEach(tree, tree->leftmost, JRBTreeLowerBound(tree, key));
+	if(tree->root == NULL) return 0;
+
+	// 모두 기준 이상이면 분할할 필요가 없다.
+	if(JNodeCompareKeyInline(tree->leftmost->key, key, tree->type) >= 0) return 0;
+
+	JRBTreePart whole;
+	JRBTreePart lowerPart;
+	JRBTreePart upperPart;
+
+	_MakePart(&whole, tree->root, _GetBlackHeight(tree->root));
+	JRBTreeSplit(tree, &whole, key, &lowerPart, &upperPart);
+
+	size_t removedCount = JRBTreeReleaseNodes(tree, lowerPart.root);
+	JRBTreeSetPart(tree, &upperPart, removedCount);
+	return removedCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Range Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void JRBTreeSplit(JRBTreePtr tree, JRBTreePartPtr part, void *key, JRBTreePartPtr left, JRBTreePartPtr right)
+ * @brief 서브 트리를 지정한 키의 값보다 작은 노드들과 크거나 같은 노드들로 분할하는 함수 (O(log n))
+ * 검색 경로의 노드를 하나씩 떼어내서 반대쪽 서브 트리와 병합할 때 가운데 노드로 다시 사용하므로 메모리를 할당하지 않는다.
+ * 재귀 깊이는 트리 높이(O(log n))를 넘지 않는다.
+ * @param tree 키 유형과 회전에 사용할 RB Tree 구조체 객체의 주소(입력, 출력)
+ * @param part 분할할 서브 트리(입력)
+ * @param key 기준 키 주소(입력)
+ * @param left 기준보다 작은 노드들의 서브 트리(출력)
+ * @param right 기준 이상인 노드들의 서브 트리(출력, part 와 같아도 된다)
+ * @return 반환값 없음
+ */
+static void JRBTreeSplit(JRBTreePtr tree, JRBTreePartPtr part, void *key, JRBTreePartPtr left, JRBTreePartPtr right)
+{
+	JNodePtr node = part->root;
+	if(node == NULL)
+	{
+		_MakePart(left, NULL, 0);
+		_MakePart(right, NULL, 0);
+		return;
+	}
+
+	// 자식 서브 트리를 떼어낸다. (루트 노드가 Red 이면 Black 으로 바뀌면서 Black height 가 1 증가)
+	int childBlackHeight = part->blackHeight - ((node->color == Black) ? 1 : 0);
+	JRBTreePart leftChild;
+	JRBTreePart rightChild;
+	_MakePart(&leftChild, node->left, childBlackHeight);
+	_MakePart(&rightChild, node->right, childBlackHeight);
+
+	JRBTreePart subPart;
+	if(JNodeCompareKeyInline(node->key, key, tree->type) >= 0)
+	{
+		// 기준 이상인 노드는 오른쪽 서브 트리와 함께 right 로 간다.
+		JRBTreeSplit(tree, &leftChild, key, left, &subPart);
+		JRBTreeJoin(tree, &subPart, node, &rightChild, right);
+	}
+	else
+	{
+		JRBTreeSplit(tree, &rightChild, key, &subPart, right);
+		JRBTreeJoin(tree, &leftChild, node, &subPart, left);
+	}
+}
+
+/**
+ * @fn static void JRBTreeJoin(JRBTreePtr tree, JRBTreePartPtr left, JNodePtr middleNode, JRBTreePartPtr right, JRBTreePartPtr result)
+ * @brief left < middleNode <= right 인 두 서브 트리와 노드 하나를 병합하는 함수 (O(Black height 차이))
+ * Black height 가 큰 쪽의 안쪽 경계를 따라 내려가서 같은 Black height 의 Black 노드 자리에 middleNode 를 Red 로 끼워 넣고,
+ * 노드를 추가할 때와 같은 방법으로 Double Red 를 복구한다.
+ * @param tree 키 유형과 회전에 사용할 RB Tree 구조체 객체의 주소(입력, 출력, root 는 임시로 사용)
+ * @param left 왼쪽 서브 트리(입력)
+ * @param middleNode 가운데 노드(입력)
+ * @param right 오른쪽 서브 트리(입력)
+ * @param result 병합된 서브 트리(출력, left 또는 right 와 같아도 된다)
+ * @return 반환값 없음
+ */
+static void JRBTreeJoin(JRBTreePtr tree, JRBTreePartPtr left, JNodePtr middleNode, JRBTreePartPtr right, JRBTreePartPtr result)
+{
+	middleNode->parent = NULL;
+
+	// Black height 가 같으면 middleNode 를 새로운 루트 노드로 만든다.
+	if(left->blackHeight == right->blackHeight)
+	{
+		middleNode->left = left->root;
+		middleNode->right = right->root;
+		if(left->root != NULL) left->root->parent = middleNode;
+		if(right->root != NULL) right->root->parent = middleNode;
+		middleNode->color = Black;
+		_MakePart(result, middleNode, left->blackHeight + 1);
+		return;
+	}
+
+	int joinLeft = (left->blackHeight > right->blackHeight);
+	JRBTreePartPtr tallPart = joinLeft ? left : right;
+	JRBTreePartPtr shortPart = joinLeft ? right : left;
+
+	// 큰 쪽의 안쪽 경계(왼쪽 트리면 오른쪽 끝, 오른쪽 트리면 왼쪽 끝)에서 Black height 가 같은 Black 노드를 찾는다.
+	JNodePtr parentNode = NULL;
+	JNodePtr currentNode = tallPart->root;
+	int currentBlackHeight = tallPart->blackHeight;
+	while((currentNode != NULL) && ((currentNode->color == Red) || (currentBlackHeight > shortPart->blackHeight)))
+	{
+		if(currentNode->color == Black) currentBlackHeight--;
+		parentNode = currentNode;
+		currentNode = joinLeft ? currentNode->right : currentNode->left;
+	}
+
+	// 찾은 노드 자리에 middleNode 를 끼워 넣는다.
+	middleNode->color = Red;
+	middleNode->parent = parentNode;
+	if(joinLeft)
+	{
+		middleNode->left = currentNode;
+		middleNode->right = shortPart->root;
+		parentNode->right = middleNode;
+	}
+	else
+	{
+		middleNode->left = shortPart->root;
+		middleNode->right = currentNode;
+		parentNode->left = middleNode;
+	}
+	if(currentNode != NULL) currentNode->parent = middleNode;
+	if(shortPart->root != NULL) shortPart->root->parent = middleNode;
+
+	tree->root = tallPart->root;
+	int blackHeight = tallPart->blackHeight + JRBTreeInsertFixup(tree, middleNode);
+	_MakePart(result, tree->root, blackHeight);
+}
+
+/**
+ * @fn static void JRBTreeJoin2(JRBTreePtr tree, JRBTreePartPtr left, JRBTreePartPtr right, JRBTreePartPtr result)
+ * @brief left < right 인 두 서브 트리를 병합하는 함수 (O(log n))
+ * 오른쪽 서브 트리의 최소 노드를 떼어내서 가운데 노드로 사용한다.
+ * @param tree 키 유형과 회전에 사용할 RB Tree 구조체 객체의 주소(입력, 출력, root 는 임시로 사용)
+ * @param left 왼쪽 서브 트리(입력)
+ * @param right 오른쪽 서브 트리(입력)
+ * @param result 병합된 서브 트리(출력)
+ * @return 반환값 없음
+ */
+static void JRBTreeJoin2(JRBTreePtr tree, JRBTreePartPtr left, JRBTreePartPtr right, JRBTreePartPtr result)
+{
+	if(right->root == NULL)
+	{
+		*result = *left;
+		return;
+	}
+	if(left->root == NULL)
+	{
+		*result = *right;
+		return;
+	}
+
+	JNodePtr middleNode = JNodeGetLeftmost(right->root);
+	tree->root = right->root;
+	JRBTreeUnlinkNode(tree, middleNode);
+
+	JRBTreePart restPart;
+	_MakePart(&restPart, tree->root, _GetBlackHeight(tree->root));
+	JRBTreeJoin(tree, left, middleNode, &restPart, result);
+}
+
+/**
+ * @fn static void JRBTreeSetPart(JRBTreePtr tree, JRBTreePartPtr part, size_t removedCount)
+ * @brief 분할/병합이 끝난 서브 트리를 RB Tree 에 다시 설정하는 함수
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param part 설정할 서브 트리(입력)
+ * @param removedCount 삭제한 노드 개수(입력)
+ * @return 반환값 없음
+ */
+static void JRBTreeSetPart(JRBTreePtr tree, JRBTreePartPtr part, size_t removedCount)
+{
+	tree->root = part->root;
+	tree->leftmost = JNodeGetLeftmost(tree->root);
+	tree->rightmost = JNodeGetRightmost(tree->root);
+	tree->size -= removedCount;
+	JRBTREE_STAT_ADD(tree, deletes, removedCount);
+}
+
+/**
+ * @fn static size_t JRBTreeDeleteEach(JRBTreePtr tree, JNodePtr fromNode, const JNodePtr toNode)
+ * @brief 정렬 순서로 fromNode 부터 toNode 전까지의 노드들을 하나씩 삭제하는 함수 (B+ Tree 엔진용, O(k log n))
+ * B+ Tree 엔진은 RB Tree 분할/병합을 사용할 수 없으므로 노드마다 JRBTreeRemoveNode 로 삭제한다.
+ * 키 소멸자가 지정되어 있으면 삭제된 노드의 키도 해제한다.
+ * @param tree RB Tree 구조체 객체의 주소(출력)
+ * @param fromNode 삭제할 첫 번째 노드(입력, NULL 이면 삭제하지 않음)
+ * @param toNode 삭제하지 않을 첫 번째 노드(입력, 읽기 전용, NULL 이면 끝까지 삭제)
+ * @return 삭제한 노드 개수 반환
+ */
+static size_t JRBTreeDeleteEach(JRBTreePtr tree, JNodePtr fromNode, const JNodePtr toNode)
+{
+	size_t removedCount = 0;
+	JNodePtr currentNode = fromNode;
+	while(currentNode != NULL && currentNode != toNode)
+	{
+		JNodePtr nextNode = JNodeGetNext(currentNode);
+		JRBTreeRemoveNode(tree, currentNode);
+		if(tree->keyDestructor != NULL) tree->keyDestructor(currentNode->key);
+		JRBTreeFreeNode(tree, currentNode);
+		currentNode = nextNode;
+		removedCount++;
+	}
+	return removedCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void _MakePart(JRBTreePartPtr part, JNodePtr root, int blackHeight)
+ * @brief 서브 트리 구조체를 설정하는 함수
+ * 루트 노드의 부모 노드 연결을 끊고, Red 이면 Black 으로 바꾸고 Black height 를 1 증가시킨다.
+ * @param part 설정할 서브 트리 구조체 객체의 주소(출력)
+ * @param root 루트 노드(입력)
+ * @param blackHeight 루트 노드의 Black height(입력)
+ * @return 반환값 없음
+ */
+static void _MakePart(JRBTreePartPtr part, JNodePtr root, int blackHeight)
+{
+	if(root != NULL)
+	{
+		root->parent = NULL;
+		if(root->color == Red)
+		{
+			root->color = Black;
+			blackHeight++;
+		}
+	}
+
+	part->root = root;
+	part->blackHeight = blackHeight;
+}
+
+/**
+ * @fn static int _GetBlackHeight(const JNodePtr root)
+ * @brief 서브 트리의 Black height 를 계산하는 함수 (가장 왼쪽 경로만 센다.)
+ * @param root 서브 트리의 루트 노드(입력, 읽기 전용)
+ * @return 항상 Black height 반환 (비어 있으면 0)
+ */
+static int _GetBlackHeight(const JNodePtr root)
+{
+	int blackHeight = 0;
+	JNodePtr currentNode = root;
+	for( ; currentNode != NULL; currentNode = currentNode->left)
+	{
+		if(currentNode->color == Black) blackHeight++;
+	}
+	return blackHeight;
+}
@@ -0,0 +1,512 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../include/jrbtree.h"
+#include "jrbtree_internal.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions of Snapshot Format
+///
+/// [헤더 64 bytes][키 영역][문자열 영역(StringType)]
+/// - 모든 위치는 파일 시작(헤더)을 기준으로 한 오프셋이므로 어느 주소에 매핑해도 그대로 사용할 수 있다.
+/// - 키 영역은 중위 순회 순서(정렬 순서)로 저장된다.
+///   IntType 은 int32, CharType 은 char 값을 그대로 저장하고,
+///   StringType 은 문자열 영역 안의 오프셋(uint64)을 저장한다.
+/// - 문자열 영역은 널 문자로 끝나는 문자열을 빈틈없이 이어 붙인 영역이다.
+/// - 바이트 순서는 저장한 호스트를 따르며, 다른 바이트 순서의 파일은 읽지 않는다.
+////////////////////////////////////////////////////////////////////////////////
+
+// 파일 식별자
+#define SNAPSHOT_MAGIC "JRBTSNP"
+// 파일 형식 버전
+#define SNAPSHOT_VERSION 1
+// 바이트 순서 확인용 값
+#define SNAPSHOT_BYTE_ORDER 0x01020304u
+// 영역 정렬 단위
+#define SNAPSHOT_ALIGNMENT 8
+// 저장 시 한 번에 write 하는 크기
+#define SNAPSHOT_BUFFER_SIZE (64 * 1024)
+
+// 스냅샷 파일 헤더 구조체 (64 bytes)
+typedef struct _jrbtree_snapshot_header_t {
+	// 파일 식별자 (SNAPSHOT_MAGIC)
+	char magic[8];
+	// 파일 형식 버전
+	uint32_t version;
+	// 바이트 순서 확인용 값
+	uint32_t byteOrder;
+	// 키 데이터 유형 (KeyType 열거형 참고)
+	int32_t keyType;
+	// 키 영역에서 키 하나의 크기
+	uint32_t keySize;
+	// 키 개수
+	uint64_t count;
+	// 키 영역 시작 오프셋
+	uint64_t keyOffset;
+	// 문자열 영역 시작 오프셋
+	uint64_t heapOffset;
+	// 문자열 영역 크기
+	uint64_t heapSize;
+	// 키 영역과 문자열 영역의 CRC32
+	uint32_t payloadChecksum;
+	// headerChecksum 을 0 으로 두고 계산한 헤더의 CRC32
+	uint32_t headerChecksum;
+} JRBTreeSnapshotHeader;
+
+// 저장 시 사용하는 버퍼 구조체
+typedef struct _jrbtree_snapshot_writer_t {
+	// 저장할 파일 디스크립터
+	int fd;
+	// 버퍼에 쌓인 크기
+	size_t length;
+	// 지금까지 기록한 데이터의 CRC32
+	uint32_t checksum;
+	// 버퍼
+	unsigned char buffer[SNAPSHOT_BUFFER_SIZE];
+} JRBTreeSnapshotWriter, *JRBTreeSnapshotWriterPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Snapshot Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int JRBTreeSnapshotWrite(JRBTreeSnapshotWriterPtr writer, const void *data, size_t size);
+static int JRBTreeSnapshotFlush(JRBTreeSnapshotWriterPtr writer);
+static int JRBTreeSnapshotPad(JRBTreeSnapshotWriterPtr writer, uint64_t *offset);
+static int JRBTreeMappedCompare(const JRBTreeMappedPtr mapped, size_t index, const void *key);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefinition of Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static uint32_t _UpdateCRC32(uint32_t crc, const void *data, size_t size);
+static int _WriteAll(int fd, const void *data, size_t size, off_t offset);
+static uint32_t _GetKeySize(KeyType type);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for Snapshot
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn SaveResult JRBTreeSave(const JRBTreePtr tree, int fd)
+ * @brief RB Tree 에 저장된 키들을 mmap 으로 바로 사용할 수 있는 스냅샷 형식으로 저장하는 함수
+ * 키를 정렬 순서로 64KB 단위로 기록한 뒤, 마지막에 체크섬이 들어간 헤더를 기록한다.
+ * 헤더를 나중에 기록하므로 fd 는 위치 이동이 가능한 일반 파일이어야 하고, 파일 시작 위치에서 저장해야 JRBTreeLoadMapped 로 읽을 수 있다.
+ * @param tree RB Tree 구조체 객체의 주소(입력, 읽기 전용)
+ * @param fd 저장할 파일 디스크립터(입력)
+ * @return 성공 시 SaveSuccess, 실패 시 SaveFail 반환(SaveResult 열거형 참고)
+ */
+SaveResult JRBTreeSave(const JRBTreePtr tree, int fd)
+{
+	if(tree == NULL || fd < 0) return SaveFail;
+
+	off_t startOffset = lseek(fd, 0, SEEK_CUR);
+	if(startOffset < 0) return SaveFail;
+
+	JRBTreeSnapshotWriterPtr writer = (JRBTreeSnapshotWriterPtr)malloc(sizeof(JRBTreeSnapshotWriter));
+	if(writer == NULL) return SaveFail;
+	writer->fd = fd;
+	writer->length = 0;
+	writer->checksum = 0;
+
+	JRBTreeSnapshotHeader header;
+	memset(&header, 0, sizeof(JRBTreeSnapshotHeader));
+	memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+	header.version = SNAPSHOT_VERSION;
+	header.byteOrder = SNAPSHOT_BYTE_ORDER;
+	header.keyType = (int32_t)tree->type;
+	header.keySize = _GetKeySize(tree->type);
+	header.keyOffset = sizeof(JRBTreeSnapshotHeader);
+
+	// 헤더 자리는 비워두고 키 영역부터 기록한다.
+	if(lseek(fd, startOffset + (off_t)header.keyOffset, SEEK_SET) < 0)
+	{
+		free(writer);
+		return SaveFail;
+	}
+
+	int result = 1;
+	JNodePtr currentNode = tree->leftmost;
+	for( ; (result == 1) && (currentNode != NULL); currentNode = JNodeGetNext(currentNode))
+	{
+		switch(tree->type)
+		{
+			case IntType:
+			{
+				int32_t key = (int32_t)(*((int*)(currentNode->key)));
+				result = JRBTreeSnapshotWrite(writer, &key, sizeof(int32_t));
+				break;
+			}
+			case CharType:
+				result = JRBTreeSnapshotWrite(writer, currentNode->key, sizeof(char));
+				break;
+			case StringType:
+			{
+				// 문자열 영역은 키 영역 다음에 같은 순서로 기록되므로 길이를 누적하면 오프셋이 된다.
+				uint64_t key = header.heapSize;
+				header.heapSize += strlen((char*)(currentNode->key)) + 1;
+				result = JRBTreeSnapshotWrite(writer, &key, sizeof(uint64_t));
+				break;
+			}
+			default:
+				result = -1;
+				break;
+		}
+		header.count++;
+	}
+
+	header.heapOffset = header.keyOffset + header.count * header.keySize;
+	if(result == 1) result = JRBTreeSnapshotPad(writer, &(header.heapOffset));
+
+	if(tree->type == StringType)
+	{
+		currentNode = tree->leftmost;
+		for( ; (result == 1) && (currentNode != NULL); currentNode = JNodeGetNext(currentNode))
+		{
+			result = JRBTreeSnapshotWrite(writer, currentNode->key, strlen((char*)(currentNode->key)) + 1);
+		}
+	}
+
+	if(result == 1) result = JRBTreeSnapshotFlush(writer);
+
+	if(result == 1)
+	{
+		header.payloadChecksum = writer->checksum;
+		header.headerChecksum = _UpdateCRC32(0, &header, sizeof(JRBTreeSnapshotHeader));
+		result = _WriteAll(fd, &header, sizeof(JRBTreeSnapshotHeader), startOffset);
+	}
+
+	free(writer);
+	return (result == 1) ? SaveSuccess : SaveFail;
+}
+
+/**
+ * @fn JRBTreeMappedPtr JRBTreeLoadMapped(const char *path)
+ * @brief JRBTreeSave 로 저장한 스냅샷 파일을 mmap 으로 읽기 전용 매핑하는 함수
+ * 헤더의 식별자, 버전, 바이트 순서, 체크섬과 영역 크기만 검사하고 키 영역은 읽지 않는다.
+ * 키 영역의 체크섬은 필요할 때 JRBTreeMappedVerify 로 검사한다.
+ * @param path 스냅샷 파일 경로(입력, 읽기 전용)
+ * @return 성공 시 생성된 매핑 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JRBTreeMappedPtr JRBTreeLoadMapped(const char *path)
+{
+	if(path == NULL) return NULL;
+
+	int fd = open(path, O_RDONLY);
+	if(fd < 0) return NULL;
+
+	struct stat fileStat;
+	if((fstat(fd, &fileStat) != 0) || ((size_t)fileStat.st_size < sizeof(JRBTreeSnapshotHeader)))
+	{
+		close(fd);
+		return NULL;
+	}
+
+	size_t length = (size_t)fileStat.st_size;
+	void *base = mmap(NULL, length, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if(base == MAP_FAILED) return NULL;
+
+	JRBTreeSnapshotHeader header;
+	memcpy(&header, base, sizeof(JRBTreeSnapshotHeader));
+	uint32_t headerChecksum = header.headerChecksum;
+	header.headerChecksum = 0;
+
+	if((memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0)
+		|| (header.version != SNAPSHOT_VERSION)
+		|| (header.byteOrder != SNAPSHOT_BYTE_ORDER)
+		|| (_UpdateCRC32(0, &header, sizeof(JRBTreeSnapshotHeader)) != headerChecksum)
+		|| (header.keySize == 0) || (header.keySize != _GetKeySize((KeyType)header.keyType))
+		|| (header.keyOffset + header.count * header.keySize > header.heapOffset)
+		|| (header.heapOffset + header.heapSize != length))
+	{
+		munmap(base, length);
+		return NULL;
+	}
+
+	JRBTreeMappedPtr newMapped = (JRBTreeMappedPtr)malloc(sizeof(JRBTreeMapped));
+	if(newMapped == NULL)
+	{
+		munmap(base, length);
+		return NULL;
+	}
+
+	newMapped->type = (KeyType)header.keyType;
+	newMapped->count = (size_t)header.count;
+	newMapped->keys = (const char*)base + header.keyOffset;
+	newMapped->stringHeap = (const char*)base + header.heapOffset;
+	newMapped->base = base;
+	newMapped->length = length;
+
+	return newMapped;
+}
+
+/**
+ * @fn DeleteResult DeleteJRBTreeMapped(JRBTreeMappedPtrContainer container)
+ * @brief 매핑 구조체 객체를 삭제하고 매핑을 해제하는 함수
+ * @param container 매핑 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJRBTreeMapped(JRBTreeMappedPtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	munmap((*container)->base, (*container)->length);
+	free(*container);
+	*container = NULL;
+
+	return DeleteSuccess;
+}
+
+/**
+ * @fn int JRBTreeMappedVerify(const JRBTreeMappedPtr mapped)
+ * @brief 매핑된 스냅샷의 키 영역과 문자열 영역이 저장할 때와 같은지 체크섬으로 검사하는 함수
+ * @param mapped 매핑 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 같으면 1, 다르거나 실패 시 0 반환
+ */
+int JRBTreeMappedVerify(const JRBTreeMappedPtr mapped)
+{
+	if(mapped == NULL) return 0;
+
+	const JRBTreeSnapshotHeader *header = (const JRBTreeSnapshotHeader*)(mapped->base);
+	uint32_t checksum = _UpdateCRC32(0, (const char*)(mapped->base) + header->keyOffset, mapped->length - header->keyOffset);
+	return checksum == header->payloadChecksum;
+}
+
+/**
+ * @fn const void* JRBTreeMappedGetKey(const JRBTreeMappedPtr mapped, size_t index)
+ * @brief 매핑된 스냅샷에서 정렬 순서로 index 번째 키의 주소를 반환하는 함수
+ * 매핑은 읽기 전용(PROT_READ)이므로 반환된 키를 수정하면 안 된다.
+ * @param mapped 매핑 구조체 객체의 주소(입력, 읽기 전용)
+ * @param index 키 순서(입력)
+ * @return 성공 시 매핑 영역 안의 키 주소(const int*, const char*, 문자열), 실패 시 NULL 반환
+ */
+const void* JRBTreeMappedGetKey(const JRBTreeMappedPtr mapped, size_t index)
+{
+	if(mapped == NULL || index >= mapped->count) return NULL;
+
+	switch(mapped->type)
+	{
+		case IntType:
+			return (const int32_t*)(mapped->keys) + index;
+		case CharType:
+			return (const char*)(mapped->keys) + index;
+		case StringType:
+			return mapped->stringHeap + ((const uint64_t*)(mapped->keys))[index];
+		default:
+			return NULL;
+	}
+}
+
+/**
+ * @fn const void* JRBTreeMappedFindKey(const JRBTreeMappedPtr mapped, const void *key)
+ * @brief 매핑된 스냅샷에서 지정한 키 값과 같은 키를 검색하는 함수 (이진 검색, 역직렬화 없음)
+ * @param mapped 매핑 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키의 주소(입력, 읽기 전용)
+ * @return 성공 시 매핑 영역 안의 키 주소, 실패 시 NULL 반환
+ */
+const void* JRBTreeMappedFindKey(const JRBTreeMappedPtr mapped, const void *key)
+{
+	if(mapped == NULL || key == NULL) return NULL;
+
+	size_t low = 0;
+	size_t high = mapped->count;
+
+	// key 이상인 첫 번째 키의 위치를 찾는다.
+	while(low < high)
+	{
+		size_t middle = low + (high - low) / 2;
+		if(JRBTreeMappedCompare(mapped, middle, key) < 0) low = middle + 1;
+		else high = middle;
+	}
+
+	if((low < mapped->count) && (JRBTreeMappedCompare(mapped, low, key) == 0)) return JRBTreeMappedGetKey(mapped, low);
+	return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Snapshot Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int JRBTreeSnapshotWrite(JRBTreeSnapshotWriterPtr writer, const void *data, size_t size)
+ * @brief 데이터를 버퍼에 쌓고, 버퍼가 가득 차면 파일에 기록하는 함수
+ * @param writer 버퍼 구조체 객체의 주소(출력)
+ * @param data 기록할 데이터(입력, 읽기 전용)
+ * @param size 기록할 크기(입력)
+ * @return 성공 시 1, 실패 시 -1 반환
+ */
+static int JRBTreeSnapshotWrite(JRBTreeSnapshotWriterPtr writer, const void *data, size_t size)
+{
+	const unsigned char *source = (const unsigned char*)data;
+
+	while(size > 0)
+	{
+		size_t copySize = SNAPSHOT_BUFFER_SIZE - writer->length;
+		if(copySize > size) copySize = size;
+
+		memcpy(writer->buffer + writer->length, source, copySize);
+		writer->length += copySize;
+		source += copySize;
+		size -= copySize;
+
+		if((writer->length == SNAPSHOT_BUFFER_SIZE) && (JRBTreeSnapshotFlush(writer) != 1)) return -1;
+	}
+
+	return 1;
+}
+
+/**
+ * @fn static int JRBTreeSnapshotFlush(JRBTreeSnapshotWriterPtr writer)
+ * @brief 버퍼에 쌓인 데이터를 체크섬에 반영하고 파일에 기록하는 함수
+ * @param writer 버퍼 구조체 객체의 주소(출력)
+ * @return 성공 시 1, 실패 시 -1 반환
+ */
+static int JRBTreeSnapshotFlush(JRBTreeSnapshotWriterPtr writer)
+{
+	if(writer->length == 0) return 1;
+
+	writer->checksum = _UpdateCRC32(writer->checksum, writer->buffer, writer->length);
+	if(_WriteAll(writer->fd, writer->buffer, writer->length, -1) != 1) return -1;
+
+	writer->length = 0;
+	return 1;
+}
+
+/**
+ * @fn static int JRBTreeSnapshotPad(JRBTreeSnapshotWriterPtr writer, uint64_t *offset)
+ * @brief 다음 영역이 SNAPSHOT_ALIGNMENT 단위로 시작하도록 0 을 채우는 함수
+ * @param writer 버퍼 구조체 객체의 주소(출력)
+ * @param offset 현재 오프셋, 정렬된 오프셋으로 변경된다.(입력, 출력)
+ * @return 성공 시 1, 실패 시 -1 반환
+ */
+static int JRBTreeSnapshotPad(JRBTreeSnapshotWriterPtr writer, uint64_t *offset)
+{
+	static const unsigned char zeros[SNAPSHOT_ALIGNMENT] = { 0 };
+	uint64_t padSize = (SNAPSHOT_ALIGNMENT - (*offset % SNAPSHOT_ALIGNMENT)) % SNAPSHOT_ALIGNMENT;
+
+	*offset += padSize;
+	return JRBTreeSnapshotWrite(writer, zeros, (size_t)padSize);
+}
+
+/**
+ * @fn static int JRBTreeMappedCompare(const JRBTreeMappedPtr mapped, size_t index, const void *key)
+ * @brief 매핑된 스냅샷의 index 번째 키와 지정한 키를 비교하는 함수
+ * @param mapped 매핑 구조체 객체의 주소(입력, 읽기 전용)
+ * @param index 비교할 키 순서(입력)
+ * @param key 비교할 키의 주소(입력, 읽기 전용)
+ * @return 저장된 키가 작으면 음수, 같으면 0, 크면 양수 반환
+ */
+static int JRBTreeMappedCompare(const JRBTreeMappedPtr mapped, size_t index, const void *key)
+{
+	switch(mapped->type)
+	{
+		case IntType:
+		{
+			int32_t storedKey = ((const int32_t*)(mapped->keys))[index];
+			return (storedKey > *((const int*)key)) - (storedKey < *((const int*)key));
+		}
+		case CharType:
+		{
+			char storedKey = ((const char*)(mapped->keys))[index];
+			return (storedKey > *((const char*)key)) - (storedKey < *((const char*)key));
+		}
+		case StringType:
+			return strcmp(mapped->stringHeap + ((const uint64_t*)(mapped->keys))[index], (const char*)key);
+		default:
+			return 0;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Util Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static uint32_t _UpdateCRC32(uint32_t crc, const void *data, size_t size)
+ * @brief CRC32 (IEEE 802.3, zlib 과 같은 값)를 이어서 계산하는 함수
+ * @param crc 이전까지 계산한 CRC32, 처음이면 0(입력)
+ * @param data 계산할 데이터(입력, 읽기 전용)
+ * @param size 데이터 크기(입력)
+ * @return 항상 갱신된 CRC32 반환
+ */
+static uint32_t _UpdateCRC32(uint32_t crc, const void *data, size_t size)
+{
+	static uint32_t table[256];
+	static int isTableReady = 0;
+
+	if(isTableReady == 0)
+	{
+		uint32_t tableIndex = 0;
+		for( ; tableIndex < 256; tableIndex++)
+		{
+			uint32_t value = tableIndex;
+			int bitIndex = 0;
+			for( ; bitIndex < 8; bitIndex++) value = (value & 1) ? (0xEDB88320u ^ (value >> 1)) : (value >> 1);
+			table[tableIndex] = value;
+		}
+		isTableReady = 1;
+	}
+
+	const unsigned char *bytes = (const unsigned char*)data;
+	crc = ~crc;
+	while(size-- > 0) crc = table[(crc ^ *bytes++) & 0xFF] ^ (crc >> 8);
+	return ~crc;
+}
+
+/**
+ * @fn static int _WriteAll(int fd, const void *data, size_t size, off_t offset)
+ * @brief 중간에 끊기거나 일부만 기록되어도 지정한 크기를 모두 기록하는 함수
+ * @param fd 기록할 파일 디스크립터(입력)
+ * @param data 기록할 데이터(입력, 읽기 전용)
+ * @param size 기록할 크기(입력)
+ * @param offset 기록할 위치, 음수면 현재 위치(입력)
+ * @return 성공 시 1, 실패 시 -1 반환
+ */
+static int _WriteAll(int fd, const void *data, size_t size, off_t offset)
+{
+	const char *source = (const char*)data;
+
+	while(size > 0)
+	{
+		ssize_t writtenSize = (offset < 0) ? write(fd, source, size) : pwrite(fd, source, size, offset);
+		if(writtenSize < 0)
+		{
+			if(errno == EINTR) continue;
+			return -1;
+		}
+
+		source += writtenSize;
+		size -= (size_t)writtenSize;
+		if(offset >= 0) offset += writtenSize;
+	}
+
+	return 1;
+}
+
+/**
+ * @fn static uint32_t _GetKeySize(KeyType type)
+ * @brief 스냅샷 키 영역에서 키 하나가 차지하는 크기를 반환하는 함수
+ * @param type 키 데이터 유형(입력)
+ * @return 성공 시 키 크기, 실패 시 0 반환
+ */
+static uint32_t _GetKeySize(KeyType type)
+{
+	switch(type)
+	{
+		case IntType:
+			return sizeof(int32_t);
+		case CharType:
+			return sizeof(char);
+		case StringType:
+			return sizeof(uint64_t);
+		default:
+			return 0;
+	}
+}
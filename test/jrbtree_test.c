@@ -1,5 +1,10 @@
+#include <unistd.h>
+
 #include "../include/ttlib.h"
 #include "../include/jrbtree.h"
+#include "../include/jrbtree_inline.h"
+#include "../include/jrbtree_gen.h"
+#include "../include/jrbtree_intrusive.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Definitions of Test
@@ -7,6 +12,162 @@
 
 DECLARE_TEST();
 
+// 특화 RB Tree 생성 테스트용 (include/jrbtree_gen.h)
+JRBTREE_DEFINE(IntMap, int, int, JRBTREE_CMP_NUM)
+JRBTREE_DEFINE(StringMap, const char*, int, JRBTREE_CMP_STR)
+
+// 키 소멸자 테스트용 (JRBTreeSetKeyDestructor)
+static int destroyedKeyCount = 0;
+static void DestroyKey(void *key)
+{
+	destroyedKeyCount++;
+	free(key);
+}
+
+// Intrusive RB Tree 테스트용 (include/jrbtree_intrusive.h), 한 객체를 id 와 deadline 두 트리에 넣는다.
+typedef struct _test_task_t {
+	int id;
+	int deadline;
+	JRBTreeLink byId;
+	JRBTreeLink byDeadline;
+} TestTask;
+
+static int CompareTaskById(const JRBTreeLink *link1, const JRBTreeLink *link2)
+{
+	const TestTask *task1 = JRBTREE_CONTAINER_OF(link1, const TestTask, byId);
+	const TestTask *task2 = JRBTREE_CONTAINER_OF(link2, const TestTask, byId);
+	return (task1->id > task2->id) - (task1->id < task2->id);
+}
+
+static int CompareTaskByDeadline(const JRBTreeLink *link1, const JRBTreeLink *link2)
+{
+	const TestTask *task1 = JRBTREE_CONTAINER_OF(link1, const TestTask, byDeadline);
+	const TestTask *task2 = JRBTREE_CONTAINER_OF(link2, const TestTask, byDeadline);
+	return (task1->deadline > task2->deadline) - (task1->deadline < task2->deadline);
+}
+
+static int CompareIdWithTask(const void *key, const JRBTreeLink *link)
+{
+	const TestTask *task = JRBTREE_CONTAINER_OF(link, const TestTask, byId);
+	int id = *((const int*)key);
+	return (id > task->id) - (id < task->id);
+}
+
+// 집계 값 테스트용 (NewJRBTreeAugmented), 키 값 순서로 값의 합, 최소, 최대, 개수, 첫 번째 값을 집계한다.
+typedef struct _test_record_t {
+	int key;
+	int value;
+} TestRecord;
+
+typedef struct _test_aggregate_t {
+	long long sum;
+	int min;
+	int max;
+	int count;
+	int first;
+} TestAggregate;
+
+static void CombineRecord(void *aggregate, const void *key, const void *leftAggregate, const void *rightAggregate)
+{
+	const TestRecord *record = (const TestRecord*)key;
+	TestAggregate result = { record->value, record->value, record->value, 1, record->value };
+	if(leftAggregate != NULL)
+	{
+		const TestAggregate *left = (const TestAggregate*)leftAggregate;
+		result.sum += left->sum;
+		if(left->min < result.min) result.min = left->min;
+		if(left->max > result.max) result.max = left->max;
+		result.count += left->count;
+		result.first = left->first;
+	}
+	if(rightAggregate != NULL)
+	{
+		const TestAggregate *right = (const TestAggregate*)rightAggregate;
+		result.sum += right->sum;
+		if(right->min < result.min) result.min = right->min;
+		if(right->max > result.max) result.max = right->max;
+		result.count += right->count;
+	}
+	*((TestAggregate*)aggregate) = result;
+}
+
+// 병렬 순회 테스트용 (JRBTreeParallelForEach), 키 값마다 방문 횟수와 조각 번호를 기록한다.
+// 키 값이 서로 다르므로 여러 thread 가 같은 칸에 쓰지 않는다.
+#define TEST_PARALLEL_KEY_COUNT 3000
+
+typedef struct _test_visit_t {
+	int visits[TEST_PARALLEL_KEY_COUNT];
+	size_t chunks[TEST_PARALLEL_KEY_COUNT];
+} TestVisit;
+
+static void VisitKey(void *key, size_t chunk, void *ctx)
+{
+	TestVisit *visit = (TestVisit*)ctx;
+	int value = *((int*)key);
+	visit->visits[value]++;
+	visit->chunks[value] = chunk;
+}
+
+// 병렬 reduce 테스트용 (JRBTreeParallelReduce), 키 순서로 이어지는지 확인하면서 합과 개수를 누적한다.
+typedef struct _test_sequence_t {
+	long long sum;
+	int count;
+	int first;
+	int last;
+	int ordered;
+} TestSequence;
+
+static void ReduceSequence(void *accumulator, void *key, void *ctx)
+{
+	TestSequence *sequence = (TestSequence*)accumulator;
+	int value = *((int*)key);
+	(void)ctx;
+
+	if(sequence->count > 0 && value <= sequence->last) sequence->ordered = 0;
+	if(sequence->count == 0) sequence->first = value;
+	sequence->last = value;
+	sequence->sum += value;
+	sequence->count++;
+}
+
+static void MergeSequence(void *accumulator, const void *chunkAccumulator, void *ctx)
+{
+	TestSequence *sequence = (TestSequence*)accumulator;
+	const TestSequence *chunkSequence = (const TestSequence*)chunkAccumulator;
+	(void)ctx;
+
+	if(chunkSequence->count == 0) return;
+	if(chunkSequence->ordered == 0 || (sequence->count > 0 && chunkSequence->first <= sequence->last)) sequence->ordered = 0;
+	if(sequence->count == 0) sequence->first = chunkSequence->first;
+	sequence->last = chunkSequence->last;
+	sequence->sum += chunkSequence->sum;
+	sequence->count += chunkSequence->count;
+}
+
+// RB Tree 검사용, 부모 노드 주소와 RB Tree 조건을 검사해서 Black 높이를 반환한다. (위반하면 -1)
+static int CheckRedBlack(const JNodePtr node, const JNodePtr parent)
+{
+	if(node == NULL) return 1;
+	if(node->parent != parent) return -1;
+	if(node->color == Red && parent != NULL && parent->color == Red) return -1;
+
+	int leftHeight = CheckRedBlack(node->left, node);
+	int rightHeight = CheckRedBlack(node->right, node);
+	if(leftHeight < 0 || leftHeight != rightHeight) return -1;
+	return leftHeight + ((node->color == Black) ? 1 : 0);
+}
+
+// hint 테스트용, 트리에서 임의의 노드를 반환한다. (비어 있으면 NULL)
+static JNodePtr GetRandomNode(const JRBTreePtr tree)
+{
+	if(JRBTreeSize(tree) == 0) return NULL;
+
+	size_t skipCount = (size_t)rand() % JRBTreeSize(tree);
+	JNodePtr node = JRBTreeMin(tree);
+	for( ; skipCount > 0; skipCount--) node = JNodeGetNext(node);
+	return node;
+}
+
 // ---------- Common Test ----------
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -227,6 +388,1407 @@ TEST(RBTree_INT, FindNodeByKey, {
 	DeleteJRBTree(&tree);
 })
 
+TEST(RBTree_INT, RedBlackInvariant, {
+	int values[1000];
+	int order[1000];
+	int index;
+	int violations = 0;
+	JRBTreePtr tree = NewJRBTree(IntType);
+
+	for(index = 0; index < 1000; index++)
+	{
+		values[index] = index;
+		order[index] = index;
+	}
+
+	// 순차 추가, 삭제할 때마다 Black 높이와 부모 노드 주소 확인
+	for(index = 0; index < 1000; index++)
+	{
+		if(JRBTreeInsertNode(tree, &values[index]) == NULL) violations++;
+		if(CheckRedBlack(tree->root, NULL) < 0 || tree->root->color != Black) violations++;
+	}
+	for(index = 0; index < 1000; index++)
+	{
+		if(JRBTreeDeleteNodeByKey(tree, &values[index]) != DeleteSuccess) violations++;
+		if(CheckRedBlack(tree->root, NULL) < 0) violations++;
+	}
+	EXPECT_NUM_EQUAL(violations, 0, int);
+	EXPECT_NULL(tree->root);
+
+	// 무작위 순서로 추가, 삭제
+	srand(2026);
+	for(index = 999; index > 0; index--)
+	{
+		int target = rand() % (index + 1);
+		int temp = order[index];
+		order[index] = order[target];
+		order[target] = temp;
+	}
+	for(index = 0; index < 1000; index++)
+	{
+		if(JRBTreeInsertNode(tree, &values[order[index]]) == NULL) violations++;
+		if(CheckRedBlack(tree->root, NULL) < 0 || tree->root->color != Black) violations++;
+	}
+	for(index = 0; index < 1000; index += 2)
+	{
+		if(JRBTreeDeleteNodeByKey(tree, &values[order[index]]) != DeleteSuccess) violations++;
+		if(CheckRedBlack(tree->root, NULL) < 0) violations++;
+	}
+	for(index = 0; index < 1000; index++)
+	{
+		JNodePtr node = JRBTreeFindNodeByKey(tree, &values[order[index]]);
+		if((index % 2 == 0) != (node == NULL)) violations++;
+	}
+	for(index = 1; index < 1000; index += 2)
+	{
+		if(JRBTreeDeleteNodeByKey(tree, &values[order[index]]) != DeleteSuccess) violations++;
+		if(CheckRedBlack(tree->root, NULL) < 0) violations++;
+	}
+	EXPECT_NUM_EQUAL(violations, 0, int);
+	EXPECT_NULL(tree->root);
+
+	DeleteJRBTree(&tree);
+})
+
+////////////////////////////////////////////////////////////////////////////////
+/// Frozen Test (int)
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(Frozen_INT, CreateAndDeleteFrozen, {
+	JRBTreePtr tree = NewJRBTree(IntType);
+	int expected = 5;
+
+	// 빈 RB Tree 도 변환 가능
+	JRBTreeFrozenPtr frozen = NewJRBTreeFrozen(tree);
+	EXPECT_NOT_NULL(frozen);
+	EXPECT_NULL(JRBTreeFrozenFindNodeByKey(frozen, &expected));
+	EXPECT_NUM_EQUAL(DeleteJRBTreeFrozen(&frozen), DeleteSuccess, int);
+	EXPECT_NULL(frozen);
+
+	JRBTreePtr charTree = NewJRBTree(CharType);
+	EXPECT_NULL(NewJRBTreeFrozen(charTree));
+	EXPECT_NULL(NewJRBTreeFrozen(NULL));
+	EXPECT_NUM_EQUAL(DeleteJRBTreeFrozen(NULL), DeleteFail, int);
+
+	DeleteJRBTree(&charTree);
+	DeleteJRBTree(&tree);
+})
+
+TEST(Frozen_INT, FindNodeByKey, {
+	JRBTreePtr tree = NewJRBTree(IntType);
+	int keyCount = 1000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)keyCount);
+	int keyIndex = 0;
+
+	// 짝수 키만 저장하고, 홀수 키로 실패 검색을 확인한다.
+	for(keyIndex = 0; keyIndex < keyCount; keyIndex++)
+	{
+		keys[keyIndex] = ((keyIndex * 7919) % keyCount) * 2;
+		JRBTreeInsertNode(tree, &keys[keyIndex]);
+	}
+
+	JRBTreeFrozenPtr frozen = NewJRBTreeFrozen(tree);
+	EXPECT_NOT_NULL(frozen);
+	EXPECT_NUM_EQUAL((int)frozen->count, keyCount, int);
+
+	int mismatchCount = 0;
+	int searchType = (int)frozen->searchType;
+	for( ; searchType >= (int)FrozenScalar; searchType--)
+	{
+		// CPU 가 지원하는 방식부터 일반 비교 방식까지 모두 같은 결과를 내야 한다.
+		frozen->searchType = (FrozenSearchType)searchType;
+		for(keyIndex = 0; keyIndex < keyCount; keyIndex++)
+		{
+			int missKey = keys[keyIndex] + 1;
+			JNodePtr node = JRBTreeFrozenFindNodeByKey(frozen, &keys[keyIndex]);
+			if(node == NULL || node->key != &keys[keyIndex]) mismatchCount++;
+			if(JRBTreeFrozenFindNodeByKey(frozen, &missKey) != NULL) mismatchCount++;
+		}
+	}
+	EXPECT_NUM_EQUAL(mismatchCount, 0, int);
+
+	int minKey = -1;
+	EXPECT_NULL(JRBTreeFrozenFindNodeByKey(frozen, &minKey));
+	EXPECT_NULL(JRBTreeFrozenFindNodeByKey(frozen, NULL));
+	EXPECT_NULL(JRBTreeFrozenFindNodeByKey(NULL, &keys[0]));
+
+	DeleteJRBTreeFrozen(&frozen);
+	DeleteJRBTree(&tree);
+	free(keys);
+})
+
+////////////////////////////////////////////////////////////////////////////////
+/// Snapshot Test (int)
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(Snapshot_INT, SaveAndLoadMapped, {
+	JRBTreePtr tree = NewJRBTree(IntType);
+	int expected1 = 10;
+	int expected2 = -12;
+	int expected3 = 2;
+	int expected4 = 9;
+
+	JRBTreeInsertNode(tree, &expected1);
+	JRBTreeInsertNode(tree, &expected2);
+	JRBTreeInsertNode(tree, &expected3);
+
+	char path[] = "/tmp/jrbtree_snapshot_XXXXXX";
+	int fd = mkstemp(path);
+	EXPECT_NUM_EQUAL(JRBTreeSave(tree, fd), SaveSuccess, int);
+	EXPECT_NUM_EQUAL(JRBTreeSave(NULL, fd), SaveFail, int);
+	EXPECT_NUM_EQUAL(JRBTreeSave(tree, -1), SaveFail, int);
+	close(fd);
+
+	JRBTreeMappedPtr mapped = JRBTreeLoadMapped(path);
+	EXPECT_NOT_NULL(mapped);
+	EXPECT_NUM_EQUAL(mapped->type, IntType, int);
+	EXPECT_NUM_EQUAL((int)(mapped->count), 3, int);
+	EXPECT_NUM_EQUAL(JRBTreeMappedVerify(mapped), 1, int);
+
+	// 정렬 순서로 저장된다.
+	EXPECT_NUM_EQUAL(*((const int*)JRBTreeMappedGetKey(mapped, 0)), expected2, int);
+	EXPECT_NUM_EQUAL(*((const int*)JRBTreeMappedGetKey(mapped, 1)), expected3, int);
+	EXPECT_NUM_EQUAL(*((const int*)JRBTreeMappedGetKey(mapped, 2)), expected1, int);
+	EXPECT_NUM_EQUAL(JRBTreeMappedGetKey(mapped, 3) == NULL, 1, int);
+
+	EXPECT_NUM_EQUAL(*((const int*)JRBTreeMappedFindKey(mapped, &expected1)), expected1, int);
+	EXPECT_NUM_EQUAL(*((const int*)JRBTreeMappedFindKey(mapped, &expected2)), expected2, int);
+	EXPECT_NUM_EQUAL(JRBTreeMappedFindKey(mapped, &expected4) == NULL, 1, int);
+	EXPECT_NUM_EQUAL(JRBTreeMappedFindKey(mapped, NULL) == NULL, 1, int);
+	EXPECT_NUM_EQUAL(JRBTreeMappedFindKey(NULL, &expected1) == NULL, 1, int);
+
+	EXPECT_NUM_EQUAL(DeleteJRBTreeMapped(&mapped), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(DeleteJRBTreeMapped(NULL), DeleteFail, int);
+	EXPECT_NULL(JRBTreeLoadMapped(NULL));
+
+	unlink(path);
+	DeleteJRBTree(&tree);
+})
+
+TEST(Snapshot_INT, RejectCorruptedHeader, {
+	JRBTreePtr tree = NewJRBTree(IntType);
+	int expected = 10;
+	JRBTreeInsertNode(tree, &expected);
+
+	char path[] = "/tmp/jrbtree_snapshot_XXXXXX";
+	int fd = mkstemp(path);
+	JRBTreeSave(tree, fd);
+
+	// 헤더의 키 개수를 바꾸면 헤더 체크섬이 맞지 않는다.
+	char corrupted = 7;
+	pwrite(fd, &corrupted, sizeof(char), 24);
+	close(fd);
+
+	EXPECT_NULL(JRBTreeLoadMapped(path));
+
+	unlink(path);
+	DeleteJRBTree(&tree);
+})
+
+////////////////////////////////////////////////////////////////////////////////
+/// Export Test (int)
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(Export_INT, ExportToBuffer, {
+	JRBTreePtr tree = NewJRBTree(IntType);
+	int expected1 = 10;
+	int expected2 = -12;
+	int expected3 = 2;
+
+	JRBTreeInsertNode(tree, &expected1);
+	JRBTreeInsertNode(tree, &expected2);
+	JRBTreeInsertNode(tree, &expected3);
+
+	// 버퍼가 작아도 키가 나뉘어 이어서 기록된다.
+	JRBTreeExportCursorPtr cursor = NewJRBTreeExportCursor(tree, ExportNewline);
+	EXPECT_NOT_NULL(cursor);
+
+	char result[64];
+	size_t resultSize = 0;
+	size_t writtenSize = 0;
+	while((writtenSize = JRBTreeExportToBuffer(cursor, result + resultSize, 3)) > 0) resultSize += writtenSize;
+	result[resultSize] = '\0';
+	EXPECT_STR_EQUAL(result, "-12\n2\n10\n");
+	EXPECT_NUM_EQUAL((int)JRBTreeExportToBuffer(cursor, result, sizeof(result)), 0, int);
+	DeleteJRBTreeExportCursor(&cursor);
+
+	// 이진 형식은 정수 값 그대로 정렬 순서로 기록된다.
+	cursor = NewJRBTreeExportCursor(tree, ExportBinary);
+	int binaryKeys[3];
+	EXPECT_NUM_EQUAL((int)JRBTreeExportToBuffer(cursor, (char*)binaryKeys, sizeof(binaryKeys)), (int)sizeof(binaryKeys), int);
+	EXPECT_NUM_EQUAL(binaryKeys[0], expected2, int);
+	EXPECT_NUM_EQUAL(binaryKeys[1], expected3, int);
+	EXPECT_NUM_EQUAL(binaryKeys[2], expected1, int);
+	DeleteJRBTreeExportCursor(&cursor);
+
+	// 길이 + 값 형식
+	cursor = NewJRBTreeExportCursor(tree, ExportLengthPrefixed);
+	EXPECT_NUM_EQUAL((int)JRBTreeExportToBuffer(cursor, result, sizeof(result)), 24, int);
+	EXPECT_NUM_EQUAL(*((int*)result), (int)sizeof(int), int);
+	EXPECT_NUM_EQUAL(*((int*)(result + 4)), expected2, int);
+	DeleteJRBTreeExportCursor(&cursor);
+
+	EXPECT_NULL(NewJRBTreeExportCursor(NULL, ExportBinary));
+	EXPECT_NULL(NewJRBTreeExportCursor(tree, 123));
+	EXPECT_NUM_EQUAL((int)JRBTreeExportToBuffer(NULL, result, sizeof(result)), 0, int);
+	EXPECT_NUM_EQUAL(DeleteJRBTreeExportCursor(NULL), DeleteFail, int);
+
+	DeleteJRBTree(&tree);
+})
+
+////////////////////////////////////////////////////////////////////////////////
+/// Dump Test (int)
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(Dump_INT, DumpToBuffer, {
+	JRBTreePtr tree = NewJRBTree(IntType);
+	int expected1 = 10;
+	int expected2 = 12;
+	int expected3 = 2;
+
+	JRBTreeInsertNode(tree, &expected1);
+	JRBTreeInsertNode(tree, &expected2);
+	JRBTreeInsertNode(tree, &expected3);
+
+	// 기본 옵션은 JRBTreePrintAll 과 같은 텍스트 형식
+	char result[512];
+	EXPECT_NUM_EQUAL((int)JRBTreeDumpToBuffer(tree, result, sizeof(result), NULL), 37, int);
+	EXPECT_STR_EQUAL(result, "\t[B] 10(B) \n\t\t[L] 2(R) \n\t\t[R] 12(R) \n");
+
+	// 깊이 제한
+	JRBTreeDumpOption option;
+	option.format = DumpText;
+	option.maxDepth = 1;
+	option.sampleRate = 1;
+	JRBTreeDumpToBuffer(tree, result, sizeof(result), &option);
+	EXPECT_STR_EQUAL(result, "\t[B] 10(B) \n");
+
+	// 샘플링 (방문 순서 0, 2 번째 노드)
+	option.maxDepth = 0;
+	option.sampleRate = 2;
+	JRBTreeDumpToBuffer(tree, result, sizeof(result), &option);
+	EXPECT_STR_EQUAL(result, "\t[B] 10(B) \n\t\t[R] 12(R) \n");
+
+	// 버퍼가 부족하면 잘라서 저장하고 전체 크기를 반환한다.
+	EXPECT_NUM_EQUAL((int)JRBTreeDumpToBuffer(tree, result, 5, NULL), 37, int);
+	EXPECT_STR_EQUAL(result, "\t[B]");
+
+	option.format = DumpJSON;
+	option.sampleRate = 1;
+	JRBTreeDumpToBuffer(tree, result, sizeof(result), &option);
+	EXPECT_NUM_EQUAL(strncmp(result, "{\"type\":\"int\",\"nodes\":[{\"id\":", 29), 0, int);
+	EXPECT_NOT_NULL(strstr(result, "\"parent\":null,\"position\":\"B\",\"depth\":1,\"color\":\"B\",\"key\":10}"));
+
+	option.format = DumpGraphviz;
+	JRBTreeDumpToBuffer(tree, result, sizeof(result), &option);
+	EXPECT_NUM_EQUAL(strncmp(result, "digraph JRBTree {", 17), 0, int);
+	EXPECT_NOT_NULL(strstr(result, "[label=\"12\", fillcolor=red];"));
+
+	EXPECT_NUM_EQUAL((int)JRBTreeDumpToBuffer(NULL, result, sizeof(result), NULL), 0, int);
+	EXPECT_NUM_EQUAL((int)JRBTreeDumpToBuffer(tree, NULL, sizeof(result), NULL), 0, int);
+
+	DeleteJRBTree(&tree);
+})
+
+TEST(Dump_INT, DumpToFile, {
+	JRBTreePtr tree = NewJRBTree(IntType);
+	int expected1 = 10;
+	JRBTreeInsertNode(tree, &expected1);
+
+	FILE *fp = tmpfile();
+	EXPECT_NUM_EQUAL((int)JRBTreeDump(tree, fp, NULL), 12, int);
+	EXPECT_NUM_EQUAL((int)JRBTreeDump(NULL, fp, NULL), -1, int);
+	EXPECT_NUM_EQUAL((int)JRBTreeDump(tree, NULL, NULL), -1, int);
+
+	char result[64];
+	rewind(fp);
+	result[fread(result, 1, sizeof(result) - 1, fp)] = '\0';
+	EXPECT_STR_EQUAL(result, "\t[B] 10(B) \n");
+
+	fclose(fp);
+	DeleteJRBTree(&tree);
+})
+
+TEST(RBTree_INT, SizeAndMinMax, {
+	JRBTreePtr tree = NewJRBTree(IntType);
+
+	EXPECT_NUM_EQUAL((int)JRBTreeSize(NULL), 0, int);
+	EXPECT_NUM_EQUAL((int)JRBTreeSize(tree), 0, int);
+	EXPECT_NULL(JRBTreeMin(tree));
+	EXPECT_NULL(JRBTreeMax(tree));
+
+	int keys[7];
+	keys[0] = 40; keys[1] = 20; keys[2] = 60; keys[3] = 10;
+	keys[4] = 70; keys[5] = 30; keys[6] = 50;
+	int keyIndex = 0;
+	for( ; keyIndex < 7; keyIndex++) JRBTreeInsertNode(tree, &keys[keyIndex]);
+
+	EXPECT_NUM_EQUAL((int)JRBTreeSize(tree), 7, int);
+	EXPECT_PTR_EQUAL(JNodeGetKey(JRBTreeMin(tree)), &keys[3]);
+	EXPECT_PTR_EQUAL(JNodeGetKey(JRBTreeMax(tree)), &keys[4]);
+
+	// 중복 추가는 개수를 바꾸지 않는다.
+	EXPECT_NULL(JRBTreeInsertNode(tree, &keys[0]));
+	EXPECT_NUM_EQUAL((int)JRBTreeSize(tree), 7, int);
+
+	JRBTreeDeleteNodeByKey(tree, &keys[3]);
+	JRBTreeDeleteNodeByKey(tree, &keys[4]);
+	EXPECT_NUM_EQUAL((int)JRBTreeSize(tree), 5, int);
+	EXPECT_PTR_EQUAL(JNodeGetKey(JRBTreeMin(tree)), &keys[1]);
+	EXPECT_PTR_EQUAL(JNodeGetKey(JRBTreeMax(tree)), &keys[2]);
+
+	DeleteJRBTree(&tree);
+})
+
+TEST(RBTree_INT, PopMin, {
+	JRBTreePtr tree = NewJRBTree(IntType);
+	EXPECT_NULL(JRBTreePopMin(NULL));
+	EXPECT_NULL(JRBTreePopMin(tree));
+
+	int keys[100];
+	int keyIndex = 0;
+	for( ; keyIndex < 100; keyIndex++)
+	{
+		keys[keyIndex] = (keyIndex * 37) % 100;
+		JRBTreeInsertNode(tree, &keys[keyIndex]);
+	}
+
+	// 작은 키부터 순서대로 꺼내진다.
+	int expected = 0;
+	int *key = NULL;
+	while((key = (int*)JRBTreePopMin(tree)) != NULL)
+	{
+		EXPECT_NUM_EQUAL(*key, expected, int);
+		expected++;
+	}
+	EXPECT_NUM_EQUAL(expected, 100, int);
+	EXPECT_NUM_EQUAL((int)JRBTreeSize(tree), 0, int);
+	EXPECT_NULL(JRBTreeMin(tree));
+	EXPECT_NULL(JRBTreeMax(tree));
+
+	DeleteJRBTree(&tree);
+})
+
+TEST(RBTree_INT, LowerAndUpperBound, {
+	JRBTreePtr tree = NewJRBTree(IntType);
+	int keys[5];
+	int keyIndex = 0;
+	for( ; keyIndex < 5; keyIndex++)
+	{
+		keys[keyIndex] = keyIndex * 10;
+		JRBTreeInsertNode(tree, &keys[keyIndex]);
+	}
+
+	int key = 15;
+	EXPECT_PTR_EQUAL(JNodeGetKey(JRBTreeLowerBound(tree, &key)), &keys[2]);
+	EXPECT_PTR_EQUAL(JNodeGetKey(JRBTreeUpperBound(tree, &key)), &keys[2]);
+	key = 20;
+	EXPECT_PTR_EQUAL(JNodeGetKey(JRBTreeLowerBound(tree, &key)), &keys[2]);
+	EXPECT_PTR_EQUAL(JNodeGetKey(JRBTreeUpperBound(tree, &key)), &keys[3]);
+	key = 40;
+	EXPECT_NULL(JRBTreeUpperBound(tree, &key));
+	EXPECT_NUM_EQUAL((int)JRBTreeCount(tree, &key), 1, int);
+
+	EXPECT_NULL(JRBTreeLowerBound(NULL, &key));
+	EXPECT_NULL(JRBTreeLowerBound(tree, NULL));
+	EXPECT_PTR_EQUAL(JNodeGetPrevious(JRBTreeMax(tree)), JRBTreeLowerBound(tree, &keys[3]));
+
+	DeleteJRBTree(&tree);
+})
+
+TEST(RBTree_INT, DeleteRangeAndTruncateBelow, {
+	JRBTreePtr tree = NewJRBTree(IntType);
+	int keys[1000];
+	int keyIndex = 0;
+	for( ; keyIndex < 1000; keyIndex++)
+	{
+		keys[keyIndex] = (keyIndex * 7) % 1000;
+		JRBTreeInsertNode(tree, &keys[keyIndex]);
+	}
+
+	// [100, 600) 삭제
+	int lo = 100;
+	int hi = 600;
+	EXPECT_NUM_EQUAL((int)JRBTreeDeleteRange(tree, &lo, &hi), 500, int);
+	EXPECT_NUM_EQUAL((int)JRBTreeSize(tree), 500, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JRBTreeMin(tree))), 0, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JRBTreeMax(tree))), 999, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JRBTreeLowerBound(tree, &lo))), 600, int);
+	EXPECT_NUM_EQUAL((int)JRBTreeDeleteRange(tree, &hi, &lo), 0, int);
+
+	// 남은 노드는 정렬 순서를 유지한다.
+	int count = 0;
+	int previousKey = -1;
+	JNodePtr node = JRBTreeMin(tree);
+	for( ; node != NULL; node = JNodeGetNext(node))
+	{
+		EXPECT_NUM_GREATER_THAN(*((int*)JNodeGetKey(node)), previousKey, int);
+		previousKey = *((int*)JNodeGetKey(node));
+		count++;
+	}
+	EXPECT_NUM_EQUAL(count, 500, int);
+
+	JRBTreeStats stats;
+	JRBTreeGetStats(tree, &stats);
+	EXPECT_NUM_LESS_EQUAL(stats.height, 18, int);
+
+	// 700 미만 삭제
+	int key = 700;
+	EXPECT_NUM_EQUAL((int)JRBTreeTruncateBelow(tree, &key), 200, int);
+	EXPECT_NUM_EQUAL((int)JRBTreeSize(tree), 300, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JRBTreeMin(tree))), 700, int);
+	EXPECT_NUM_EQUAL((int)JRBTreeTruncateBelow(tree, &key), 0, int);
+
+	key = 1000;
+	EXPECT_NUM_EQUAL((int)JRBTreeTruncateBelow(tree, &key), 300, int);
+	EXPECT_NULL(JRBTreeMin(tree));
+	EXPECT_NUM_EQUAL((int)JRBTreeDeleteRange(NULL, &lo, &hi), 0, int);
+
+	DeleteJRBTree(&tree);
+})
+
+TEST(RBTree_INT, FindIntBranchless, {
+	JRBTreePtr tree = NewJRBTree(IntType);
+	int keys[500];
+	int keyIndex = 0;
+	for( ; keyIndex < 500; keyIndex++)
+	{
+		keys[keyIndex] = (keyIndex * 37) % 500;
+		JRBTreeInsertNode(tree, &keys[keyIndex]);
+	}
+
+	// child[0], child[1] 은 left, right 와 같은 자리를 사용한다.
+	JNodePtr root = tree->root;
+	EXPECT_PTR_EQUAL(root->child[0], root->left);
+	EXPECT_PTR_EQUAL(root->child[1], root->right);
+
+	for(keyIndex = 0; keyIndex < 500; keyIndex++)
+	{
+		JNodePtr node = JRBTreeFindNodeByKey(tree, &keys[keyIndex]);
+		EXPECT_PTR_EQUAL(JNodeGetKey(node), &keys[keyIndex]);
+		EXPECT_PTR_EQUAL(JRBTreeFindNodeByKeyInline(tree, &keys[keyIndex]), node);
+	}
+
+	// 값이 같아도 주소가 다르면 찾지 않는다.
+	int key = keys[10];
+	EXPECT_NULL(JRBTreeFindNodeByKey(tree, &key));
+	EXPECT_NULL(JRBTreeFindNodeByKeyInline(tree, &key));
+
+	DeleteJRBTree(&tree);
+})
+
+TEST(Owned_INT, FindNodeByKeyInline, {
+	JRBTreePtr tree = NewJRBTreeOwned(IntType);
+
+	// 같은 변수를 재사용해도 트리는 복사본을 저장한다.
+	int key = 0;
+	for( ; key < 100; key++)
+	{
+		EXPECT_PTR_EQUAL(JRBTreeInsertNode(tree, &key), tree);
+	}
+
+	// 인라인 검색도 키 주소가 아니라 값으로 찾는다.
+	int missCount = 0;
+	for(key = 0; key < 100; key++)
+	{
+		JNodePtr node = JRBTreeFindNodeByKeyInline(tree, &key);
+		if(node == NULL || *((int*)JNodeGetKey(node)) != key) missCount++;
+	}
+	EXPECT_NUM_EQUAL(missCount, 0, int);
+
+	key = 50;
+	EXPECT_NUM_EQUAL(JRBTreeDeleteNodeByKey(tree, &key), DeleteSuccess, int);
+	EXPECT_NULL(JRBTreeFindNodeByKeyInline(tree, &key));
+
+	EXPECT_NUM_EQUAL(DeleteJRBTree(&tree), DeleteSuccess, int);
+})
+
+TEST(RBTree_INT, InsertHintAndFindFrom, {
+	JRBTreePtr tree = NewJRBTree(IntType);
+	int keys[1000];
+	int keyIndex = 0;
+	JNodePtr hint = NULL;
+
+	// 거의 정렬된 순서로 추가하면서 방금 추가한 노드를 다음 hint 로 사용한다.
+	for( ; keyIndex < 1000; keyIndex++)
+	{
+		keys[keyIndex] = (keyIndex % 10 == 9) ? keyIndex * 10 - 95 : keyIndex * 10;
+		hint = JRBTreeInsertHint(tree, &keys[keyIndex], hint);
+		EXPECT_PTR_EQUAL(JNodeGetKey(hint), &keys[keyIndex]);
+	}
+	EXPECT_NUM_EQUAL((int)JRBTreeSize(tree), 1000, int);
+	EXPECT_NULL(JRBTreeInsertHint(tree, &keys[500], hint));
+	EXPECT_NULL(JRBTreeInsertHint(NULL, &keys[0], NULL));
+
+	// 정렬 순서와 높이 확인
+	int *previousKey = NULL;
+	JNodePtr node = JRBTreeMin(tree);
+	for( ; node != NULL; node = JNodeGetNext(node))
+	{
+		if(previousKey != NULL)
+		{
+			EXPECT_NUM_GREATER_THAN(*((int*)node->key), *previousKey, int);
+		}
+		previousKey = (int*)node->key;
+	}
+	JRBTreeStats stats;
+	JRBTreeGetStats(tree, &stats);
+	EXPECT_NUM_LESS_EQUAL(stats.height, 20, int);
+
+	// 임의의 노드부터 검색해도 같은 결과
+	hint = JRBTreeFindNodeByKey(tree, &keys[123]);
+	EXPECT_PTR_EQUAL(JRBTreeFindFrom(tree, hint, &keys[124]), JRBTreeFindNodeByKey(tree, &keys[124]));
+	EXPECT_PTR_EQUAL(JRBTreeFindFrom(tree, hint, &keys[998]), JRBTreeMax(tree));
+	EXPECT_PTR_EQUAL(JRBTreeFindFrom(tree, hint, &keys[9]), JRBTreeMin(tree));
+	EXPECT_PTR_EQUAL(JRBTreeFindFrom(tree, NULL, &keys[7]), JRBTreeFindNodeByKey(tree, &keys[7]));
+	int missKey = 15;
+	EXPECT_NULL(JRBTreeFindFrom(tree, hint, &missKey));
+	EXPECT_NULL(JRBTreeFindFrom(NULL, hint, &keys[0]));
+
+	DeleteJRBTree(&tree);
+})
+
+TEST(RBTree_INT, InsertHintEqualValues, {
+	// 값이 같은 키가 많아도 hint 를 사용한 추가/검색은 루트 노드부터 할 때와 결과가 같아야 한다.
+	int keys[64];
+	int trial = 0;
+	int insertMismatchCount = 0;
+	int findMismatchCount = 0;
+	int ownedMismatchCount = 0;
+	int multisetOrderErrorCount = 0;
+	srand(36);
+	for( ; trial < 200; trial++)
+	{
+		int keyIndex = 0;
+		for( ; keyIndex < 64; keyIndex++) keys[keyIndex] = rand() % 8;
+
+		JRBTreePtr tree = NewJRBTree(IntType);
+		JRBTreePtr hintTree = NewJRBTree(IntType);
+		JRBTreePtr ownedTree = NewJRBTreeOwned(IntType);
+		JRBTreePtr ownedHintTree = NewJRBTreeOwned(IntType);
+		JRBTreePtr multisetTree = NewJRBTreeMultiset(IntType);
+
+		int step = 0;
+		for( ; step < 100; step++)
+		{
+			// 같은 키 주소를 다시 추가하면 둘 다 거부해야 한다.
+			int *key = &keys[rand() % 64];
+			int inserted = (JRBTreeInsertNode(tree, key) != NULL);
+			if(inserted != (JRBTreeInsertHint(hintTree, key, GetRandomNode(hintTree)) != NULL)) insertMismatchCount++;
+
+			// 키를 복사해서 저장하는 트리는 같은 값을 거부해야 한다.
+			int value = rand() % 30;
+			inserted = (JRBTreeInsertNode(ownedTree, &value) != NULL);
+			if(inserted != (JRBTreeInsertHint(ownedHintTree, &value, GetRandomNode(ownedHintTree)) != NULL)) ownedMismatchCount++;
+
+			// multiset 은 같은 키 주소를 다시 추가해도 같은 값의 키 중 가장 뒤에 추가해야 한다.
+			JNodePtr newNode = JRBTreeInsertHint(multisetTree, key, GetRandomNode(multisetTree));
+			JNodePtr nextNode = JNodeGetNext(newNode);
+			if(nextNode != NULL && *((int*)JNodeGetKey(nextNode)) == *key) multisetOrderErrorCount++;
+
+			key = &keys[rand() % 64];
+			if(JRBTreeFindFrom(tree, GetRandomNode(tree), key) != JRBTreeFindNodeByKey(tree, key)) findMismatchCount++;
+		}
+		if((int)JRBTreeSize(tree) != (int)JRBTreeSize(hintTree)) insertMismatchCount++;
+		if((int)JRBTreeSize(ownedTree) != (int)JRBTreeSize(ownedHintTree)) ownedMismatchCount++;
+
+		DeleteJRBTree(&tree);
+		DeleteJRBTree(&hintTree);
+		DeleteJRBTree(&ownedTree);
+		DeleteJRBTree(&ownedHintTree);
+		DeleteJRBTree(&multisetTree);
+	}
+	EXPECT_NUM_EQUAL(insertMismatchCount, 0, int);
+	EXPECT_NUM_EQUAL(findMismatchCount, 0, int);
+	EXPECT_NUM_EQUAL(ownedMismatchCount, 0, int);
+	EXPECT_NUM_EQUAL(multisetOrderErrorCount, 0, int);
+})
+
+TEST(Multiset_INT, CountAndEqualRange, {
+	JRBTreePtr tree = NewJRBTreeMultiset(IntType);
+	EXPECT_NOT_NULL(tree);
+
+	// 같은 값(5)의 키 10 개와 다른 값의 키를 섞어서 추가한다.
+	int keys[30];
+	int keyIndex = 0;
+	for( ; keyIndex < 30; keyIndex++)
+	{
+		keys[keyIndex] = (keyIndex % 3 == 0) ? 5 : keyIndex;
+		EXPECT_NOT_NULL(JRBTreeInsertNode(tree, &keys[keyIndex]));
+	}
+	EXPECT_NUM_EQUAL((int)JRBTreeSize(tree), 30, int);
+
+	int key = 5;
+	EXPECT_NUM_EQUAL((int)JRBTreeCount(tree, &key), 11, int);
+
+	// 같은 값의 노드들은 추가한 순서대로 방문한다. (keys[5] 도 값이 5)
+	JNodePtr end = NULL;
+	JNodePtr node = JRBTreeEqualRange(tree, &key, &end);
+	int visitCount = 0;
+	int *previousKey = NULL;
+	for( ; node != end; node = JNodeGetNext(node))
+	{
+		EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(node)), 5, int);
+		EXPECT_NUM_EQUAL((previousKey == NULL) || ((int*)node->key > previousKey), 1, int);
+		previousKey = (int*)node->key;
+		visitCount++;
+	}
+	EXPECT_NUM_EQUAL(visitCount, 11, int);
+
+	// 같은 값이어도 키 주소로 검색하고 삭제한다.
+	EXPECT_PTR_EQUAL(JNodeGetKey(JRBTreeFindNodeByKey(tree, &keys[27])), &keys[27]);
+	EXPECT_NUM_EQUAL(JRBTreeDeleteNodeByKey(tree, &keys[27]), DeleteSuccess, int);
+	EXPECT_NULL(JRBTreeFindNodeByKey(tree, &keys[27]));
+	EXPECT_NUM_EQUAL((int)JRBTreeCount(tree, &key), 10, int);
+
+	// 같은 키 주소도 다시 추가할 수 있다.
+	EXPECT_NOT_NULL(JRBTreeInsertNode(tree, &keys[0]));
+	EXPECT_NUM_EQUAL((int)JRBTreeCount(tree, &key), 11, int);
+
+	key = 100;
+	EXPECT_NUM_EQUAL((int)JRBTreeCount(tree, &key), 0, int);
+	EXPECT_PTR_EQUAL(JRBTreeEqualRange(tree, &key, &end), end);
+
+	DeleteJRBTree(&tree);
+})
+
+TEST(Multiset_INT, FindNodeByKeyInline, {
+	JRBTreePtr tree = NewJRBTreeMultiset(IntType);
+
+	// 같은 값의 키가 여러 서브 트리에 흩어지도록 많은 키를 추가한다.
+	int keys[100];
+	int keyIndex = 0;
+	for( ; keyIndex < 100; keyIndex++)
+	{
+		keys[keyIndex] = keyIndex % 3;
+		JRBTreeInsertNode(tree, &keys[keyIndex]);
+	}
+
+	// 같은 값의 키가 많아도 인라인 검색은 키 주소가 같은 노드를 찾는다.
+	int missCount = 0;
+	for(keyIndex = 0; keyIndex < 100; keyIndex++)
+	{
+		if(JNodeGetKey(JRBTreeFindNodeByKeyInline(tree, &keys[keyIndex])) != &keys[keyIndex]) missCount++;
+	}
+	EXPECT_NUM_EQUAL(missCount, 0, int);
+
+	EXPECT_NUM_EQUAL(JRBTreeDeleteNodeByKey(tree, &keys[50]), DeleteSuccess, int);
+	EXPECT_NULL(JRBTreeFindNodeByKeyInline(tree, &keys[50]));
+
+	DeleteJRBTree(&tree);
+})
+
+TEST(Gen_INT, InsertFindDelete, {
+	IntMapPtr map = NewIntMap();
+	EXPECT_NOT_NULL(map);
+	EXPECT_NULL(IntMapInsert(NULL, 1, 1));
+	EXPECT_NULL(IntMapFind(map, 1));
+
+	int key = 0;
+	for( ; key < 1000; key++)
+	{
+		EXPECT_NOT_NULL(IntMapInsert(map, (key * 7) % 1000, key));
+	}
+	EXPECT_NUM_EQUAL((int)IntMapSize(map), 1000, int);
+
+	// 같은 키는 추가되지 않는다. (값으로 비교)
+	EXPECT_NULL(IntMapInsert(map, 7, 0));
+	EXPECT_NUM_EQUAL(IntMapFind(map, 7)->value, 1, int);
+	EXPECT_NUM_EQUAL(IntMapMin(map)->key, 0, int);
+	EXPECT_NUM_EQUAL(IntMapMax(map)->key, 999, int);
+
+	// 짝수 키 삭제 후 정렬 순서 확인
+	for(key = 0; key < 1000; key += 2)
+	{
+		EXPECT_NUM_EQUAL(IntMapDelete(map, key), DeleteSuccess, int);
+	}
+	EXPECT_NUM_EQUAL(IntMapDelete(map, 0), DeleteFail, int);
+	EXPECT_NUM_EQUAL((int)IntMapSize(map), 500, int);
+
+	int expected = 1;
+	IntMapNodePtr node = IntMapMin(map);
+	for( ; node != NULL; node = IntMapNext(node))
+	{
+		EXPECT_NUM_EQUAL(node->key, expected, int);
+		expected += 2;
+	}
+	EXPECT_NUM_EQUAL(expected, 1001, int);
+
+	EXPECT_NUM_EQUAL(DeleteIntMap(&map), DeleteSuccess, int);
+	EXPECT_NULL(map);
+	EXPECT_NUM_EQUAL(DeleteIntMap(&map), DeleteFail, int);
+})
+
+TEST(Intrusive_INT, InsertFindRemove, {
+	TestTask tasks[200];
+	JRBTreeIntrusive byId;
+	JRBTreeIntrusive byDeadline;
+	EXPECT_PTR_EQUAL(JRBTreeIntrusiveInit(&byId, CompareTaskById), &byId);
+	EXPECT_PTR_EQUAL(JRBTreeIntrusiveInit(&byDeadline, CompareTaskByDeadline), &byDeadline);
+	EXPECT_NULL(JRBTreeIntrusiveInit(NULL, CompareTaskById));
+
+	int taskIndex = 0;
+	for( ; taskIndex < 200; taskIndex++)
+	{
+		tasks[taskIndex].id = (taskIndex * 37) % 200;
+		tasks[taskIndex].deadline = 1000 - tasks[taskIndex].id * 3;
+		EXPECT_PTR_EQUAL(JRBTreeIntrusiveInsert(&byId, &tasks[taskIndex].byId), &tasks[taskIndex].byId);
+		EXPECT_PTR_EQUAL(JRBTreeIntrusiveInsert(&byDeadline, &tasks[taskIndex].byDeadline), &tasks[taskIndex].byDeadline);
+	}
+	EXPECT_NUM_EQUAL((int)byId.size, 200, int);
+	EXPECT_NUM_EQUAL((int)byDeadline.size, 200, int);
+
+	// 비교 함수 결과가 0 인 객체는 추가하지 않는다.
+	TestTask duplicate;
+	duplicate.id = 10;
+	EXPECT_NULL(JRBTreeIntrusiveInsert(&byId, &duplicate.byId));
+	EXPECT_NUM_EQUAL((int)byId.size, 200, int);
+
+	// 같은 객체가 두 트리에서 서로 다른 순서로 순회된다.
+	int expected = 0;
+	JRBTreeLinkPtr link = JRBTreeIntrusiveFirst(&byId);
+	for( ; link != NULL; link = JRBTreeLinkGetNext(link))
+	{
+		EXPECT_NUM_EQUAL(JRBTREE_CONTAINER_OF(link, TestTask, byId)->id, expected, int);
+		expected++;
+	}
+	EXPECT_NUM_EQUAL(expected, 200, int);
+
+	expected = 0;
+	link = JRBTreeIntrusiveLast(&byDeadline);
+	for( ; link != NULL; link = JRBTreeLinkGetPrevious(link))
+	{
+		EXPECT_NUM_EQUAL(JRBTREE_CONTAINER_OF(link, TestTask, byDeadline)->id, expected, int);
+		expected++;
+	}
+	EXPECT_NUM_EQUAL(expected, 200, int);
+
+	int id = 74;
+	link = JRBTreeIntrusiveFind(&byId, &id, CompareIdWithTask);
+	EXPECT_NUM_EQUAL(JRBTREE_CONTAINER_OF(link, TestTask, byId)->id, 74, int);
+
+	// 한 트리에서 분리해도 다른 트리에는 남아 있다.
+	for(taskIndex = 0; taskIndex < 200; taskIndex += 2)
+	{
+		EXPECT_NUM_EQUAL(JRBTreeIntrusiveRemove(&byId, &tasks[taskIndex].byId), DeleteSuccess, int);
+		EXPECT_NULL(tasks[taskIndex].byId.parent);
+	}
+	EXPECT_NUM_EQUAL((int)byId.size, 100, int);
+	EXPECT_NUM_EQUAL((int)byDeadline.size, 200, int);
+	for(taskIndex = 0; taskIndex < 200; taskIndex++)
+	{
+		link = JRBTreeIntrusiveFind(&byId, &tasks[taskIndex].id, CompareIdWithTask);
+		if(taskIndex % 2 == 0) { EXPECT_NULL(link); }
+		else { EXPECT_PTR_EQUAL(link, &tasks[taskIndex].byId); }
+	}
+
+	expected = -1;
+	for(link = JRBTreeIntrusiveFirst(&byId); link != NULL; link = JRBTreeLinkGetNext(link))
+	{
+		EXPECT_NUM_GREATER_THAN(JRBTREE_CONTAINER_OF(link, TestTask, byId)->id, expected, int);
+		expected = JRBTREE_CONTAINER_OF(link, TestTask, byId)->id;
+	}
+
+	for(taskIndex = 1; taskIndex < 200; taskIndex += 2)
+	{
+		EXPECT_NUM_EQUAL(JRBTreeIntrusiveRemove(&byId, &tasks[taskIndex].byId), DeleteSuccess, int);
+	}
+	EXPECT_NULL(byId.root);
+	EXPECT_NULL(JRBTreeIntrusiveFirst(&byId));
+	EXPECT_NUM_EQUAL(JRBTreeIntrusiveRemove(&byId, &tasks[0].byId), DeleteFail, int);
+})
+
+TEST(BPlus_INT, EngineMatchesRBTree, {
+	EXPECT_NULL(NewJRBTreeWithEngine(IntType, (JRBTreeEngine)0));
+
+	JRBTreePtr bplusTree = NewJRBTreeWithEngine(IntType, EngineBPlus);
+	JRBTreePtr redBlackTree = NewJRBTreeWithEngine(IntType, EngineRedBlack);
+	EXPECT_NOT_NULL(bplusTree->bplus);
+	EXPECT_NULL(redBlackTree->bplus);
+
+	// 여러 번 나눠지도록 섞인 순서로 1000 개를 추가한다.
+	int keys[1000];
+	int keyIndex = 0;
+	for( ; keyIndex < 1000; keyIndex++)
+	{
+		keys[keyIndex] = (keyIndex * 389) % 1000;
+		EXPECT_PTR_EQUAL(JRBTreeInsertNode(bplusTree, &keys[keyIndex]), bplusTree);
+		JRBTreeInsertNode(redBlackTree, &keys[keyIndex]);
+	}
+	EXPECT_NULL(JRBTreeInsertNode(bplusTree, &keys[10]));
+	EXPECT_NUM_EQUAL((int)JRBTreeSize(bplusTree), 1000, int);
+
+	JRBTreeStats stats;
+	JRBTreeGetStats(bplusTree, &stats);
+	EXPECT_NUM_EQUAL((int)stats.nodeCount, 1000, int);
+	EXPECT_NUM_LESS_THAN(stats.height, 5, int);
+
+	for(keyIndex = 0; keyIndex < 1000; keyIndex++)
+	{
+		EXPECT_PTR_EQUAL(JNodeGetKey(JRBTreeFindNodeByKey(bplusTree, &keys[keyIndex])), &keys[keyIndex]);
+	}
+	int key = 500;
+	EXPECT_NULL(JRBTreeFindNodeByKey(bplusTree, &key));
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JRBTreeLowerBound(bplusTree, &key))), 500, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JRBTreeUpperBound(bplusTree, &key))), 501, int);
+
+	// 짝수 값을 삭제한 후에도 JNodeGetNext 순회 결과가 RB Tree 엔진과 같아야 한다.
+	for(keyIndex = 0; keyIndex < 1000; keyIndex++)
+	{
+		if(keys[keyIndex] % 2 != 0) continue;
+		EXPECT_NUM_EQUAL(JRBTreeDeleteNodeByKey(bplusTree, &keys[keyIndex]), DeleteSuccess, int);
+		JRBTreeDeleteNodeByKey(redBlackTree, &keys[keyIndex]);
+	}
+	EXPECT_NUM_EQUAL(JRBTreeDeleteNodeByKey(bplusTree, &keys[0]), DeleteFail, int);
+
+	JNodePtr bplusNode = JRBTreeMin(bplusTree);
+	JNodePtr redBlackNode = JRBTreeMin(redBlackTree);
+	int visitCount = 0;
+	for( ; bplusNode != NULL && redBlackNode != NULL; bplusNode = JNodeGetNext(bplusNode), redBlackNode = JNodeGetNext(redBlackNode))
+	{
+		EXPECT_PTR_EQUAL(JNodeGetKey(bplusNode), JNodeGetKey(redBlackNode));
+		visitCount++;
+	}
+	EXPECT_NULL(bplusNode);
+	EXPECT_NUM_EQUAL(visitCount, 500, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JNodeGetPrevious(JRBTreeMax(bplusTree)))), 997, int);
+
+	// 범위 삭제와 최소 키 꺼내기도 같은 결과를 반환한다.
+	key = 100;
+	int hi = 900;
+	EXPECT_NUM_EQUAL((int)JRBTreeDeleteRange(bplusTree, &key, &hi), 400, int);
+	EXPECT_NUM_EQUAL(*((int*)JRBTreePopMin(bplusTree)), 1, int);
+	EXPECT_NUM_EQUAL((int)JRBTreeSize(bplusTree), 99, int);
+	while(JRBTreePopMin(bplusTree) != NULL);
+	EXPECT_NULL(JRBTreeMin(bplusTree));
+	JRBTreeGetStats(bplusTree, &stats);
+	EXPECT_NUM_EQUAL(stats.height, 0, int);
+
+	DeleteJRBTree(&bplusTree);
+	DeleteJRBTree(&redBlackTree);
+})
+
+TEST(HotCache_INT, FindAndInvalidate, {
+	JRBTreePtr ownedTree = NewJRBTreeOwned(IntType);
+	EXPECT_NULL(JRBTreeSetHotCache(ownedTree, 64));
+	EXPECT_NULL(JRBTreeSetHotCache(NULL, 64));
+	DeleteJRBTree(&ownedTree);
+
+	JRBTreePtr tree = NewJRBTree(IntType);
+	int keys[1000];
+	int keyIndex = 0;
+	for( ; keyIndex < 1000; keyIndex++)
+	{
+		keys[keyIndex] = (keyIndex * 389) % 1000;
+		JRBTreeInsertNode(tree, &keys[keyIndex]);
+	}
+
+	JRBTreeStats stats;
+	JRBTreeGetStats(tree, &stats);
+	size_t allocatedBytes = stats.allocatedBytes;
+	EXPECT_PTR_EQUAL(JRBTreeSetHotCache(tree, 100), tree);
+	JRBTreeGetStats(tree, &stats);
+	EXPECT_NUM_GREATER_EQUAL((int)(stats.allocatedBytes - allocatedBytes), (int)(128 * 2 * sizeof(void*)), int);
+
+	// 두 번째 검색은 캐시에서 찾으므로 같은 노드를 반환해야 한다.
+	int repeat = 0;
+	for( ; repeat < 2; repeat++)
+	{
+		for(keyIndex = 0; keyIndex < 1000; keyIndex++)
+		{
+			EXPECT_PTR_EQUAL(JNodeGetKey(JRBTreeFindNodeByKey(tree, &keys[keyIndex])), &keys[keyIndex]);
+		}
+	}
+	int key = 500;
+	EXPECT_NULL(JRBTreeFindNodeByKey(tree, &key));
+
+	// 삭제된 노드는 캐시에 남아 있어도 반환하지 않는다.
+	for(keyIndex = 0; keyIndex < 1000; keyIndex += 2)
+	{
+		EXPECT_NUM_EQUAL(JRBTreeDeleteNodeByKey(tree, &keys[keyIndex]), DeleteSuccess, int);
+	}
+	for(keyIndex = 0; keyIndex < 1000; keyIndex++)
+	{
+		if(keyIndex % 2 == 0) { EXPECT_NULL(JRBTreeFindNodeByKey(tree, &keys[keyIndex])); }
+		else { EXPECT_PTR_EQUAL(JNodeGetKey(JRBTreeFindNodeByKey(tree, &keys[keyIndex])), &keys[keyIndex]); }
+	}
+
+	// 범위 삭제로 한 번에 해제한 노드도 반환하지 않는다.
+	key = 0;
+	int hi = 500;
+	EXPECT_NUM_EQUAL((int)JRBTreeDeleteRange(tree, &key, &hi), 250, int);
+	for(keyIndex = 1; keyIndex < 1000; keyIndex += 2)
+	{
+		if(keys[keyIndex] < 500) { EXPECT_NULL(JRBTreeFindNodeByKey(tree, &keys[keyIndex])); }
+		else { EXPECT_NOT_NULL(JRBTreeFindNodeByKey(tree, &keys[keyIndex])); }
+	}
+
+	// 캐시를 꺼도 검색 결과는 같다.
+	EXPECT_PTR_EQUAL(JRBTreeSetHotCache(tree, 0), tree);
+	JRBTreeGetStats(tree, &stats);
+	EXPECT_NUM_EQUAL((int)stats.nodeCount, 250, int);
+	EXPECT_NUM_EQUAL((int)JRBTreeSize(tree), 250, int);
+	EXPECT_NOT_NULL(JRBTreeFindNodeByKey(tree, &keys[999]));
+
+	EXPECT_NUM_EQUAL(DeleteJRBTree(&tree), DeleteSuccess, int);
+})
+
+TEST(HashIndex_INT, FindAndSync, {
+	EXPECT_NULL(JRBTreeSetHashIndex(NULL, 1));
+
+	JRBTreePtr tree = NewJRBTree(IntType);
+	int keys[2000];
+	int keyIndex = 0;
+	for( ; keyIndex < 2000; keyIndex++) keys[keyIndex] = (keyIndex * 389) % 2000;
+	for(keyIndex = 0; keyIndex < 1000; keyIndex++) JRBTreeInsertNode(tree, &keys[keyIndex]);
+
+	// 이미 있는 노드로 색인을 만들고, 이후 추가한 노드는 색인을 늘리면서 추가한다.
+	JRBTreeStats stats;
+	JRBTreeGetStats(tree, &stats);
+	size_t allocatedBytes = stats.allocatedBytes;
+	EXPECT_PTR_EQUAL(JRBTreeSetHashIndex(tree, 1), tree);
+	EXPECT_PTR_EQUAL(JRBTreeSetHashIndex(tree, 1), tree);
+	JRBTreeGetStats(tree, &stats);
+	EXPECT_NUM_GREATER_EQUAL((int)(stats.allocatedBytes - allocatedBytes), (int)(2048 * 2 * sizeof(void*)), int);
+	for(keyIndex = 1000; keyIndex < 2000; keyIndex++) JRBTreeInsertNode(tree, &keys[keyIndex]);
+
+	for(keyIndex = 0; keyIndex < 2000; keyIndex++)
+	{
+		EXPECT_PTR_EQUAL(JNodeGetKey(JRBTreeFindNodeByKey(tree, &keys[keyIndex])), &keys[keyIndex]);
+	}
+	// 값이 같아도 키 주소가 다르면 찾지 않는다. (색인이 없을 때와 같음)
+	int key = keys[10];
+	EXPECT_NULL(JRBTreeFindNodeByKey(tree, &key));
+
+	// 삭제한 노드는 색인에서도 삭제되고, 남은 노드는 계속 찾는다.
+	for(keyIndex = 0; keyIndex < 2000; keyIndex += 2)
+	{
+		EXPECT_NUM_EQUAL(JRBTreeDeleteNodeByKey(tree, &keys[keyIndex]), DeleteSuccess, int);
+	}
+	key = 0;
+	int hi = 1000;
+	int expectedCount = 0;
+	for(keyIndex = 1; keyIndex < 2000; keyIndex += 2) expectedCount += (keys[keyIndex] < hi) ? 1 : 0;
+	EXPECT_NUM_EQUAL((int)JRBTreeDeleteRange(tree, &key, &hi), expectedCount, int);
+	for(keyIndex = 0; keyIndex < 2000; keyIndex++)
+	{
+		if(keyIndex % 2 == 0 || keys[keyIndex] < hi) { EXPECT_NULL(JRBTreeFindNodeByKey(tree, &keys[keyIndex])); }
+		else { EXPECT_PTR_EQUAL(JNodeGetKey(JRBTreeFindNodeByKey(tree, &keys[keyIndex])), &keys[keyIndex]); }
+	}
+	EXPECT_PTR_EQUAL(JRBTreeSetHashIndex(tree, 0), tree);
+	EXPECT_NOT_NULL(JRBTreeFindNodeByKey(tree, &keys[1999]));
+	DeleteJRBTree(&tree);
+
+	// 키를 복사해서 저장하는 트리는 값으로 찾고, multiset 은 같은 값의 키를 키 주소로 구분한다.
+	JRBTreePtr ownedTree = NewJRBTreeOwned(IntType);
+	JRBTreeSetHashIndex(ownedTree, 1);
+	for(keyIndex = 0; keyIndex < 100; keyIndex++) JRBTreeInsertNode(ownedTree, &keys[keyIndex]);
+	key = keys[50];
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JRBTreeFindNodeByKey(ownedTree, &key))), keys[50], int);
+	EXPECT_NUM_EQUAL(JRBTreeDeleteNodeByKey(ownedTree, &key), DeleteSuccess, int);
+	EXPECT_NULL(JRBTreeFindNodeByKey(ownedTree, &key));
+	DeleteJRBTree(&ownedTree);
+
+	JRBTreePtr multisetTree = NewJRBTreeMultiset(IntType);
+	int sameKeys[100];
+	for(keyIndex = 0; keyIndex < 100; keyIndex++)
+	{
+		sameKeys[keyIndex] = keyIndex % 3;
+		JRBTreeInsertNode(multisetTree, &sameKeys[keyIndex]);
+	}
+	JRBTreeSetHashIndex(multisetTree, 1);
+	for(keyIndex = 0; keyIndex < 100; keyIndex++)
+	{
+		EXPECT_PTR_EQUAL(JNodeGetKey(JRBTreeFindNodeByKey(multisetTree, &sameKeys[keyIndex])), &sameKeys[keyIndex]);
+	}
+	EXPECT_NUM_EQUAL((int)JRBTreeCount(multisetTree, &sameKeys[0]), 34, int);
+	DeleteJRBTree(&multisetTree);
+})
+
+TEST(Radix_INT, OrderedAcrossSlots, {
+	EXPECT_NULL(NewJRBTreeRadix(10, 0, 4));
+	EXPECT_NULL(NewJRBTreeRadix(0, 999, 0));
+	EXPECT_NULL(NewJRBTreeRadix(0, 999, 64));
+
+	JRBTreePtr tree = NewJRBTreeRadix(0, 999, 6);
+	EXPECT_NOT_NULL(tree);
+
+	// 짝수 값만 섞인 순서로 추가하고, 범위 밖의 키도 양 끝 칸에 추가한다.
+	int keys[500];
+	int keyIndex = 0;
+	for( ; keyIndex < 500; keyIndex++)
+	{
+		keys[keyIndex] = ((keyIndex * 389) % 500) * 2;
+		EXPECT_PTR_EQUAL(JRBTreeInsertNode(tree, &keys[keyIndex]), tree);
+	}
+	int outsideKeys[2];
+	outsideKeys[0] = -50;
+	outsideKeys[1] = 5000;
+	EXPECT_PTR_EQUAL(JRBTreeInsertNode(tree, &outsideKeys[1]), tree);
+	EXPECT_NOT_NULL(JRBTreeInsertHint(tree, &outsideKeys[0], JRBTreeMin(tree)));
+	EXPECT_NULL(JRBTreeInsertNode(tree, &keys[10]));
+	EXPECT_NUM_EQUAL((int)JRBTreeSize(tree), 502, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JRBTreeMin(tree))), -50, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JRBTreeMax(tree))), 5000, int);
+
+	for(keyIndex = 0; keyIndex < 500; keyIndex++)
+	{
+		EXPECT_PTR_EQUAL(JNodeGetKey(JRBTreeFindNodeByKey(tree, &keys[keyIndex])), &keys[keyIndex]);
+	}
+	EXPECT_PTR_EQUAL(JNodeGetKey(JRBTreeFindFrom(tree, JRBTreeMax(tree), &outsideKeys[0])), &outsideKeys[0]);
+	int key = 501;
+	EXPECT_NULL(JRBTreeFindNodeByKey(tree, &key));
+
+	// 칸을 넘어서 키 순서로 순회한다.
+	JNodePtr node = JRBTreeMin(tree);
+	int previousValue = -1000;
+	int visitCount = 0;
+	for( ; node != NULL; node = JNodeGetNext(node))
+	{
+		EXPECT_NUM_GREATER_THAN(*((int*)JNodeGetKey(node)), previousValue, int);
+		previousValue = *((int*)JNodeGetKey(node));
+		visitCount++;
+	}
+	EXPECT_NUM_EQUAL(visitCount, 502, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JNodeGetPrevious(JRBTreeMax(tree)))), 998, int);
+
+	// 500 ~ 899 를 지워서 빈 칸을 만들어도 bound 는 다음 칸에서 찾는다.
+	key = 500;
+	int hi = 900;
+	EXPECT_NUM_EQUAL((int)JRBTreeDeleteRange(tree, &key, &hi), 200, int);
+	key = 501;
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JRBTreeLowerBound(tree, &key))), 900, int);
+	key = 498;
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JRBTreeUpperBound(tree, &key))), 900, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JRBTreeLowerBound(tree, &key))), 498, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JNodeGetPrevious(JRBTreeFindNodeByKey(tree, &keys[0])))), -50, int);
+	key = 5001;
+	EXPECT_NULL(JRBTreeLowerBound(tree, &key));
+
+	// 최소, 최대 키를 지우면 다른 칸의 노드가 최소, 최대 키가 된다.
+	EXPECT_NUM_EQUAL(*((int*)JRBTreePopMin(tree)), -50, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JRBTreeMin(tree))), 0, int);
+	EXPECT_NUM_EQUAL(JRBTreeDeleteNodeByKey(tree, &outsideKeys[1]), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(JRBTreeMax(tree))), 998, int);
+
+	JRBTreeStats stats;
+	JRBTreeGetStats(tree, &stats);
+	EXPECT_NUM_EQUAL((int)stats.nodeCount, 300, int);
+	EXPECT_NUM_EQUAL((int)JRBTreeSize(tree), 300, int);
+	EXPECT_NUM_LESS_THAN(stats.height, 8, int);
+
+	EXPECT_NUM_EQUAL(DeleteJRBTree(&tree), DeleteSuccess, int);
+})
+
+TEST(Interval_INT, OverlapAndStab, {
+	JRBTreePtr plainTree = NewJRBTree(IntType);
+	EXPECT_NUM_EQUAL((int)JRBTreeIntervalStab(plainTree, 0, NULL, 0), 0, int);
+	DeleteJRBTree(&plainTree);
+
+	JRBTreePtr tree = NewJRBTreeInterval();
+	EXPECT_NOT_NULL(tree);
+
+	// 시작점이 같은 구간도 서로 다른 키 주소로 추가한다.
+	JRBTreeInterval intervals[300];
+	int index = 0;
+	for( ; index < 300; index++)
+	{
+		intervals[index].low = (index * 37) % 1000;
+		intervals[index].high = intervals[index].low + (index * 13) % 50;
+		EXPECT_PTR_EQUAL(JRBTreeInsertNode(tree, &intervals[index]), tree);
+	}
+
+	// 전체를 확인해서 센 개수와 같고, 시작점 순서로 반환되어야 한다.
+	JNodePtr nodes[300];
+	int round = 0;
+	for( ; round < 2; round++)
+	{
+		int queryLow = -10;
+		for( ; queryLow < 1100; queryLow += 23)
+		{
+			int queryHigh = queryLow + queryLow % 7;
+			int expectedCount = 0;
+			for(index = 0; index < 300; index++)
+			{
+				if(JRBTreeFindNodeByKey(tree, &intervals[index]) == NULL) continue;
+				if(intervals[index].low <= queryHigh && intervals[index].high >= queryLow) expectedCount++;
+			}
+
+			size_t count = JRBTreeIntervalFindOverlaps(tree, queryLow, queryHigh, nodes, 300);
+			EXPECT_NUM_EQUAL((int)count, expectedCount, int);
+			size_t nodeIndex = 0;
+			for( ; nodeIndex < count; nodeIndex++)
+			{
+				JRBTreeIntervalPtr interval = (JRBTreeIntervalPtr)JNodeGetKey(nodes[nodeIndex]);
+				EXPECT_NUM_LESS_EQUAL(interval->low, queryHigh, int);
+				EXPECT_NUM_GREATER_EQUAL(interval->high, queryLow, int);
+				if(nodeIndex > 0) { EXPECT_NUM_LESS_EQUAL(((JRBTreeIntervalPtr)JNodeGetKey(nodes[nodeIndex - 1]))->low, interval->low, int); }
+			}
+		}
+
+		// 삭제와 범위 삭제 후에도 최대 끝점이 맞아야 한다.
+		for(index = round; index < 300; index += 3)
+		{
+			if(JRBTreeFindNodeByKey(tree, &intervals[index]) == NULL) continue;
+			EXPECT_NUM_EQUAL(JRBTreeDeleteNodeByKey(tree, &intervals[index]), DeleteSuccess, int);
+		}
+		int lo = 400;
+		int hi = 600;
+		JRBTreeDeleteRange(tree, &lo, &hi);
+	}
+
+	// 저장할 배열이 작아도 전체 개수를 반환한다.
+	EXPECT_NUM_EQUAL((int)JRBTreeIntervalStab(tree, 5000, NULL, 0), 0, int);
+	size_t total = JRBTreeIntervalFindOverlaps(tree, 0, 2000, NULL, 0);
+	EXPECT_NUM_EQUAL((int)total, (int)JRBTreeSize(tree), int);
+	EXPECT_NUM_EQUAL((int)JRBTreeIntervalFindOverlaps(tree, 0, 2000, nodes, 2), (int)total, int);
+	EXPECT_PTR_EQUAL(nodes[0], JRBTreeMin(tree));
+
+	EXPECT_NUM_EQUAL(DeleteJRBTree(&tree), DeleteSuccess, int);
+})
+
+TEST(Augment_INT, RangeAggregate, {
+	EXPECT_NULL(NewJRBTreeAugmented(IntType, 0, CombineRecord));
+	EXPECT_NULL(NewJRBTreeAugmented(IntType, sizeof(TestAggregate), NULL));
+
+	JRBTreePtr tree = NewJRBTreeAugmented(IntType, sizeof(TestAggregate), CombineRecord);
+	EXPECT_NOT_NULL(tree);
+
+	TestRecord records[500];
+	int index = 0;
+	for( ; index < 500; index++)
+	{
+		records[index].key = (index * 389) % 500;
+		records[index].value = (index * 7919) % 1000 - 500;
+		EXPECT_PTR_EQUAL(JRBTreeInsertNode(tree, &records[index]), tree);
+	}
+
+	// 범위마다 키 순서로 하나씩 집계한 결과와 같아야 한다.
+	int round = 0;
+	for( ; round < 2; round++)
+	{
+		int lo = -20;
+		for( ; lo < 520; lo += 17)
+		{
+			int hi = lo + lo % 90;
+			TestAggregate expected;
+			memset(&expected, 0, sizeof(TestAggregate));
+			JNodePtr node = JRBTreeLowerBound(tree, &lo);
+			for( ; node != NULL && ((TestRecord*)JNodeGetKey(node))->key <= hi; node = JNodeGetNext(node))
+			{
+				int value = ((TestRecord*)JNodeGetKey(node))->value;
+				if(expected.count == 0 || value < expected.min) expected.min = value;
+				if(expected.count == 0 || value > expected.max) expected.max = value;
+				if(expected.count == 0) expected.first = value;
+				expected.sum += value;
+				expected.count++;
+			}
+
+			TestAggregate result;
+			memset(&result, 0, sizeof(TestAggregate));
+			EXPECT_NUM_EQUAL(JRBTreeRangeAggregate(tree, &lo, &hi, &result), (expected.count > 0) ? 1 : 0, int);
+			EXPECT_NUM_EQUAL(result.count, expected.count, int);
+			EXPECT_NUM_EQUAL((int)result.sum, (int)expected.sum, int);
+			EXPECT_NUM_EQUAL(result.min, expected.min, int);
+			EXPECT_NUM_EQUAL(result.max, expected.max, int);
+			EXPECT_NUM_EQUAL(result.first, expected.first, int);
+		}
+
+		// 삭제, 범위 삭제, 최소 키 꺼내기 후에도 집계 값이 맞아야 한다.
+		for(index = round; index < 500; index += 3)
+		{
+			if(JRBTreeFindNodeByKey(tree, &records[index]) == NULL) continue;
+			EXPECT_NUM_EQUAL(JRBTreeDeleteNodeByKey(tree, &records[index]), DeleteSuccess, int);
+		}
+		int rangeLo = 200;
+		int rangeHi = 260;
+		JRBTreeDeleteRange(tree, &rangeLo, &rangeHi);
+		EXPECT_NOT_NULL(JRBTreePopMin(tree));
+	}
+
+	// 전체 범위의 개수는 트리 크기와 같고, 거꾸로 된 범위는 비어 있다.
+	int lo = 0;
+	int hi = 499;
+	TestAggregate result;
+	EXPECT_NUM_EQUAL(JRBTreeRangeAggregate(tree, &lo, &hi, &result), 1, int);
+	EXPECT_NUM_EQUAL(result.count, (int)JRBTreeSize(tree), int);
+	EXPECT_NUM_EQUAL(JRBTreeRangeAggregate(tree, &hi, &lo, &result), 0, int);
+
+	EXPECT_NUM_EQUAL(DeleteJRBTree(&tree), DeleteSuccess, int);
+})
+
+TEST(Parallel_INT, ForEachAndReduce, {
+	int keys[TEST_PARALLEL_KEY_COUNT];
+	int index = 0;
+	for( ; index < TEST_PARALLEL_KEY_COUNT; index++) keys[index] = (index * 1187) % TEST_PARALLEL_KEY_COUNT;
+
+	TestVisit *visit = (TestVisit*)malloc(sizeof(TestVisit));
+	EXPECT_NOT_NULL(visit);
+
+	// RB Tree, B+ Tree 엔진, radix 표 트리 모두 같은 결과여야 한다.
+	int mode = 0;
+	for( ; mode < 3; mode++)
+	{
+		JRBTreePtr tree = NULL;
+		if(mode == 0) tree = NewJRBTree(IntType);
+		else if(mode == 1) tree = NewJRBTreeWithEngine(IntType, EngineBPlus);
+		else tree = NewJRBTreeRadix(0, TEST_PARALLEL_KEY_COUNT - 1, 6);
+		EXPECT_NOT_NULL(tree);
+
+		TestSequence sequence;
+		memset(&sequence, 0, sizeof(TestSequence));
+		sequence.ordered = 1;
+		EXPECT_NUM_EQUAL((int)JRBTreeParallelForEach(tree, VisitKey, visit, 4), 0, int);
+		EXPECT_NUM_EQUAL(JRBTreeParallelReduce(tree, ReduceSequence, MergeSequence, NULL, 4, sizeof(TestSequence), &sequence), 1, int);
+		EXPECT_NUM_EQUAL(sequence.count, 0, int);
+
+		for(index = 0; index < TEST_PARALLEL_KEY_COUNT; index++) JRBTreeInsertNode(tree, &keys[index]);
+
+		int threadCount = 0;
+		for( ; threadCount <= 8; threadCount += 3)
+		{
+			// 모든 키를 한 번씩 방문하고, 조각 번호는 키 순서를 따라야 한다.
+			memset(visit, 0, sizeof(TestVisit));
+			EXPECT_NUM_EQUAL((int)JRBTreeParallelForEach(tree, VisitKey, visit, threadCount), TEST_PARALLEL_KEY_COUNT, int);
+			for(index = 0; index < TEST_PARALLEL_KEY_COUNT; index++)
+			{
+				EXPECT_NUM_EQUAL(visit->visits[index], 1, int);
+				if(index > 0) { EXPECT_NUM_LESS_EQUAL((int)visit->chunks[index - 1], (int)visit->chunks[index], int); }
+			}
+			if(threadCount > 1) { EXPECT_NUM_GREATER_THAN((int)visit->chunks[TEST_PARALLEL_KEY_COUNT - 1], 0, int); }
+
+			// 조각의 누적 값을 키 순서로 합치므로 하나씩 누적한 결과와 같아야 한다.
+			memset(&sequence, 0, sizeof(TestSequence));
+			sequence.ordered = 1;
+			EXPECT_NUM_EQUAL(JRBTreeParallelReduce(tree, ReduceSequence, MergeSequence, NULL, threadCount, sizeof(TestSequence), &sequence), 1, int);
+			EXPECT_NUM_EQUAL(sequence.count, TEST_PARALLEL_KEY_COUNT, int);
+			EXPECT_NUM_EQUAL((int)sequence.sum, TEST_PARALLEL_KEY_COUNT * (TEST_PARALLEL_KEY_COUNT - 1) / 2, int);
+			EXPECT_NUM_EQUAL(sequence.first, 0, int);
+			EXPECT_NUM_EQUAL(sequence.last, TEST_PARALLEL_KEY_COUNT - 1, int);
+			EXPECT_NUM_EQUAL(sequence.ordered, 1, int);
+		}
+
+		EXPECT_NUM_EQUAL(DeleteJRBTree(&tree), DeleteSuccess, int);
+	}
+
+	EXPECT_NUM_EQUAL((int)JRBTreeParallelForEach(NULL, VisitKey, visit, 2), 0, int);
+	EXPECT_NUM_EQUAL(JRBTreeParallelReduce(NULL, ReduceSequence, MergeSequence, NULL, 2, sizeof(TestSequence), visit), 0, int);
+	free(visit);
+})
+
+TEST(Parallel_INT, BuildParallel, {
+	// 값마다 평균 두 번씩 나오는 키 배열 (같은 값은 처음 나온 키 주소만 남아야 한다)
+	int *values = (int*)malloc(sizeof(int) * 20000);
+	void **keys = (void**)malloc(sizeof(void*) * 20000);
+	int *firstIndexes = (int*)malloc(sizeof(int) * 10000);
+	EXPECT_NOT_NULL(values);
+	EXPECT_NOT_NULL(keys);
+	EXPECT_NOT_NULL(firstIndexes);
+
+	int uniqueCount = 0;
+	int index = 0;
+	for(index = 0; index < 10000; index++) firstIndexes[index] = -1;
+	for(index = 0; index < 20000; index++)
+	{
+		values[index] = (int)(((long long)index * 7919) % 20011) % 10000;
+		keys[index] = &values[index];
+		if(firstIndexes[values[index]] == -1)
+		{
+			firstIndexes[values[index]] = index;
+			uniqueCount++;
+		}
+	}
+
+	int threadCount = 0;
+	for( ; threadCount <= 8; threadCount += 2)
+	{
+		int count = (threadCount == 0) ? 20000 : 20000 / threadCount;
+		JRBTreePtr tree = JRBTreeBuildParallel(IntType, keys, (size_t)count, threadCount);
+		EXPECT_NOT_NULL(tree);
+		EXPECT_NUM_GREATER_THAN(CheckRedBlack(tree->root, NULL), 0, int);
+		EXPECT_NUM_EQUAL(tree->root->color, Black, int);
+
+		// 키 값 순서로 값마다 키 하나씩 있고, 앞부분 count 개 중 처음 나온 키 주소여야 한다.
+		int expectedCount = 0;
+		for(index = 0; index < 10000; index++)
+		{
+			if(firstIndexes[index] >= 0 && firstIndexes[index] < count) expectedCount++;
+		}
+		EXPECT_NUM_EQUAL((int)JRBTreeSize(tree), expectedCount, int);
+
+		int visitedCount = 0;
+		int previousValue = -1;
+		JNodePtr node = JRBTreeMin(tree);
+		for( ; node != NULL; node = JNodeGetNext(node), visitedCount++)
+		{
+			int *key = (int*)JNodeGetKey(node);
+			EXPECT_NUM_GREATER_THAN(*key, previousValue, int);
+			EXPECT_NUM_EQUAL((int)(key - values), firstIndexes[*key], int);
+			previousValue = *key;
+		}
+		EXPECT_NUM_EQUAL(visitedCount, expectedCount, int);
+
+		// 생성한 후에도 일반 트리처럼 검색, 삭제, 추가할 수 있어야 한다.
+		EXPECT_NOT_NULL(JRBTreeFindNodeByKey(tree, keys[0]));
+		EXPECT_NUM_EQUAL(JRBTreeDeleteNodeByKey(tree, keys[0]), DeleteSuccess, int);
+		EXPECT_NULL(JRBTreeFindNodeByKey(tree, keys[0]));
+		EXPECT_PTR_EQUAL(JRBTreeInsertNode(tree, keys[0]), tree);
+		EXPECT_NUM_GREATER_THAN(CheckRedBlack(tree->root, NULL), 0, int);
+		EXPECT_NUM_EQUAL((int)JRBTreeSize(tree), expectedCount, int);
+
+		EXPECT_NUM_EQUAL(DeleteJRBTree(&tree), DeleteSuccess, int);
+	}
+	EXPECT_NUM_GREATER_THAN(uniqueCount, 0, int);
+
+	// 빈 배열은 빈 트리, NULL 키가 있으면 실패
+	JRBTreePtr emptyTree = JRBTreeBuildParallel(IntType, keys, 0, 4);
+	EXPECT_NOT_NULL(emptyTree);
+	EXPECT_NUM_EQUAL((int)JRBTreeSize(emptyTree), 0, int);
+	EXPECT_NUM_EQUAL(DeleteJRBTree(&emptyTree), DeleteSuccess, int);
+	keys[15000] = NULL;
+	EXPECT_NULL(JRBTreeBuildParallel(IntType, keys, 20000, 4));
+	EXPECT_NULL(JRBTreeBuildParallel(IntType, NULL, 10, 4));
+
+	free(firstIndexes);
+	free(keys);
+	free(values);
+})
+
+TEST(Stats_INT, GetStats, {
+	JRBTreePtr tree = NewJRBTree(IntType);
+	JRBTreeStats stats;
+
+	EXPECT_NULL(JRBTreeGetStats(NULL, &stats));
+	EXPECT_NULL(JRBTreeGetStats(tree, NULL));
+
+	EXPECT_PTR_EQUAL(JRBTreeGetStats(tree, &stats), &stats);
+	EXPECT_NUM_EQUAL((int)stats.nodeCount, 0, int);
+	EXPECT_NUM_EQUAL(stats.height, 0, int);
+	EXPECT_NUM_EQUAL(stats.blackHeight, 0, int);
+
+	// 순서대로 추가해도 높이는 2 * log2(n + 1) 이하로 유지되어야 한다.
+	int keys[100];
+	int keyIndex = 0;
+	for( ; keyIndex < 100; keyIndex++)
+	{
+		keys[keyIndex] = keyIndex;
+		JRBTreeInsertNode(tree, &keys[keyIndex]);
+	}
+
+	JRBTreeGetStats(tree, &stats);
+	EXPECT_NUM_EQUAL((int)stats.nodeCount, 100, int);
+	EXPECT_NUM_GREATER_EQUAL(stats.height, 7, int);
+	EXPECT_NUM_LESS_EQUAL(stats.height, 13, int);
+	EXPECT_NUM_GREATER_EQUAL(stats.blackHeight, 4, int);
+	EXPECT_NUM_EQUAL((int)stats.allocatedBytes, (int)(sizeof(JRBTree) + 100 * sizeof(JNode)), int);
+
+	JRBTreeDeleteNodeByKey(tree, &keys[50]);
+	JRBTreeGetStats(tree, &stats);
+	EXPECT_NUM_EQUAL((int)stats.nodeCount, 99, int);
+
+	DeleteJRBTree(&tree);
+})
+
 // ---------- RB Tree char Test ----------
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -638,6 +2200,264 @@ TEST(RBTree_STRING, FindNodeByKey, {
 	DeleteJRBTree(&tree);
 })
 
+TEST(RBTree_STRING, FindNodeByKeyInline, {
+	JRBTreePtr tree = NewJRBTree(StringType);
+	char* expected1 = "apple";
+	char* expected2 = "app";
+	char* expected3 = "banana";
+	char* expected4 = "appl";
+
+	// 한 문자열이 다른 문자열의 앞부분인 경우도 짧은 문자열이 작다.
+	EXPECT_NOT_NULL(JRBTreeInsertNode(tree, expected1));
+	EXPECT_NOT_NULL(JRBTreeInsertNode(tree, expected2));
+	EXPECT_NOT_NULL(JRBTreeInsertNode(tree, expected3));
+
+	EXPECT_PTR_EQUAL(JRBTreeFindNodeByKeyInline(tree, expected1), JRBTreeFindNodeByKey(tree, expected1));
+	EXPECT_PTR_EQUAL(JRBTreeFindNodeByKeyInline(tree, expected2)->key, expected2);
+	EXPECT_PTR_EQUAL(JRBTreeFindNodeByKeyInline(tree, expected3)->key, expected3);
+	EXPECT_PTR_EQUAL(JNodeGetKey(JRBTreeMin(tree)), expected2);
+
+	EXPECT_NULL(JRBTreeFindNodeByKeyInline(tree, expected4));
+	EXPECT_NULL(JRBTreeFindNodeByKeyInline(NULL, expected1));
+	EXPECT_NULL(JRBTreeFindNodeByKeyInline(tree, NULL));
+
+	DeleteJRBTree(&tree);
+})
+
+TEST(Gen_STRING, InsertFindDelete, {
+	StringMapPtr map = NewStringMap();
+	char key[8];
+	strcpy(key, "Black");
+
+	EXPECT_NOT_NULL(StringMapInsert(map, "Red", 1));
+	EXPECT_NOT_NULL(StringMapInsert(map, "Black", 2));
+	EXPECT_NOT_NULL(StringMapInsert(map, "#define", 3));
+
+	// 주소가 아니라 문자열 내용으로 검색한다.
+	EXPECT_NOT_NULL(StringMapFind(map, key));
+	EXPECT_NUM_EQUAL(StringMapFind(map, key)->value, 2, int);
+	EXPECT_NULL(StringMapInsert(map, key, 4));
+	EXPECT_NUM_EQUAL(strcmp(StringMapMin(map)->key, "#define"), 0, int);
+
+	EXPECT_NUM_EQUAL(StringMapDelete(map, key), DeleteSuccess, int);
+	EXPECT_NULL(StringMapFind(map, key));
+	EXPECT_NUM_EQUAL((int)StringMapSize(map), 2, int);
+
+	DeleteStringMap(&map);
+})
+
+////////////////////////////////////////////////////////////////////////////////
+/// Snapshot Test (string)
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(RBTree_STRING, KeyDestructor, {
+	JRBTreePtr tree = NewJRBTree(StringType);
+	EXPECT_PTR_EQUAL(JRBTreeSetKeyDestructor(tree, DestroyKey), tree);
+	EXPECT_NULL(JRBTreeSetKeyDestructor(NULL, DestroyKey));
+
+	char buffer[16];
+	char *firstKey = NULL;
+	int keyIndex = 0;
+	for( ; keyIndex < 100; keyIndex++)
+	{
+		snprintf(buffer, sizeof(buffer), "key%03d", keyIndex);
+		char *key = strdup(buffer);
+		if(keyIndex == 0) firstKey = key;
+		JRBTreeInsertNode(tree, key);
+	}
+
+	destroyedKeyCount = 0;
+	EXPECT_NUM_EQUAL(JRBTreeDeleteNodeByKey(tree, firstKey), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(destroyedKeyCount, 1, int);
+
+	char lo[8];
+	char hi[8];
+	strcpy(lo, "key010");
+	strcpy(hi, "key020");
+	EXPECT_NUM_EQUAL((int)JRBTreeDeleteRange(tree, lo, hi), 10, int);
+	EXPECT_NUM_EQUAL(destroyedKeyCount, 11, int);
+
+	// 남은 키들은 트리를 삭제할 때 같이 해제된다.
+	EXPECT_NUM_EQUAL(DeleteJRBTree(&tree), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(destroyedKeyCount, 100, int);
+})
+
+TEST(Owned_STRING, CopyKeys, {
+	JRBTreePtr tree = NewJRBTreeOwned(StringType);
+	EXPECT_NOT_NULL(tree);
+	EXPECT_NULL(JRBTreeSetKeyDestructor(tree, DestroyKey));
+
+	// 같은 버퍼를 재사용해도 트리는 복사본을 저장한다.
+	char buffer[16];
+	int keyIndex = 0;
+	for( ; keyIndex < 1000; keyIndex++)
+	{
+		snprintf(buffer, sizeof(buffer), "key%04d", keyIndex);
+		EXPECT_PTR_EQUAL(JRBTreeInsertNode(tree, buffer), tree);
+	}
+	EXPECT_NULL(JRBTreeInsertNode(tree, buffer));
+	EXPECT_NUM_EQUAL((int)JRBTreeSize(tree), 1000, int);
+
+	// 키 주소가 아니라 값으로 검색/삭제한다.
+	strcpy(buffer, "key0500");
+	JNodePtr node = JRBTreeFindNodeByKey(tree, buffer);
+	EXPECT_NOT_NULL(node);
+	if(node != NULL)
+	{
+		EXPECT_PTR_NOT_EQUAL(JNodeGetKey(node), buffer);
+		EXPECT_NUM_EQUAL(strcmp((char*)JNodeGetKey(node), "key0500"), 0, int);
+	}
+	EXPECT_NUM_EQUAL(JRBTreeDeleteNodeByKey(tree, buffer), DeleteSuccess, int);
+	EXPECT_NULL(JRBTreeFindNodeByKey(tree, buffer));
+	EXPECT_NUM_EQUAL(strcmp((char*)JNodeGetKey(JRBTreeMin(tree)), "key0000"), 0, int);
+	EXPECT_NUM_EQUAL(strcmp((char*)JNodeGetKey(JRBTreeMax(tree)), "key0999"), 0, int);
+
+	// 삭제된 노드는 재사용된다.
+	JRBTreeStats stats;
+	JRBTreeGetStats(tree, &stats);
+	size_t allocatedBytes = stats.allocatedBytes;
+	EXPECT_PTR_EQUAL(JRBTreeInsertNode(tree, buffer), tree);
+	JRBTreeGetStats(tree, &stats);
+	EXPECT_NUM_EQUAL((int)stats.allocatedBytes, (int)allocatedBytes, int);
+	EXPECT_NUM_EQUAL((int)stats.nodeCount, 1000, int);
+
+	EXPECT_NUM_EQUAL(DeleteJRBTree(&tree), DeleteSuccess, int);
+})
+
+TEST(StringPool_STRING, Intern, {
+	JRBTreeStringPoolPtr pool = NewJRBTreeStringPool();
+	EXPECT_NOT_NULL(pool);
+
+	char buffer[64];
+	strcpy(buffer, "https://example.com/a");
+	char *first = JRBTreeStringPoolIntern(pool, buffer);
+	EXPECT_PTR_NOT_EQUAL(first, buffer);
+	strcpy(buffer, "https://example.com/b");
+	char *second = JRBTreeStringPoolIntern(pool, buffer);
+	strcpy(buffer, "https://example.com/a");
+	EXPECT_PTR_EQUAL(JRBTreeStringPoolIntern(pool, buffer), first);
+	EXPECT_NUM_EQUAL((int)JRBTreeStringPoolGetCount(pool), 2, int);
+	EXPECT_NULL(JRBTreeStringPoolIntern(NULL, buffer));
+
+	// 풀에서 받은 주소로 추가하면 같은 내용의 문자열로 검색할 수 있다.
+	JRBTreePtr tree = NewJRBTree(StringType);
+	JRBTreeInsertNode(tree, first);
+	JRBTreeInsertNode(tree, second);
+	EXPECT_NOT_NULL(JRBTreeFindNodeByKey(tree, JRBTreeStringPoolIntern(pool, buffer)));
+
+	int keyIndex = 0;
+	for( ; keyIndex < 1000; keyIndex++)
+	{
+		snprintf(buffer, sizeof(buffer), "https://example.com/%d", keyIndex % 100);
+		JRBTreeStringPoolIntern(pool, buffer);
+	}
+	EXPECT_NUM_EQUAL((int)JRBTreeStringPoolGetCount(pool), 102, int);
+
+	DeleteJRBTree(&tree);
+	EXPECT_NUM_EQUAL(DeleteJRBTreeStringPool(&pool), DeleteSuccess, int);
+	EXPECT_NULL(pool);
+})
+
+TEST(FrozenString_STRING, FindNodeByKey, {
+	JRBTreeStringPoolPtr pool = NewJRBTreeStringPool();
+	JRBTreePtr tree = NewJRBTree(StringType);
+	char buffer[64];
+	size_t rawBytes = 0;
+	int keyIndex = 0;
+	for( ; keyIndex < 1000; keyIndex++)
+	{
+		snprintf(buffer, sizeof(buffer), "https://example.com/catalog/%d/item/%d", keyIndex % 7, keyIndex);
+		JRBTreeInsertNode(tree, JRBTreeStringPoolIntern(pool, buffer));
+		rawBytes += strlen(buffer) + 1;
+	}
+
+	JRBTreeFrozenStringPtr frozen = NewJRBTreeFrozenString(tree);
+	EXPECT_NOT_NULL(frozen);
+	EXPECT_NUM_EQUAL((int)frozen->count, 1000, int);
+	EXPECT_NUM_LESS_EQUAL((int)frozen->dataSize, (int)(rawBytes / 2), int);
+
+	JNodePtr node = JRBTreeMin(tree);
+	for( ; node != NULL; node = JNodeGetNext(node))
+	{
+		EXPECT_PTR_EQUAL(JRBTreeFrozenStringFindNodeByKey(frozen, (char*)JNodeGetKey(node)), node);
+	}
+
+	EXPECT_NULL(JRBTreeFrozenStringFindNodeByKey(frozen, "https://example.com/catalog/3"));
+	EXPECT_NULL(JRBTreeFrozenStringFindNodeByKey(frozen, "https://example.com/catalog/3/item/999"));
+	EXPECT_NULL(JRBTreeFrozenStringFindNodeByKey(frozen, "a"));
+	EXPECT_NULL(JRBTreeFrozenStringFindNodeByKey(frozen, "zzz"));
+	EXPECT_NULL(JRBTreeFrozenStringFindNodeByKey(NULL, "a"));
+	EXPECT_NULL(NewJRBTreeFrozenString(NULL));
+
+	EXPECT_NUM_EQUAL(DeleteJRBTreeFrozenString(&frozen), DeleteSuccess, int);
+	DeleteJRBTree(&tree);
+	DeleteJRBTreeStringPool(&pool);
+})
+
+TEST(Snapshot_STRING, SaveAndLoadMapped, {
+	JRBTreePtr tree = NewJRBTree(StringType);
+	char *expected1 = "#define";
+	char *expected2 = "Black";
+	char *expected3 = "Red";
+	char *expected4 = "???";
+
+	JRBTreeInsertNode(tree, expected3);
+	JRBTreeInsertNode(tree, expected1);
+	JRBTreeInsertNode(tree, expected2);
+
+	char path[] = "/tmp/jrbtree_snapshot_XXXXXX";
+	int fd = mkstemp(path);
+	EXPECT_NUM_EQUAL(JRBTreeSave(tree, fd), SaveSuccess, int);
+	close(fd);
+
+	JRBTreeMappedPtr mapped = JRBTreeLoadMapped(path);
+	EXPECT_NOT_NULL(mapped);
+	EXPECT_NUM_EQUAL((int)(mapped->count), 3, int);
+	EXPECT_NUM_EQUAL(JRBTreeMappedVerify(mapped), 1, int);
+
+	EXPECT_NUM_EQUAL(strcmp((const char*)JRBTreeMappedGetKey(mapped, 0), expected1), 0, int);
+	EXPECT_NUM_EQUAL(strcmp((const char*)JRBTreeMappedGetKey(mapped, 1), expected2), 0, int);
+	EXPECT_NUM_EQUAL(strcmp((const char*)JRBTreeMappedGetKey(mapped, 2), expected3), 0, int);
+
+	EXPECT_NUM_EQUAL(strcmp((const char*)JRBTreeMappedFindKey(mapped, expected2), expected2), 0, int);
+	EXPECT_NUM_EQUAL(strcmp((const char*)JRBTreeMappedFindKey(mapped, expected3), expected3), 0, int);
+	EXPECT_NUM_EQUAL(JRBTreeMappedFindKey(mapped, expected4) == NULL, 1, int);
+
+	DeleteJRBTreeMapped(&mapped);
+	unlink(path);
+	DeleteJRBTree(&tree);
+})
+
+////////////////////////////////////////////////////////////////////////////////
+/// Export Test (string)
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(Export_STRING, ExportToFd, {
+	JRBTreePtr tree = NewJRBTree(StringType);
+	char *expected1 = "#define";
+	char *expected2 = "Black";
+	char *expected3 = "Red";
+
+	JRBTreeInsertNode(tree, expected3);
+	JRBTreeInsertNode(tree, expected1);
+	JRBTreeInsertNode(tree, expected2);
+
+	char path[] = "/tmp/jrbtree_export_XXXXXX";
+	int fd = mkstemp(path);
+	EXPECT_NUM_EQUAL((int)JRBTreeExportToFd(tree, fd, ExportNewline), 18, int);
+	EXPECT_NUM_EQUAL((int)JRBTreeExportToFd(NULL, fd, ExportNewline), -1, int);
+	EXPECT_NUM_EQUAL((int)JRBTreeExportToFd(tree, -1, ExportNewline), -1, int);
+
+	char result[64];
+	ssize_t readSize = pread(fd, result, sizeof(result) - 1, 0);
+	result[readSize > 0 ? readSize : 0] = '\0';
+	EXPECT_STR_EQUAL(result, "#define\nBlack\nRed\n");
+
+	close(fd);
+	unlink(path);
+	DeleteJRBTree(&tree);
+})
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Main Function
 ////////////////////////////////////////////////////////////////////////////////
@@ -659,6 +2479,35 @@ int main()
 		Test_RBTree_INT_GetData,
 		Test_RBTree_INT_DeleteNodeByKey,
 		Test_RBTree_INT_FindNodeByKey,
+		Test_RBTree_INT_RedBlackInvariant,
+		Test_Frozen_INT_CreateAndDeleteFrozen,
+		Test_Frozen_INT_FindNodeByKey,
+		Test_Snapshot_INT_SaveAndLoadMapped,
+		Test_Snapshot_INT_RejectCorruptedHeader,
+		Test_Export_INT_ExportToBuffer,
+		Test_Dump_INT_DumpToBuffer,
+		Test_Dump_INT_DumpToFile,
+		Test_RBTree_INT_SizeAndMinMax,
+		Test_RBTree_INT_PopMin,
+		Test_RBTree_INT_LowerAndUpperBound,
+		Test_RBTree_INT_FindIntBranchless,
+		Test_Owned_INT_FindNodeByKeyInline,
+		Test_RBTree_INT_InsertHintAndFindFrom,
+		Test_RBTree_INT_InsertHintEqualValues,
+		Test_RBTree_INT_DeleteRangeAndTruncateBelow,
+		Test_Multiset_INT_CountAndEqualRange,
+		Test_Multiset_INT_FindNodeByKeyInline,
+		Test_Gen_INT_InsertFindDelete,
+		Test_Intrusive_INT_InsertFindRemove,
+		Test_BPlus_INT_EngineMatchesRBTree,
+		Test_HotCache_INT_FindAndInvalidate,
+		Test_HashIndex_INT_FindAndSync,
+		Test_Radix_INT_OrderedAcrossSlots,
+		Test_Interval_INT_OverlapAndStab,
+		Test_Augment_INT_RangeAggregate,
+		Test_Parallel_INT_ForEachAndReduce,
+		Test_Parallel_INT_BuildParallel,
+		Test_Stats_INT_GetStats,
 
 		// @ CHAR Test -------------------------------------------
 		Test_Node_CHAR_SetKey,
@@ -676,7 +2525,15 @@ int main()
 		Test_RBTree_STRING_SetData,
 		Test_RBTree_STRING_GetData,
 		Test_RBTree_STRING_DeleteNodeByKey,
-		Test_RBTree_STRING_FindNodeByKey
+		Test_RBTree_STRING_FindNodeByKey,
+		Test_RBTree_STRING_FindNodeByKeyInline,
+		Test_Gen_STRING_InsertFindDelete,
+		Test_RBTree_STRING_KeyDestructor,
+		Test_Owned_STRING_CopyKeys,
+		Test_StringPool_STRING_Intern,
+		Test_FrozenString_STRING_FindNodeByKey,
+		Test_Snapshot_STRING_SaveAndLoadMapped,
+		Test_Export_STRING_ExportToFd
     );
 
     RUN_ALL_TESTS();